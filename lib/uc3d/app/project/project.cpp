@@ -5,7 +5,85 @@ Project::Project(CameraManager* cameras, uint8_t numObjects)
         
     previousAnimationTime = uc3d::Time::Micros();
     previousRenderTime = uc3d::Time::Micros();
-    previousDisplayTime = uc3d::Time::Micros();
+    previousFrameTime = uc3d::Time::Micros();
+}
+
+Project::~Project() {
+    DisablePipeline();
+    SetDisplayDriver(nullptr);
+}
+
+void Project::EnablePipeline(ThreadPool* pool) {
+    DisablePipeline();
+
+    uint8_t cameraCount = cameras->GetCameraCount();
+
+    frameBuffers = new RGBColor*[cameraCount];
+
+    for (uint8_t i = 0; i < cameraCount; i++) {
+        frameBuffers[i] = new RGBColor[cameras->GetCameras()[i]->GetPixelGroup()->GetPixelCount()];
+    }
+
+    threadPool = pool;
+    pipelined = true;
+}
+
+void Project::DisablePipeline() {
+    if (!pipelined) return;
+
+    WaitForDisplay();
+
+    for (uint8_t i = 0; i < cameras->GetCameraCount(); i++) {
+        delete[] frameBuffers[i];
+    }
+
+    delete[] frameBuffers;
+
+    frameBuffers = nullptr;
+    threadPool = nullptr;
+    pipelined = false;
+}
+
+void Project::SetDisplayDriver(IDisplayDriver* driver) {
+    WaitForDisplay();
+
+    delete[] outputBuffers;
+    delete[] outputPixelCounts;
+
+    outputBuffers = nullptr;
+    outputPixelCounts = nullptr;
+    displayDriver = driver;
+
+    if (!driver) return;
+
+    outputBuffers = new const RGBColor*[cameras->GetCameraCount()];
+    outputPixelCounts = new uint16_t[cameras->GetCameraCount()];
+}
+
+const RGBColor* Project::GetFrameBuffer(uint8_t camera) {
+    if (pipelined) return frameBuffers[camera];
+
+    return cameras->GetCameras()[camera]->GetPixelGroup()->GetColors();
+}
+
+void Project::DisplayStage(uint32_t index, void* context) {
+    (void)index;
+
+    Project* project = static_cast<Project*>(context);
+
+    project->stageDisplayTime = project->OutputFrame();
+}
+
+void Project::WaitForDisplay() {
+    if (threadPool && displayJob.job) {
+        threadPool->Wait(displayJob);
+
+        displayTime = stageDisplayTime;
+    }
+
+    if (displayDriver) displayDriver->Wait();
+
+    displayJob = nullptr;
 }
 
 void Project::RenderStartTimer() {
@@ -28,8 +106,17 @@ float Project::GetDisplayTime() {
     return displayTime;
 }
 
+float Project::GetFrameDuration() {
+    // Overlapping stages no longer add up, use the measured time between frames instead
+    return pipelined && frameTime > 0.0f ? frameTime : renderTime + animationTime + displayTime;
+}
+
+QualityController* Project::GetQualityController() {
+    return &quality;
+}
+
 float Project::GetFrameRate() {
-    return avgFPS.Filter(1.0f / (renderTime + animationTime + displayTime));
+    return avgFPS.Filter(1.0f / GetFrameDuration());
 }
 
 void Project::Animate(float ratio) {
@@ -50,11 +137,63 @@ void Project::Render() {
 }
 
 void Project::Display() {
-    previousDisplayTime = uc3d::Time::Micros();
+    displayTime = OutputFrame();
+}
+
+float Project::OutputFrame() {
+    long displayStart = uc3d::Time::Micros();
+
+    if (displayDriver) {
+        uint8_t cameraCount = cameras->GetCameraCount();
+
+        for (uint8_t i = 0; i < cameraCount; i++) {
+            outputBuffers[i] = GetFrameBuffer(i);
+            outputPixelCounts[i] = cameras->GetCameras()[i]->GetPixelGroup()->GetPixelCount();
+        }
+
+        // Pipelined frames are released at the next handoff, otherwise rendering reuses the colors next
+        if (displayDriver->Submit(outputBuffers, outputPixelCounts, cameraCount) && !pipelined) {
+            displayDriver->Wait();
+        }
+    }
+
+    return ((float)(uc3d::Time::Micros() - displayStart)) / 1000000.0f;
+}
+
+void Project::Frame(float ratio) {
+    long frameStart = uc3d::Time::Micros();
+
+    frameTime = ((float)(frameStart - previousFrameTime)) / 1000000.0f;
+    previousFrameTime = frameStart;
+
+    quality.ReportFrameTime(GetFrameDuration());
+
+    Animate(ratio);
+    Render();
+
+    if (!pipelined) {
+        Display();
+        return;
+    }
+
+    // Handoff: the previous display stage must be done reading before the buffers are replaced
+    WaitForDisplay();
+
+    for (uint8_t i = 0; i < cameras->GetCameraCount(); i++) {
+        IPixelGroup* pixelGroup = cameras->GetCameras()[i]->GetPixelGroup();
+        const RGBColor* colors = pixelGroup->GetColors();
 
-    //controller->Display();
+        for (uint16_t j = 0; j < pixelGroup->GetPixelCount(); j++) {
+            frameBuffers[i][j] = colors[j];
+        }
+    }
 
-    displayTime = ((float)(uc3d::Time::Micros() - previousDisplayTime)) / 1000000.0f;
+    // A pool of one thread has no workers, the stage would sit in the queue until the next handoff
+    if (threadPool && threadPool->GetThreadCount() > 1) {
+        displayJob = threadPool->Submit(DisplayStage, this);
+    } else {
+        Display();
+    }
 }
 
 void Project::PrintStats(){
@@ -16,6 +16,9 @@
 #include "../../systems/render/core/cameramanager.hpp" // Include for camera management.
 #include "../../core/signal/filter/runningaveragefilter.hpp" // Include for filtering utilities.
 #include "../../core/platform/time.hpp"
+#include "../../core/platform/threadpool.hpp" // Include for the pipelined display stage.
+#include "../../systems/output/idisplaydriver.hpp" // Include for frame output.
+#include "qualitycontroller.hpp" // Include for the frame budget controller.
 
 /**
  * @class Project
@@ -24,6 +27,20 @@
  * The Project class integrates various subsystems including camera management, scene rendering,
  * and display updates. It also tracks and reports performance metrics such as frame rate and
  * individual operation times.
+ *
+ * Frame runs the three stages of a frame. In pipelined mode the rendered colors are copied into
+ * frame buffers once rendering finishes, and the display stage reads those buffers while the
+ * next frame animates and renders. The copy is the handoff point: it waits for the previous
+ * display stage to release the buffers. A pool without worker threads displays on the caller,
+ * since a submitted stage would only run at the next handoff.
+ *
+ * Only the display stage is pipelined. Update modifies the meshes, transforms and materials
+ * that rendering reads in place, so overlapping animation with rendering needs a second copy of
+ * the scene state and a swap at the handoff. That is not implemented: animation of frame N+1
+ * still starts after frame N has rendered.
+ *
+ * Each Frame reports the duration of the previous frame to the QualityController, which sheds
+ * or restores quality before the frame animates. Without a target frame time it does nothing.
  */
 class Project {
 protected:
@@ -34,11 +51,54 @@ protected:
 
     long previousAnimationTime = 0; ///< Time of the previous animation frame in microseconds.
     long previousRenderTime = 0; ///< Time of the previous render frame in microseconds.
-    long previousDisplayTime = 0; ///< Time of the previous display frame in microseconds.
     float fade = 0.0f; ///< Fade parameter for animations.
     float animationTime = 0.0f; ///< Time spent on animation in milliseconds.
     float renderTime = 0.0f; ///< Time spent on rendering in milliseconds.
     float displayTime = 0.0f; ///< Time spent on display in milliseconds.
+    float stageDisplayTime = 0.0f; ///< Display time written by a display stage on the pool, published at the handoff.
+    long previousFrameTime = 0; ///< Start of the previous frame in microseconds.
+    float frameTime = 0.0f; ///< Wall time between the starts of the last two frames in seconds.
+
+    bool pipelined = false; ///< True if the display stage overlaps the next frame.
+    ThreadPool* threadPool = nullptr; ///< Pool running the display stage, null to display on the caller.
+    ThreadPool::JobHandle displayJob = nullptr; ///< Display stage of the previous frame.
+    RGBColor** frameBuffers = nullptr; ///< Colors of each camera handed to the display stage.
+
+    IDisplayDriver* displayDriver = nullptr; ///< Driver outputting frames, null if frames are not output.
+    const RGBColor** outputBuffers = nullptr; ///< Buffers of the frame submitted to the driver.
+    uint16_t* outputPixelCounts = nullptr; ///< Pixel counts of the frame submitted to the driver.
+
+    QualityController quality; ///< Sheds quality while frames exceed the target frame time.
+
+    /**
+     * @brief Runs the display stage of a pipelined frame.
+     *
+     * @param index Unused job index.
+     * @param context Pointer to the Project.
+     */
+    static void DisplayStage(uint32_t index, void* context);
+
+    /**
+     * @brief Outputs the current frame to the display driver.
+     *
+     * @return The time spent in seconds.
+     */
+    float OutputFrame();
+
+    /**
+     * @brief Waits for the display stage and the driver to release the frame buffers.
+     *
+     * The display time of a stage that ran on the pool is published here, after the wait, so
+     * the main thread never reads it while the stage writes it.
+     */
+    void WaitForDisplay();
+
+    /**
+     * @brief Retrieves the time the last frame took.
+     *
+     * @return The time between frames in pipelined mode, since stages overlap, otherwise the sum of the stage times, in seconds.
+     */
+    float GetFrameDuration();
 
     /**
      * @brief Updates the project state based on the given ratio.
@@ -70,6 +130,46 @@ public:
      */
     Project(CameraManager* cameras, uint8_t numObjects);
 
+    /**
+     * @brief Waits for a pending display stage and frees the frame buffers.
+     */
+    virtual ~Project();
+
+    /**
+     * @brief Overlaps the display stage of each frame with the next frame.
+     *
+     * Allocates one frame buffer per camera. Without a pool, or with a pool of one thread, the
+     * display stage still reads the frame buffers but runs on the caller, which lets display
+     * hardware with its own DMA output the buffers while the next frame is computed.
+     *
+     * @param pool Pool running the display stage, or nullptr.
+     */
+    void EnablePipeline(ThreadPool* pool);
+
+    /**
+     * @brief Returns to running the stages of a frame in sequence.
+     */
+    void DisablePipeline();
+
+    /**
+     * @brief Sets the driver the display stage submits frames to.
+     *
+     * Outside pipelined mode the display stage waits for the driver to finish, since the next
+     * frame renders into the same colors. In pipelined mode the output of a frame overlaps the
+     * next frame until the handoff.
+     *
+     * @param driver The driver, or nullptr to stop outputting frames.
+     */
+    void SetDisplayDriver(IDisplayDriver* driver);
+
+    /**
+     * @brief Retrieves the colors the display stage outputs for a camera.
+     *
+     * @param camera Index of the camera in the CameraManager.
+     * @return The frame buffer in pipelined mode, the camera's pixel colors otherwise.
+     */
+    const RGBColor* GetFrameBuffer(uint8_t camera);
+
     /**
      * @brief Retrieves the time spent on animations.
      *
@@ -91,6 +191,15 @@ public:
      */
     float GetDisplayTime();
 
+    /**
+     * @brief Retrieves the controller adapting quality to the frame time budget.
+     *
+     * Add steps and set a target frame time to enable it.
+     *
+     * @return Pointer to the QualityController.
+     */
+    QualityController* GetQualityController();
+
     /**
      * @brief Retrieves the current frame rate.
      *
@@ -123,6 +232,15 @@ public:
      */
     void Display();
 
+    /**
+     * @brief Animates, renders and displays one frame.
+     *
+     * In pipelined mode the display stage of this frame may still be running on return.
+     *
+     * @param ratio A float representing the interpolation ratio for animations.
+     */
+    void Frame(float ratio);
+
     /**
      * @brief Prints performance statistics such as frame rate and operation times.
      */
@@ -0,0 +1,84 @@
+#include "qualitycontroller.hpp"
+
+void QualityController::SetLevel(Step& step, uint8_t level) {
+    step.level = level;
+    step.function(level, step.context);
+
+    // The new level must be measured on its own before deciding again
+    slowFrames = 0;
+    fastFrames = 0;
+}
+
+bool QualityController::AddStep(Function function, void* context, uint8_t levels) {
+    if (stepCount >= kMaxSteps || !function) return false;
+
+    steps[stepCount++] = Step{ function, context, levels, 0 };
+
+    return true;
+}
+
+void QualityController::SetTargetFrameTime(float targetTime) {
+    this->targetTime = targetTime;
+    slowFrames = 0;
+    fastFrames = 0;
+
+    if (targetTime <= 0.0f) RestoreAll();
+}
+
+float QualityController::GetTargetFrameTime() const {
+    return targetTime;
+}
+
+void QualityController::ReportFrameTime(float frameTime) {
+    if (targetTime <= 0.0f || frameTime <= 0.0f) return;
+
+    if (frameTime > targetTime) {
+        fastFrames = 0;
+
+        if (++slowFrames >= kShedFrames) {
+            Shed();
+            slowFrames = 0;
+        }
+    } else if (frameTime < targetTime * kRestoreRatio) {
+        slowFrames = 0;
+
+        if (++fastFrames >= kRestoreFrames) {
+            Restore();
+            fastFrames = 0;
+        }
+    } else {
+        // Close to the budget, the current level fits
+        slowFrames = 0;
+        fastFrames = 0;
+    }
+}
+
+bool QualityController::Shed() {
+    for (uint8_t i = 0; i < stepCount; ++i) {
+        if (steps[i].level < steps[i].levels) {
+            SetLevel(steps[i], steps[i].level + 1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool QualityController::Restore() {
+    for (uint8_t i = stepCount; i > 0; --i) {
+        if (steps[i - 1].level > 0) {
+            SetLevel(steps[i - 1], steps[i - 1].level - 1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void QualityController::RestoreAll() {
+    while (Restore()) {}
+}
+
+uint8_t QualityController::GetLevel(uint8_t step) const {
+    return step < stepCount ? steps[step].level : 0;
+}
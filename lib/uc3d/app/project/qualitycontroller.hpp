@@ -0,0 +1,142 @@
+/**
+ * @file QualityController.h
+ * @brief Declares the QualityController class trading image quality for a stable frame rate.
+ *
+ * Scene load varies, a blink or a particle burst can push a frame over its period while most
+ * frames have headroom. QualityController compares the measured frame time with a target and
+ * lowers quality one level at a time while frames are too slow, then raises it again once
+ * they are comfortably fast.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @class QualityController
+ * @brief Sheds and restores quality steps in priority order to meet a frame time budget.
+ *
+ * A step is a callback receiving a level, 0 for full quality and higher for cheaper output,
+ * such as a camera shading rate, a post effect that is skipped, fewer noise octaves or a
+ * smaller blur radius. Steps are shed in the order they were added, each one down to its
+ * last level before the next, and restored in reverse order:
+ *
+ * @code
+ * static void ShadingRate(uint8_t level, void* camera) {
+ *     static_cast<CameraBase*>(camera)->SetShadingRate(uint8_t(1 << level));
+ * }
+ *
+ * quality->AddStep(ShadingRate, camera, 2); // Rates 1, 2 and 4
+ * quality->AddStep(SkipGlow, &glowEnabled);  // Then drop the glow effect
+ * quality->SetTargetFrameTime(1.0f / 60.0f);
+ * @endcode
+ *
+ * Quality is only lowered after kShedFrames slow frames in a row and raised after
+ * kRestoreFrames frames below kRestoreRatio of the target, so single spikes are ignored and a
+ * level that barely fits is not toggled every frame. Callbacks run on the thread reporting
+ * the frame time, between frames.
+ */
+class QualityController {
+public:
+    /**
+     * @brief Applies a quality level of a step.
+     *
+     * @param level The new level, 0 for full quality.
+     * @param context Pointer given when the step was added.
+     */
+    using Function = void (*)(uint8_t level, void* context);
+
+    static constexpr uint8_t kMaxSteps = 8; ///< Maximum number of steps.
+
+private:
+    static constexpr uint8_t kShedFrames = 3; ///< Slow frames in a row before quality is lowered.
+    static constexpr uint8_t kRestoreFrames = 30; ///< Fast frames in a row before quality is raised.
+    static constexpr float kRestoreRatio = 0.75f; ///< Fraction of the target a frame must stay below to count as fast.
+
+    /**
+     * @struct Step
+     * @brief One way of saving time and its current level.
+     */
+    struct Step {
+        Function function; ///< Callback applying a level.
+        void* context; ///< Context passed to the callback.
+        uint8_t levels; ///< Number of levels below full quality.
+        uint8_t level; ///< Current level.
+    };
+
+    Step steps[kMaxSteps]; ///< Steps in shedding order.
+    uint8_t stepCount = 0; ///< Number of steps added.
+    float targetTime = 0.0f; ///< Frame time budget in seconds, 0 disables the controller.
+    uint8_t slowFrames = 0; ///< Consecutive frames over the target.
+    uint8_t fastFrames = 0; ///< Consecutive frames with headroom.
+
+    /**
+     * @brief Moves a step to a level and applies it.
+     */
+    void SetLevel(Step& step, uint8_t level);
+
+public:
+    QualityController() = default;
+
+    /**
+     * @brief Adds a step after the existing ones, at full quality.
+     *
+     * @param function Callback applying a level.
+     * @param context Pointer passed to the callback.
+     * @param levels Number of levels below full quality.
+     * @return False if kMaxSteps steps were already added.
+     */
+    bool AddStep(Function function, void* context, uint8_t levels = 1);
+
+    /**
+     * @brief Sets the frame time budget, 0 disables the controller and restores full quality.
+     *
+     * @param targetTime Target frame time in seconds.
+     */
+    void SetTargetFrameTime(float targetTime);
+
+    /**
+     * @brief Retrieves the frame time budget.
+     *
+     * @return The target frame time in seconds, 0 if disabled.
+     */
+    float GetTargetFrameTime() const;
+
+    /**
+     * @brief Counts a frame towards shedding or restoring quality.
+     *
+     * @param frameTime Time the frame took in seconds.
+     */
+    void ReportFrameTime(float frameTime);
+
+    /**
+     * @brief Lowers quality by one level.
+     *
+     * @return False if every step is already at its lowest level.
+     */
+    bool Shed();
+
+    /**
+     * @brief Raises quality by one level.
+     *
+     * @return False if every step is already at full quality.
+     */
+    bool Restore();
+
+    /**
+     * @brief Returns every step to full quality.
+     */
+    void RestoreAll();
+
+    /**
+     * @brief Retrieves the current level of a step.
+     *
+     * @param step Index of the step in the order it was added.
+     * @return The level, 0 for full quality or unknown steps.
+     */
+    uint8_t GetLevel(uint8_t step) const;
+};
@@ -52,4 +52,17 @@ public:
      */
     virtual Triangle3D* GetTriangles() = 0;
 
+    /**
+     * @brief Flags a write to the vertices, deformers call it after changing them.
+     */
+    void MarkChanged() { ++version; }
+
+    /**
+     * @brief Retrieves the number of MarkChanged calls, renderers compare it between frames.
+     * @return The current version.
+     */
+    uint32_t GetVersion() const { return version; }
+
+private:
+    uint32_t version = 0; ///< Incremented by MarkChanged.
 };
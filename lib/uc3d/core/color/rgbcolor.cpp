@@ -62,7 +62,7 @@ RGBColor RGBColor::Add(const uint8_t& value) {
     return RGBColor(sR, sG, sB);
 }
 
-RGBColor RGBColor::HueShift(const float& hueDeg) {
+RGBColor RGBColor::HueShift(const float& hueDeg) const {
     //hueDeg = (int)hueDeg % 360;
     //shift color space by rotating rgb vector about diagonal vector (1, 1, 1)
     float hueRad = hueDeg * Mathematics::MPI / 180.0f;
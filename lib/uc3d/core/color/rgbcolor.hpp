@@ -81,7 +81,7 @@ public:
      * @param hueDeg The angle in degrees to shift the hue.
      * @return A new RGBColor with the hue shifted.
      */
-    RGBColor HueShift(const float& hueDeg);
+    RGBColor HueShift(const float& hueDeg) const;
 
     /**
      * @brief Interpolates between two colors based on a ratio.
@@ -1,8 +1,10 @@
 #include "rectangle.hpp"
 
-Rectangle2D::Rectangle2D(Vector2D center, Vector2D size, float rotation) : Shape(center, size, rotation) {}
+Rectangle2D::Rectangle2D(Vector2D center, Vector2D size, float rotation)
+    : Shape(center, size, rotation), minV(bounds.minV), maxV(bounds.maxV), midV(center) {}
 
-Rectangle2D::Rectangle2D(Bounds bounds, float rotationDeg) : Shape(bounds, rotationDeg) {}
+Rectangle2D::Rectangle2D(Bounds bounds, float rotationDeg)
+    : Shape(bounds, rotationDeg), minV(bounds.minV), maxV(bounds.maxV), midV((bounds.minV + bounds.maxV) * 0.5f) {}
 
 bool Rectangle2D::IsInShape(Vector2D p) {
     Vector2D center = GetCenter();
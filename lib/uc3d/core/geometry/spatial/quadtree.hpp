@@ -15,8 +15,13 @@
  * @brief A templated, 2-D quadtree for spatial partitioning.
  *
  * This quadtree stores pointers to objects of type T.
- * The template type T must provide the following public method:
+ * The template type T must provide the following public methods:
  * bool Overlaps(const Rectangle2D& bounds) const;
+ * bool IsWithin(const Rectangle2D& bounds) const;
+ *
+ * An item is pushed down into a child only if it lies entirely within that child,
+ * items straddling child boundaries stay in the parent. Point queries must therefore
+ * visit every node on the path from the root to the leaf, see FindChild.
  *
  * This implementation is memory-conscious, using raw dynamically-sized
  * arrays instead of std::vector. The maximum depth and item capacity
@@ -53,6 +58,7 @@ public:
         unsigned short capacity;  ///< Allocated size of the items array.
         T** items;     ///< Pointer to a dynamic array of item pointers.
         Node* children;  ///< Pointer to an array of 4 child nodes, or nullptr if a leaf.
+        unsigned char depth; ///< Depth of this node, the root is at depth 0.
 
         /** @brief Expands the capacity of the items array. */
         void Expand(unsigned short newCap);
@@ -64,8 +70,8 @@ public:
         unsigned short Distribute();
 
     public:
-        /** @brief Constructs a node with the given rectangular bounds. */
-        explicit Node(const Rectangle2D& r);
+        /** @brief Constructs a node with the given rectangular bounds at a depth in the tree. */
+        explicit Node(const Rectangle2D& r, unsigned char depth = 0);
 
         /** @brief Destructor that recursively deletes children and frees item storage. */
         ~Node();
@@ -76,8 +82,21 @@ public:
         /** @brief Finds the leaf node containing a specific point. */
         Node* FindLeaf(const Vector2D& p);
 
-        /** @brief Subdivides the node if it exceeds item capacity and is not at max depth. */
-        void Subdivide(unsigned char depth = 0);
+        /** @brief Finds the child containing a specific point, or nullptr for leaves. */
+        Node* FindChild(const Vector2D& p) const;
+
+        /** @brief Subdivides the node if it is not at max depth. */
+        void Subdivide();
+
+        /**
+         * @brief Orders the items of this node and of every descendant.
+         *
+         * Uses an insertion sort, nodes hold few items and are often nearly sorted already.
+         *
+         * @tparam Less Callable taking two item pointers, true if the first goes first.
+         */
+        template<typename Less>
+        void SortItems(Less less);
 
         /** @brief Checks if this node is a leaf (has no children). */
         bool IsLeaf() const { return children == nullptr; }
@@ -101,6 +120,8 @@ public:
 
     /**
      * @brief Queries the tree to find items at a specific point.
+     * @note Only returns the items of the leaf, items straddling the boundaries of
+     * the leaf or its ancestors are held by those ancestors.
      * @param p The point to query.
      * @param countOut [out] The number of items found.
      * @return A pointer to an array of item pointers, or nullptr if the point is outside the tree.
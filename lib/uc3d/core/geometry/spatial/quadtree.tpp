@@ -3,12 +3,13 @@
 /*----- QuadTree<T>::Node Implementation -----*/
 
 template<typename T>
-QuadTree<T>::Node::Node(const Rectangle2D& r) :
+QuadTree<T>::Node::Node(const Rectangle2D& r, unsigned char depth) :
     bounds(r),
     itemCount(0),
     capacity(0),
     items(nullptr),
-    children(nullptr)
+    children(nullptr),
+    depth(depth)
 {}
 
 template<typename T>
@@ -44,12 +45,14 @@ void QuadTree<T>::Node::CreateChildren() {
     Vector2D min = bounds.GetMinimum();
     Vector2D max = bounds.GetMaximum();
 
-    // Create four children for the four quadrants
+    // Create four children for the four quadrants, from their minimum and maximum corners
+    unsigned char childDepth = depth + 1;
+
     children = new Node[4]{
-        Node(Rectangle2D(min, center)),                                       // Top-left
-        Node(Rectangle2D(Vector2D(center.X, min.Y), Vector2D(max.X, center.Y))), // Top-right
-        Node(Rectangle2D(Vector2D(min.X, center.Y), Vector2D(center.X, max.Y))), // Bottom-left
-        Node(Rectangle2D(center, max))                                         // Bottom-right
+        Node(Rectangle2D(Rectangle2D::Bounds{ min, center }), childDepth),                                       // Top-left
+        Node(Rectangle2D(Rectangle2D::Bounds{ Vector2D(center.X, min.Y), Vector2D(max.X, center.Y) }), childDepth), // Top-right
+        Node(Rectangle2D(Rectangle2D::Bounds{ Vector2D(min.X, center.Y), Vector2D(center.X, max.Y) }), childDepth), // Bottom-left
+        Node(Rectangle2D(Rectangle2D::Bounds{ center, max }), childDepth)                                         // Bottom-right
     };
 }
 
@@ -65,8 +68,8 @@ unsigned short QuadTree<T>::Node::Distribute() {
     while (i < itemCount) {
         bool movedToChild = false;
         for (int j = 0; j < 4; ++j) {
-            // If a child can accept the item, move it
-            if (children[j].Insert(items[i])) {
+            // Move the item into the child that fully contains it
+            if (items[i]->IsWithin(children[j].bounds) && children[j].Insert(items[i])) {
                 movedToChild = true;
                 movedCount++;
                 // Item was moved, so remove it from this node's list by
@@ -98,10 +101,10 @@ bool QuadTree<T>::Node::Insert(T* item) {
         Subdivide();
     }
 
-    // If it has children, try to insert into a child.
+    // If it has children, try to insert into the child that fully contains the item.
     if (!IsLeaf()) {
         for (int i = 0; i < 4; ++i) {
-            if (children[i].Insert(item)) {
+            if (item->IsWithin(children[i].bounds) && children[i].Insert(item)) {
                 return true; // Successfully inserted into a child
             }
         }
@@ -118,7 +121,7 @@ bool QuadTree<T>::Node::Insert(T* item) {
 }
 
 template<typename T>
-void QuadTree<T>::Node::Subdivide(unsigned char depth) {
+void QuadTree<T>::Node::Subdivide() {
     // Do not subdivide if already at max depth or if it already has children
     if (depth >= kMaxDepth || !IsLeaf()) {
         return;
@@ -132,6 +135,28 @@ void QuadTree<T>::Node::Subdivide(unsigned char depth) {
     }
 }
 
+template<typename T>
+template<typename Less>
+void QuadTree<T>::Node::SortItems(Less less) {
+    for (unsigned short i = 1; i < itemCount; ++i) {
+        T* item = items[i];
+        unsigned short j = i;
+
+        while (j > 0 && less(item, items[j - 1])) {
+            items[j] = items[j - 1];
+            --j;
+        }
+
+        items[j] = item;
+    }
+
+    if (children) {
+        for (unsigned char i = 0; i < 4; ++i) {
+            children[i].SortItems(less);
+        }
+    }
+}
+
 template<typename T>
 typename QuadTree<T>::Node* QuadTree<T>::Node::FindLeaf(const Vector2D& p) {
     if (!bounds.Contains(p)) {
@@ -155,6 +180,21 @@ typename QuadTree<T>::Node* QuadTree<T>::Node::FindLeaf(const Vector2D& p) {
     return this;
 }
 
+template<typename T>
+typename QuadTree<T>::Node* QuadTree<T>::Node::FindChild(const Vector2D& p) const {
+    if (IsLeaf()) {
+        return nullptr;
+    }
+
+    for (unsigned char i = 0; i < 4; ++i) {
+        if (children[i].bounds.Contains(p)) {
+            return &children[i];
+        }
+    }
+
+    return nullptr;
+}
+
 
 /*----- QuadTree<T> Class Implementation -----*/
 
@@ -0,0 +1,122 @@
+/**
+ * @file FixedPoint.h
+ * @brief Defines the FixedPoint class template for arithmetic on targets without an FPU.
+ *
+ * A FixedPoint stores a number as an integer scaled by 2^FractionBits. Additions are plain
+ * integer additions and products are computed in a wider integer type before shifting back,
+ * so no floating-point instruction or software float routine is involved.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @class FixedPoint
+ * @brief Signed fixed-point number with a compile-time number of fraction bits.
+ *
+ * Conversions from float saturate at the limits of the storage type. Products and quotients
+ * round towards zero and wrap like the underlying integers if the result is out of range.
+ *
+ * @tparam Storage Signed integer holding the scaled value.
+ * @tparam Wide Signed integer at least twice as wide as Storage, used for products.
+ * @tparam FractionBits Number of bits below the binary point.
+ */
+template<typename Storage, typename Wide, uint8_t FractionBits>
+class FixedPoint {
+public:
+    using StorageType = Storage; ///< Integer holding the scaled value.
+    using WideType = Wide; ///< Integer holding products of two values.
+
+    static constexpr uint8_t kFractionBits = FractionBits; ///< Bits below the binary point.
+    static constexpr Storage kOne = Storage(Storage(1) << FractionBits); ///< Raw value of 1.
+
+private:
+    Storage raw = 0; ///< Value scaled by 2^FractionBits.
+
+public:
+    /**
+     * @brief Constructs a zero value.
+     */
+    constexpr FixedPoint() = default;
+
+    /**
+     * @brief Converts a float, saturating at the range of the storage type.
+     *
+     * @param value The value to convert.
+     */
+    FixedPoint(float value);
+
+    /**
+     * @brief Converts a double through float, so literals convert without ambiguity.
+     *
+     * @param value The value to convert.
+     */
+    FixedPoint(double value) : FixedPoint(float(value)) {}
+
+    /**
+     * @brief Converts an integer.
+     *
+     * @param value The value to convert, must fit the integer bits.
+     */
+    constexpr FixedPoint(int value) : raw(Storage(Storage(value) * kOne)) {}
+
+    /**
+     * @brief Constructs a value from its scaled integer.
+     *
+     * @param raw Value scaled by 2^FractionBits.
+     * @return The fixed-point value.
+     */
+    static constexpr FixedPoint FromRaw(Storage raw) {
+        FixedPoint value;
+        value.raw = raw;
+        return value;
+    }
+
+    /**
+     * @brief Retrieves the scaled integer.
+     *
+     * @return Value scaled by 2^FractionBits.
+     */
+    constexpr Storage GetRaw() const {
+        return raw;
+    }
+
+    /**
+     * @brief Converts the value to a float.
+     *
+     * @return The value as a float.
+     */
+    float ToFloat() const;
+
+    explicit operator float() const {
+        return ToFloat();
+    }
+
+    FixedPoint operator+(const FixedPoint& other) const { return FromRaw(Storage(raw + other.raw)); }
+    FixedPoint operator-(const FixedPoint& other) const { return FromRaw(Storage(raw - other.raw)); }
+    FixedPoint operator-() const { return FromRaw(Storage(-raw)); }
+    FixedPoint operator*(const FixedPoint& other) const;
+    FixedPoint operator/(const FixedPoint& other) const;
+
+    FixedPoint& operator+=(const FixedPoint& other) { return *this = *this + other; }
+    FixedPoint& operator-=(const FixedPoint& other) { return *this = *this - other; }
+    FixedPoint& operator*=(const FixedPoint& other) { return *this = *this * other; }
+    FixedPoint& operator/=(const FixedPoint& other) { return *this = *this / other; }
+
+    bool operator==(const FixedPoint& other) const { return raw == other.raw; }
+    bool operator!=(const FixedPoint& other) const { return raw != other.raw; }
+    bool operator<(const FixedPoint& other) const { return raw < other.raw; }
+    bool operator<=(const FixedPoint& other) const { return raw <= other.raw; }
+    bool operator>(const FixedPoint& other) const { return raw > other.raw; }
+    bool operator>=(const FixedPoint& other) const { return raw >= other.raw; }
+};
+
+using Q16_16 = FixedPoint<int32_t, int64_t, 16>; ///< Range of +-32768 with a resolution of 1/65536.
+using Q8_8 = FixedPoint<int16_t, int32_t, 8>; ///< Range of +-128 with a resolution of 1/256.
+
+#include "fixedpoint.tpp" // Include the template implementation.
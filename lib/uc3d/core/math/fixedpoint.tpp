@@ -0,0 +1,32 @@
+#pragma once
+
+template<typename Storage, typename Wide, uint8_t FractionBits>
+FixedPoint<Storage, Wide, FractionBits>::FixedPoint(float value) {
+    // Largest and smallest raw values as floats, compared before converting to avoid overflow
+    const float maximum = float(Storage((Wide(1) << (sizeof(Storage) * 8 - 1)) - 1));
+    const float minimum = -maximum - 1.0f;
+    float scaled = value * float(kOne);
+
+    if (scaled >= maximum) {
+        raw = Storage((Wide(1) << (sizeof(Storage) * 8 - 1)) - 1);
+    } else if (scaled <= minimum) {
+        raw = Storage(-(Wide(1) << (sizeof(Storage) * 8 - 1)));
+    } else {
+        raw = Storage(scaled);
+    }
+}
+
+template<typename Storage, typename Wide, uint8_t FractionBits>
+float FixedPoint<Storage, Wide, FractionBits>::ToFloat() const {
+    return float(raw) / float(kOne);
+}
+
+template<typename Storage, typename Wide, uint8_t FractionBits>
+FixedPoint<Storage, Wide, FractionBits> FixedPoint<Storage, Wide, FractionBits>::operator*(const FixedPoint& other) const {
+    return FromRaw(Storage((Wide(raw) * Wide(other.raw)) / Wide(kOne)));
+}
+
+template<typename Storage, typename Wide, uint8_t FractionBits>
+FixedPoint<Storage, Wide, FractionBits> FixedPoint<Storage, Wide, FractionBits>::operator/(const FixedPoint& other) const {
+    return FromRaw(Storage((Wide(raw) * Wide(kOne)) / Wide(other.raw)));
+}
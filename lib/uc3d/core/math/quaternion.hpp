@@ -1,8 +1,8 @@
 /**
  * @file Quaternion.h
- * @brief Defines the Quaternion class for 3D rotations and transformations.
+ * @brief Defines the Quat class template and the Quaternion alias for 3D rotations and transformations.
  *
- * This header provides a Quaternion class that supports various quaternion operations
+ * This header provides a Quat class template that supports various quaternion operations
  * (addition, multiplication, division, interpolation, etc.) as well as methods for
  * rotating 2D and 3D vectors. Quaternions are commonly used for representing rotations
  * in 3D space without suffering from some of the limitations of Euler angles (e.g.,
@@ -16,42 +16,57 @@
 #pragma once
 
 #include "mathematics.hpp"
+#include "scalarmath.hpp"
 #include "vector2d.hpp"
 #include "vector3d.hpp"
 
 /**
- * @class Quaternion
+ * @class Quat
  * @brief A mathematical construct representing a rotation in 3D space.
  *
  * Quaternions consist of a scalar part (W) and a vector part (X, Y, Z). They allow
  * smooth interpolation (slerp), concatenation of rotations, and are often used to
  * avoid gimbal lock problems that can occur when using Euler angles.
+ *
+ * The scalar type T can be float, double, a half float or a FixedPoint format, `Quaternion` is the
+ * float version used throughout the library. Functions other than arithmetic, such as roots and
+ * trigonometry, come from ScalarMath<T>.
+ *
+ * @tparam T The scalar type of the components.
  */
-class Quaternion {
+template<typename T>
+class Quat {
 public:
-    float W; ///< Scalar part of the quaternion.
-    float X; ///< X component of the quaternion's vector part.
-    float Y; ///< Y component of the quaternion's vector part.
-    float Z; ///< Z component of the quaternion's vector part.
+    T W; ///< Scalar part of the quaternion.
+    T X; ///< X component of the quaternion's vector part.
+    T Y; ///< Y component of the quaternion's vector part.
+    T Z; ///< Z component of the quaternion's vector part.
 
     /**
      * @brief Default constructor. Initializes the quaternion to identity (1,0,0,0).
      */
-    Quaternion();
+    Quat();
 
     /**
      * @brief Copy constructor. Clones the values of another quaternion.
      * @param quaternion The quaternion to copy from.
      */
-    Quaternion(const Quaternion& quaternion);
+    Quat(const Quat& quaternion);
+
+    /**
+     * @brief Converts a quaternion of another scalar type, through float.
+     * @param quaternion The quaternion to convert.
+     */
+    template<typename U>
+    explicit Quat(const Quat<U>& quaternion) : W(T(ScalarMath<U>::ToFloat(quaternion.W))), X(T(ScalarMath<U>::ToFloat(quaternion.X))), Y(T(ScalarMath<U>::ToFloat(quaternion.Y))), Z(T(ScalarMath<U>::ToFloat(quaternion.Z))) {}
 
     /**
      * @brief Constructs a quaternion purely from a 3D vector (0, X, Y, Z).
      * @param vector The vector that forms the (X, Y, Z) part of the quaternion.
      *
-     * The W component is initialized to 0.0f.
+     * The W component is initialized to 0.
      */
-    Quaternion(const Vector3D& vector);
+    Quat(const Vector3<T>& vector);
 
     /**
      * @brief Constructs a quaternion with individual scalar and vector components.
@@ -60,7 +75,7 @@ public:
      * @param y Y component of the vector part.
      * @param z Z component of the vector part.
      */
-    Quaternion(const float& w, const float& x, const float& y, const float& z);
+    Quat(const T& w, const T& x, const T& y, const T& z);
 
     /**
      * @brief Rotates a 2D vector by this quaternion, projecting it in 2D.
@@ -102,7 +117,7 @@ public:
      * 
      * @note If the quaternion is close to zero (no rotation), the input vector is returned unchanged.
      */
-    Vector2D RotateVector(const Vector2D& v) const;
+    Vector2<T> RotateVector(const Vector2<T>& v) const;
 
     /**
      * @brief Rotates a 2D vector by a unit quaternion (assumes normalized),
@@ -111,40 +126,40 @@ public:
      * @param q The (unit) quaternion to apply for the rotation.
      * @return A new 2D vector that has been rotated using \p q.
      */
-    Vector2D RotateVectorUnit(const Vector2D& v, const Quaternion& q) const;
+    Vector2<T> RotateVectorUnit(const Vector2<T>& v, const Quat& q) const;
 
     /**
      * @brief Applies the inverse of this quaternion's rotation to a 2D vector.
      * @param coordinate The 2D vector to transform.
      * @return The unrotated 2D vector.
      */
-    Vector2D UnrotateVector(const Vector2D& coordinate) const;
+    Vector2<T> UnrotateVector(const Vector2<T>& coordinate) const;
 
     /**
      * @brief Rotates a 3D vector by this quaternion.
      * @param v The 3D vector to rotate.
      * @return A new 3D vector that has been rotated.
      */
-    Vector3D RotateVector(const Vector3D& v) const;
+    Vector3<T> RotateVector(const Vector3<T>& v) const;
 
     /**
      * @brief Applies the inverse of this quaternion's rotation to a 3D vector.
      * @param coordinate The 3D vector to transform.
      * @return The unrotated 3D vector.
      */
-    Vector3D UnrotateVector(const Vector3D& coordinate) const;
+    Vector3<T> UnrotateVector(const Vector3<T>& coordinate) const;
 
     /**
      * @brief Retrieves the bi-vector (X, Y, Z) portion of the quaternion (with W=0).
      * @return A 3D vector representing the (X, Y, Z) parts of this quaternion.
      */
-    Vector3D GetBiVector() const;
+    Vector3<T> GetBiVector() const;
 
     /**
      * @brief Retrieves the normal vector part of the quaternion, typically its axis of rotation.
      * @return A 3D vector representing the axis (X, Y, Z).
      */
-    Vector3D GetNormal() const;
+    Vector3<T> GetNormal() const;
 
     /**
      * @brief Performs spherical linear interpolation (slerp) between two quaternions.
@@ -153,7 +168,7 @@ public:
      * @param ratio A normalized value (0 to 1) indicating how far to interpolate from \p q1 to \p q2.
      * @return A new quaternion representing the slerped result.
      */
-    static Quaternion SphericalInterpolation(const Quaternion& q1, const Quaternion& q2, const float& ratio);
+    static Quat SphericalInterpolation(const Quat& q1, const Quat& q2, const T& ratio);
 
     /**
      * @brief Computes a small rotation quaternion given an angular velocity and time delta.
@@ -161,119 +176,119 @@ public:
      * @param timeDelta The time step.
      * @return A new quaternion representing the rotation over the given time delta.
      */
-    Quaternion DeltaRotation(const Vector3D& angularVelocity, const float& timeDelta) const;
+    Quat DeltaRotation(const Vector3<T>& angularVelocity, const T& timeDelta) const;
 
     /**
      * @brief Adds two quaternions component-wise.
      * @param quaternion The quaternion to add to the current one.
      * @return A new quaternion representing the sum.
      */
-    Quaternion Add(const Quaternion& quaternion) const;
+    Quat Add(const Quat& quaternion) const;
 
     /**
      * @brief Subtracts a quaternion from this quaternion component-wise.
      * @param quaternion The quaternion to subtract.
      * @return A new quaternion representing the difference.
      */
-    Quaternion Subtract(const Quaternion& quaternion) const;
+    Quat Subtract(const Quat& quaternion) const;
 
     /**
      * @brief Multiplies (composes) this quaternion with another (order matters).
      * @param quaternion The right-hand side quaternion.
      * @return The resulting quaternion from the multiplication.
      */
-    Quaternion Multiply(const Quaternion& quaternion) const;
+    Quat Multiply(const Quat& quaternion) const;
 
     /**
      * @brief Scales this quaternion by a scalar factor.
      * @param scalar The scalar to multiply.
      * @return A new quaternion scaled by \p scalar.
      */
-    Quaternion Multiply(const float& scalar) const;
+    Quat Multiply(const T& scalar) const;
 
     /**
      * @brief Divides this quaternion by another quaternion component-wise (not a typical quaternion operation).
      * @param quaternion The quaternion to divide by.
      * @return A new quaternion representing the component-wise result.
      */
-    Quaternion Divide(const Quaternion& quaternion) const;
+    Quat Divide(const Quat& quaternion) const;
 
     /**
      * @brief Divides this quaternion by a scalar.
      * @param scalar The scalar divisor.
      * @return A new quaternion scaled by the reciprocal of \p scalar.
      */
-    Quaternion Divide(const float& scalar) const;
+    Quat Divide(const T& scalar) const;
 
     /**
      * @brief Raises this quaternion to the power of another quaternion (component-wise).
      * @param exponent The quaternion exponent.
      * @return A new quaternion representing the powered result.
      */
-    Quaternion Power(const Quaternion& exponent) const;
+    Quat Power(const Quat& exponent) const;
 
     /**
      * @brief Raises this quaternion to a scalar power.
      * @param exponent The exponent (e.g., 2.0f).
      * @return A new quaternion representing this^exponent.
      */
-    Quaternion Power(const float& exponent) const;
+    Quat Power(const T& exponent) const;
 
     /**
      * @brief Performs a permutation operation using a 3D vector (custom transform).
      * @param permutation A vector used for permuting the quaternion's components.
      * @return The permuted quaternion.
      */
-    Quaternion Permutate(const Vector3D& permutation) const;
+    Quat Permutate(const Vector3<T>& permutation) const;
 
     /**
      * @brief Returns a quaternion where each component is the absolute value of the original.
      * @return A quaternion with absolute-valued components.
      */
-    Quaternion Absolute() const;
+    Quat Absolute() const;
 
     /**
      * @brief Negates each component (an additive inverse).
      * @return A quaternion representing -this.
      */
-    Quaternion AdditiveInverse() const;
+    Quat AdditiveInverse() const;
 
     /**
      * @brief Returns the multiplicative inverse of this quaternion, such that q * q^-1 = identity.
      * @return The multiplicative inverse.
      */
-    Quaternion MultiplicativeInverse() const;
+    Quat MultiplicativeInverse() const;
 
     /**
      * @brief Returns the conjugate of this quaternion (W stays the same, X/Y/Z get negated).
      * @return The conjugated quaternion.
      */
-    Quaternion Conjugate() const;
+    Quat Conjugate() const;
 
     /**
      * @brief Returns a unit quaternion (normalized) version of this quaternion.
      * @return A normalized quaternion.
      */
-    Quaternion UnitQuaternion() const;
+    Quat UnitQuaternion() const;
 
     /**
      * @brief Computes the magnitude (length) of this quaternion.
      * @return The magnitude (sqrt(W^2 + X^2 + Y^2 + Z^2)).
      */
-    float Magnitude() const;
+    T Magnitude() const;
 
     /**
      * @brief Computes the dot product between this quaternion and another.
      * @param q Another quaternion.
      * @return The dot product (W*W' + X*X' + Y*Y' + Z*Z').
      */
-    float DotProduct(const Quaternion& q) const;
+    T DotProduct(const Quat& q) const;
 
     /**
      * @brief Computes the quaternion's norm (equivalent to squared magnitude).
      * @return (W^2 + X^2 + Y^2 + Z^2).
      */
-    float Normal() const;
+    T Normal() const;
 
     /**
      * @brief Checks if any component of this quaternion is NaN.
@@ -304,7 +319,7 @@ public:
      * @param quaternion The quaternion to compare to.
      * @return \c true if all components match exactly.
      */
-    bool IsEqual(const Quaternion& quaternion) const;
+    bool IsEqual(const Quat& quaternion) const;
 
     /**
      * @brief Checks if two quaternions are nearly equal within a tolerance.
@@ -312,7 +327,7 @@ public:
      * @param epsilon The tolerance for comparison.
      * @return \c true if each component differs by less than \p epsilon.
      */
-    bool IsClose(const Quaternion& quaternion, const float& epsilon) const;
+    bool IsClose(const Quat& quaternion, const T& epsilon) const;
 
     /**
      * @brief Converts this quaternion to a string representation (e.g. "(W, X, Y, Z)").
@@ -327,56 +342,56 @@ public:
      * @param quaternion The quaternion to compare.
      * @return \c true if equal, otherwise \c false.
      */
-    bool operator ==(const Quaternion& quaternion) const;
+    bool operator ==(const Quat& quaternion) const;
 
     /**
      * @brief Inequality operator. Checks if two quaternions differ in any component.
      * @param quaternion The quaternion to compare.
      * @return \c true if not equal, otherwise \c false.
      */
-    bool operator !=(const Quaternion& quaternion) const;
+    bool operator !=(const Quat& quaternion) const;
 
     /**
      * @brief Assignment operator. Copies another quaternion's components to this one.
      * @param quaternion The quaternion to copy.
      * @return A reference to this quaternion.
      */
-    Quaternion operator =(const Quaternion& quaternion);
+    Quat operator =(const Quat& quaternion);
 
     /**
      * @brief Adds two quaternions (component-wise).
      * @param quaternion The right-hand side quaternion to add.
      * @return A new quaternion representing the sum.
      */
-    Quaternion operator +(const Quaternion& quaternion) const;
+    Quat operator +(const Quat& quaternion) const;
 
     /**
      * @brief Subtracts one quaternion from another (component-wise).
      * @param quaternion The right-hand side quaternion to subtract.
      * @return A new quaternion representing the difference.
      */
-    Quaternion operator -(const Quaternion& quaternion) const;
+    Quat operator -(const Quat& quaternion) const;
 
     /**
      * @brief Multiplies (composes) two quaternions.
      * @param quaternion The right-hand side quaternion.
      * @return A new quaternion representing the multiplication result.
      */
-    Quaternion operator *(const Quaternion& quaternion) const;
+    Quat operator *(const Quat& quaternion) const;
 
     /**
      * @brief Divides this quaternion by another quaternion, component-wise.
      * @param quaternion The right-hand side quaternion divisor.
      * @return A new quaternion after division.
      */
-    Quaternion operator /(const Quaternion& quaternion) const;
+    Quat operator /(const Quat& quaternion) const;
 
     /**
      * @brief Divides this quaternion by a scalar.
      * @param value The scalar divisor.
      * @return A new quaternion scaled by 1.0 / \p value.
      */
-    Quaternion operator /(const float& value) const;
+    Quat operator /(const T& value) const;
 
     /**
      * @brief Scalar multiplication operator (on the left).
@@ -384,7 +399,9 @@ public:
      * @param q The quaternion to scale.
      * @return A new quaternion scaled by \p scalar.
      */
-    friend Quaternion operator *(const float& scalar, const Quaternion& q);
+    friend Quat operator *(const T& scalar, const Quat& q) {
+        return q.Multiply(scalar);
+    }
 
     /**
      * @brief Scalar multiplication operator (on the right).
@@ -392,7 +409,9 @@ public:
      * @param scalar The scalar to multiply.
      * @return A new quaternion scaled by \p scalar.
      */
-    friend Quaternion operator *(const Quaternion& q, const float& scalar);
+    friend Quat operator *(const Quat& q, const T& scalar) {
+        return q.Multiply(scalar);
+    }
 
     // --- Static Utility Functions ---
 
@@ -402,7 +421,7 @@ public:
      * @param q2 The second quaternion.
      * @return A new quaternion representing the sum.
      */
-    static Quaternion Add(const Quaternion& q1, const Quaternion& q2);
+    static Quat Add(const Quat& q1, const Quat& q2);
 
     /**
      * @brief Static convenience function: Subtracts one quaternion from another.
@@ -410,7 +429,7 @@ public:
      * @param q2 The second quaternion to subtract from \p q1.
      * @return A new quaternion representing the difference.
      */
-    static Quaternion Subtract(const Quaternion& q1, const Quaternion& q2);
+    static Quat Subtract(const Quat& q1, const Quat& q2);
 
     /**
      * @brief Static convenience function: Multiplies (composes) two quaternions.
@@ -418,7 +437,7 @@ public:
      * @param q2 The second quaternion.
      * @return The resulting quaternion composition.
      */
-    static Quaternion Multiply(const Quaternion& q1, const Quaternion& q2);
+    static Quat Multiply(const Quat& q1, const Quat& q2);
 
     /**
      * @brief Static convenience function: Divides one quaternion by another (component-wise).
@@ -426,7 +445,7 @@ public:
      * @param q2 The second quaternion (divisor).
      * @return A new quaternion representing the division result.
      */
-    static Quaternion Divide(const Quaternion& q1, const Quaternion& q2);
+    static Quat Divide(const Quat& q1, const Quat& q2);
 
     /**
      * @brief Static convenience function: Raises one quaternion to the power of another (component-wise).
@@ -434,7 +453,7 @@ public:
      * @param q2 The exponent quaternion.
      * @return A new quaternion representing the power result.
      */
-    static Quaternion Power(const Quaternion& q1, const Quaternion& q2);
+    static Quat Power(const Quat& q1, const Quat& q2);
 
     /**
      * @brief Static convenience function: Computes the dot product of two quaternions.
@@ -442,7 +461,7 @@ public:
      * @param q2 The second quaternion.
      * @return The scalar dot product.
      */
-    static float DotProduct(const Quaternion& q1, const Quaternion& q2);
+    static T DotProduct(const Quat& q1, const Quat& q2);
 
     /**
      * @brief Static convenience function: Raises a quaternion to a scalar power.
@@ -450,7 +469,7 @@ public:
      * @param exponent The scalar exponent.
      * @return A new quaternion representing the power result.
      */
-    static Quaternion Power(const Quaternion& quaternion, const float& exponent);
+    static Quat Power(const Quat& quaternion, const T& exponent);
 
     /**
      * @brief Static convenience function: Permutates a quaternion with a 3D vector input.
@@ -458,54 +477,65 @@ public:
      * @param vector A 3D vector used for permutation.
      * @return The permuted quaternion.
      */
-    static Quaternion Permutate(const Quaternion& quaternion, const Vector3D& vector);
+    static Quat Permutate(const Quat& quaternion, const Vector3<T>& vector);
 
     /**
      * @brief Static convenience function: Returns a quaternion with absolute values of its components.
      * @param quaternion The input quaternion.
      * @return A quaternion whose components are the absolute values of \p quaternion's components.
      */
-    static Quaternion Absolute(const Quaternion& quaternion);
+    static Quat Absolute(const Quat& quaternion);
 
     /**
      * @brief Static convenience function: Returns the additive inverse of a quaternion.
      * @param quaternion The input quaternion.
      * @return A quaternion representing -q.
      */
-    static Quaternion AdditiveInverse(const Quaternion& quaternion);
+    static Quat AdditiveInverse(const Quat& quaternion);
 
     /**
      * @brief Static convenience function: Returns the multiplicative inverse of a quaternion.
      * @param quaternion The input quaternion.
      * @return A quaternion such that q * q^-1 = identity.
      */
-    static Quaternion MultiplicativeInverse(const Quaternion& quaternion);
+    static Quat MultiplicativeInverse(const Quat& quaternion);
 
     /**
      * @brief Static convenience function: Returns the conjugate of a quaternion.
      * @param quaternion The input quaternion.
      * @return A quaternion with (W, -X, -Y, -Z).
      */
-    static Quaternion Conjugate(const Quaternion& quaternion);
+    static Quat Conjugate(const Quat& quaternion);
 
     /**
      * @brief Static convenience function: Normalizes a quaternion, returning a unit quaternion.
      * @param quaternion The input quaternion.
      * @return A normalized quaternion.
      */
-    static Quaternion UnitQuaternion(const Quaternion& quaternion);
+    static Quat UnitQuaternion(const Quat& quaternion);
 
     /**
      * @brief Static convenience function: Computes the magnitude of a quaternion.
      * @param quaternion The input quaternion.
      * @return The magnitude (length) of \p quaternion.
      */
-    static float Magnitude(const Quaternion& quaternion);
+    static T Magnitude(const Quat& quaternion);
 
     /**
      * @brief Static convenience function: Computes the norm (squared magnitude) of a quaternion.
      * @param quaternion The input quaternion.
      * @return The squared length of \p quaternion.
      */
-    static float Normal(const Quaternion& quaternion);
+    static T Normal(const Quat& quaternion);
 };
+
+#include "quaternion.tpp" // Include the template implementation.
+
+#ifdef _ARM_MATH_H
+template<>
+Quat<float> Quat<float>::Multiply(const Quat<float>& quaternion) const;
+#endif
+
+extern template class Quat<float>;
+
+using Quaternion = Quat<float>; ///< Single precision quaternion, the type used throughout the library.
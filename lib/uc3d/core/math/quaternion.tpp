@@ -0,0 +1,532 @@
+#pragma once
+
+// Default constructor
+template<typename T>
+Quat<T>::Quat() : W(1), X(0), Y(0), Z(0) {}
+
+// Copy constructor
+template<typename T>
+Quat<T>::Quat(const Quat<T>& quaternion) {
+    this->W = quaternion.W;
+    this->X = quaternion.X;
+    this->Y = quaternion.Y;
+    this->Z = quaternion.Z;
+}
+
+// Constructor from Vector3<T>
+template<typename T>
+Quat<T>::Quat(const Vector3<T>& vector) {
+    this->W = 0;
+    this->X = vector.X;
+    this->Y = vector.Y;
+    this->Z = vector.Z;
+}
+
+// Constructor with individual components
+template<typename T>
+Quat<T>::Quat(const T& w, const T& x, const T& y, const T& z) {
+    this->W = w;
+    this->X = x;
+    this->Y = y;
+    this->Z = z;
+}
+
+// Rotate vector
+template<typename T>
+Vector2<T> Quat<T>::RotateVector(const Vector2<T>& v) const {
+    if (IsClose(Quat<T>(), ScalarMath<T>::Epsilon())) return v;
+		
+    Quat<T> q = UnitQuaternion();
+
+    T s2 = q.W * T(2);
+    T dPUV = (q.X * v.X + q.Y * v.Y) * T(2);
+    T dPUU = q.W * q.W - (q.X * q.X + q.Y * q.Y + q.Z * q.Z);
+
+    return Vector2<T>{
+        X * dPUV + v.X * dPUU + (-(q.Z * v.Y)) * s2,
+        Y * dPUV + v.Y * dPUU + ((q.Z * v.X)) * s2
+    };
+}
+
+// Rotate vector with a unit quaternion
+template<typename T>
+Vector2<T> Quat<T>::RotateVectorUnit(const Vector2<T>& v, const Quat<T>& q) const {
+    if (IsClose(Quat<T>(), ScalarMath<T>::Epsilon())) return v;
+
+    T s2 = q.W * T(2);
+    T dPUV = (q.X * v.X + q.Y * v.Y) * T(2);
+    T dPUU = q.W * q.W - (q.X * q.X + q.Y * q.Y + q.Z * q.Z);
+
+    return Vector2<T>{
+        X * dPUV + v.X * dPUU + (-(q.Z * v.Y)) * s2,
+        Y * dPUV + v.Y * dPUU + ((q.Z * v.X)) * s2
+    };
+}
+
+// Unrotate vector
+template<typename T>
+Vector2<T> Quat<T>::UnrotateVector(const Vector2<T>& coordinate) const {
+    if (IsClose(Quat<T>(), ScalarMath<T>::Epsilon())) return coordinate;
+
+    return Conjugate().RotateVector(coordinate);
+}
+
+// Rotate vector
+template<typename T>
+Vector3<T> Quat<T>::RotateVector(const Vector3<T>& v) const {
+    if (IsClose(Quat<T>(), ScalarMath<T>::Epsilon())) return v;
+	
+    Quat<T> qV = Quat<T>(T(0), v.X, v.Y, v.Z);
+    Quat<T> q = UnitQuaternion();
+    Quat<T> qConj = q.Conjugate();
+    Quat<T> rotated = q * qV * qConj;
+
+    return Vector3<T>(rotated.X, rotated.Y, rotated.Z);
+}
+
+// Unrotate vector
+template<typename T>
+Vector3<T> Quat<T>::UnrotateVector(const Vector3<T>& coordinate) const {
+    if (IsClose(Quat<T>(), ScalarMath<T>::Epsilon())) return coordinate;
+
+    return UnitQuaternion().Conjugate().RotateVector(coordinate);
+}
+
+// Get Bivector
+template<typename T>
+Vector3<T> Quat<T>::GetBiVector() const {
+    return Vector3<T>{
+        this->X,
+        this->Y,
+        this->Z
+    };
+}
+
+template<typename T>
+Vector3<T> Quat<T>::GetNormal() const {
+    return this->RotateVector(Vector3<T>(0, 0, T(1)));
+}
+
+// Spherical interpolation
+template<typename T>
+Quat<T> Quat<T>::SphericalInterpolation(const Quat<T>& q1, const Quat<T>& q2, const T& ratio) {
+    if (ratio <= ScalarMath<T>::Epsilon()) return q1;
+    if (ratio >= T(1) - ScalarMath<T>::Epsilon()) return q2; 
+
+    Quat<T> q1U = q1;
+    Quat<T> q2U = q2;
+
+    q1U = q1U.UnitQuaternion();
+    q2U = q2U.UnitQuaternion();
+
+    T dot = q1U.DotProduct(q2U);//Cosine between the two quaternions
+
+    if (dot < T(0)){//Shortest path correction
+        q1U = q1U.AdditiveInverse();
+        dot = -dot;
+    }
+
+    if (dot > T(0.999f)){//Linearly interpolates if results are close
+        return (q1U.Add( (q2U.Subtract(q1U)).Multiply(ratio) )).UnitQuaternion();
+    }
+    else
+    {
+        dot = Mathematics::Constrain<T>(dot, T(-1), T(1));
+
+        T theta0 = ScalarMath<T>::Acos(dot);
+        T theta = theta0 * ratio;
+
+        //Quat<T> q3 = (q2.Subtract(q1.Multiply(dot))).UnitQuaternion();//UQ for orthonomal 
+        T f1 = ScalarMath<T>::Cos(theta) - dot * ScalarMath<T>::Sin(theta) / ScalarMath<T>::Sin(theta0);
+        T f2 = ScalarMath<T>::Sin(theta) / ScalarMath<T>::Sin(theta0);
+
+        return q1U.Multiply(f1).Add(q2U.Multiply(f2)).UnitQuaternion();
+    }
+}
+
+// Delta rotation
+template<typename T>
+Quat<T> Quat<T>::DeltaRotation(const Vector3<T>& angularVelocity, const T& timeDelta) const {
+    Quat<T> current = Quat<T>(this->W, this->X, this->Y, this->Z);
+    Vector3<T> angularVelocityL = angularVelocity;
+    Vector3<T> halfAngle = angularVelocityL * (timeDelta / T(2));
+    T halfAngleLength = halfAngle.Magnitude();
+
+    if(halfAngleLength > ScalarMath<T>::Epsilon()){//exponential map
+        halfAngle = halfAngle * (ScalarMath<T>::Sin(halfAngleLength) / halfAngleLength);
+        return (current * Quat<T>(ScalarMath<T>::Cos(halfAngleLength), halfAngle.X, halfAngle.Y, halfAngle.Z)).UnitQuaternion();
+    }
+    else{//first taylor series
+        return (current * Quat<T>(T(1), halfAngle.X, halfAngle.Y, halfAngle.Z)).UnitQuaternion();
+    }
+}
+
+// Add quaternion
+template<typename T>
+Quat<T> Quat<T>::Add(const Quat<T>& quaternion) const {
+    return Quat<T> {
+        W + quaternion.W,
+        X + quaternion.X,
+        Y + quaternion.Y,
+        Z + quaternion.Z
+    };
+}
+
+// Subtract quaternion
+template<typename T>
+Quat<T> Quat<T>::Subtract(const Quat<T>& quaternion) const {
+    return Quat<T>{
+        W - quaternion.W,
+        X - quaternion.X,
+        Y - quaternion.Y,
+        Z - quaternion.Z
+    };
+}
+
+// Multiply quaternion
+template<typename T>
+Quat<T> Quat<T>::Multiply(const Quat<T>& quaternion) const {
+    if(quaternion.IsClose(Quat<T>(), ScalarMath<T>::Epsilon())) return Quat<T>(W, X, Y, Z);
+    
+    return Quat<T>{
+        W * quaternion.W - X * quaternion.X - Y * quaternion.Y - Z * quaternion.Z,
+        W * quaternion.X + X * quaternion.W + Y * quaternion.Z - Z * quaternion.Y,
+        W * quaternion.Y - X * quaternion.Z + Y * quaternion.W + Z * quaternion.X,
+        W * quaternion.Z + X * quaternion.Y - Y * quaternion.X + Z * quaternion.W
+    };
+}
+
+// Multiply with scalar
+template<typename T>
+Quat<T> Quat<T>::Multiply(const T& scalar) const {
+    if (ScalarMath<T>::IsClose(scalar, T(0), ScalarMath<T>::Epsilon())) return Quat<T>();
+    if (ScalarMath<T>::IsClose(scalar, T(1), ScalarMath<T>::Epsilon())) return Quat<T>(W, X, Y, Z);
+
+    return Quat<T>{
+        W * scalar,
+        X * scalar,
+        Y * scalar,
+        Z * scalar
+    };
+}
+
+// Divide quaternion
+template<typename T>
+Quat<T> Quat<T>::Divide(const Quat<T>& quaternion) const {
+    if(quaternion.IsClose(Quat<T>(), ScalarMath<T>::Epsilon())) return Quat<T>(W, X, Y, Z);
+
+    return Quat<T>(
+        (W * quaternion.W - X * quaternion.X - Y * quaternion.Y - Z * quaternion.Z),
+        (W * quaternion.X + X * quaternion.W + Y * quaternion.Z - Z * quaternion.Y),
+        (W * quaternion.Y - X * quaternion.Z + Y * quaternion.W + Z * quaternion.X),
+        (W * quaternion.Z + X * quaternion.Y - Y * quaternion.X + Z * quaternion.W)
+    );
+}
+
+// Divide by scalar
+template<typename T>
+Quat<T> Quat<T>::Divide(const T& scalar) const {
+    if (ScalarMath<T>::IsClose(scalar, T(0), ScalarMath<T>::Epsilon())) return Quat<T>();
+    if (ScalarMath<T>::IsClose(scalar, T(1), ScalarMath<T>::Epsilon())) return Quat<T>(W, X, Y, Z);
+    
+    T invert = T(1) / scalar;
+
+    return Quat<T>
+    {
+        W * invert,
+        X * invert,
+        Y * invert,
+        Z * invert
+    };
+}
+
+// Power of quaternion
+template<typename T>
+Quat<T> Quat<T>::Power(const Quat<T>& exponent) const {
+    return Quat<T> {
+        ScalarMath<T>::Pow(W, exponent.W),
+        ScalarMath<T>::Pow(X, exponent.X),
+        ScalarMath<T>::Pow(Y, exponent.Y),
+        ScalarMath<T>::Pow(Z, exponent.Z)
+    };
+}
+
+// Power with scalar exponent
+template<typename T>
+Quat<T> Quat<T>::Power(const T& exponent) const {
+    return Quat<T> {
+        ScalarMath<T>::Pow(W, exponent),
+        ScalarMath<T>::Pow(X, exponent),
+        ScalarMath<T>::Pow(Y, exponent),
+        ScalarMath<T>::Pow(Z, exponent)
+    };
+}
+
+// Permutate quaternion
+template<typename T>
+Quat<T> Quat<T>::Permutate(const Vector3<T>& permutation) const {
+    Quat<T> q = Quat<T>(this->W, this->X, this->Y, this->Z);
+    T perm[3];
+
+    perm[int(ScalarMath<T>::ToFloat(permutation.X))] = q.X;
+    perm[int(ScalarMath<T>::ToFloat(permutation.Y))] = q.Y;
+    perm[int(ScalarMath<T>::ToFloat(permutation.Z))] = q.Z;
+
+    q.X = perm[0];
+    q.Y = perm[1];
+    q.Z = perm[2];
+
+    return q;
+}
+
+// Absolute value of quaternion
+template<typename T>
+Quat<T> Quat<T>::Absolute() const {
+    return Quat<T> {
+        ScalarMath<T>::Abs(W),
+        ScalarMath<T>::Abs(X),
+        ScalarMath<T>::Abs(Y),
+        ScalarMath<T>::Abs(Z)
+    };
+}
+
+// Additive inverse of quaternion
+template<typename T>
+Quat<T> Quat<T>::AdditiveInverse() const {
+    return Quat<T> {
+        -W,
+        -X,
+        -Y,
+        -Z
+    };
+}
+
+// Multiplicative inverse of quaternion
+template<typename T>
+Quat<T> Quat<T>::MultiplicativeInverse() const {
+    T invNorm = T(1) / Normal();
+
+    if(ScalarMath<T>::IsClose(invNorm, T(0), ScalarMath<T>::Epsilon())) return Quat<T>();
+    if(ScalarMath<T>::IsClose(invNorm, T(1), ScalarMath<T>::Epsilon())) return *this;
+
+    return Conjugate().Multiply(invNorm);
+}
+
+// Conjugate of quaternion
+template<typename T>
+Quat<T> Quat<T>::Conjugate() const {
+    return Quat<T> {
+         W,
+        -X,
+        -Y,
+        -Z
+    };
+}
+
+// Normalize quaternion to unit quaternion
+template<typename T>
+Quat<T> Quat<T>::UnitQuaternion() const {
+    T n = T(1) / Normal();
+
+    return Quat<T>{
+        W * n,
+        X * n,
+        Y * n,
+        Z * n
+    };
+}
+
+// Magnitude of quaternion
+template<typename T>
+T Quat<T>::Magnitude() const {
+    return ScalarMath<T>::Sqrt(Normal());
+}
+
+// Dot product of two quaternions
+template<typename T>
+T Quat<T>::DotProduct(const Quat<T>& q) const {
+    return (W * q.W) + (X * q.X) + (Y * q.Y) + (Z * q.Z);
+}
+
+// Norm of quaternion
+template<typename T>
+T Quat<T>::Normal() const {
+    return ScalarMath<T>::Sqrt(W * W + X * X + Y * Y + Z * Z);
+}
+
+// Check if quaternion is NaN
+template<typename T>
+bool Quat<T>::IsNaN() const {
+    return ScalarMath<T>::IsNaN(W) || ScalarMath<T>::IsNaN(X) || ScalarMath<T>::IsNaN(Y) || ScalarMath<T>::IsNaN(Z);
+}
+
+// Check if quaternion is finite
+template<typename T>
+bool Quat<T>::IsFinite() const {
+	return ScalarMath<T>::IsInfinite(W) || ScalarMath<T>::IsInfinite(X) || ScalarMath<T>::IsInfinite(Y) || ScalarMath<T>::IsInfinite(Z);
+}
+
+// Check if quaternion is infinite
+template<typename T>
+bool Quat<T>::IsInfinite() const {
+	return ScalarMath<T>::IsFinite(W) || ScalarMath<T>::IsFinite(X) || ScalarMath<T>::IsFinite(Y) || ScalarMath<T>::IsFinite(Z);
+}
+
+// Check if quaternion is non-zero
+template<typename T>
+bool Quat<T>::IsNonZero() const {
+    return W != 0 && X != 0 && Y != 0 && Z != 0;
+}
+
+// Check if two quaternions are equal
+template<typename T>
+bool Quat<T>::IsEqual(const Quat<T>& quaternion) const {
+    return !IsNaN() && !quaternion.IsNaN() &&
+        W == quaternion.W &&
+        X == quaternion.X &&
+        Y == quaternion.Y &&
+        Z == quaternion.Z;
+}
+
+// Check if two quaternions are close within an epsilon
+template<typename T>
+bool Quat<T>::IsClose(const Quat<T>& quaternion, const T& epsilon) const {
+    return ScalarMath<T>::Abs(W - quaternion.W) < epsilon &&
+        ScalarMath<T>::Abs(X - quaternion.X) < epsilon &&
+        ScalarMath<T>::Abs(Y - quaternion.Y) < epsilon &&
+        ScalarMath<T>::Abs(Z - quaternion.Z) < epsilon;
+}
+
+// Convert quaternion to string
+template<typename T>
+uc3d::UString Quat<T>::ToString() const {
+    uc3d::UString w = Mathematics::DoubleToCleanString(ScalarMath<T>::ToFloat(this->W));
+    uc3d::UString x = Mathematics::DoubleToCleanString(ScalarMath<T>::ToFloat(this->X));
+    uc3d::UString y = Mathematics::DoubleToCleanString(ScalarMath<T>::ToFloat(this->Y));
+    uc3d::UString z = Mathematics::DoubleToCleanString(ScalarMath<T>::ToFloat(this->Z));
+    
+    return "[" + w + ", " + x + ", " + y + ", " + z + "]";
+}
+
+// Operator overloads
+template<typename T>
+bool Quat<T>::operator ==(const Quat<T>& quaternion) const {
+    return this->IsEqual(quaternion);
+}
+
+template<typename T>
+bool Quat<T>::operator !=(const Quat<T>& quaternion) const {
+    return !(this->IsEqual(quaternion));
+}
+
+template<typename T>
+Quat<T> Quat<T>::operator =(const Quat<T>& quaternion) {
+    this->W = quaternion.W;
+    this->X = quaternion.X;
+    this->Y = quaternion.Y;
+    this->Z = quaternion.Z;
+    
+    return quaternion;
+}
+
+template<typename T>
+Quat<T> Quat<T>::operator +(const Quat<T>& quaternion) const {
+    return Add(quaternion);
+}
+
+template<typename T>
+Quat<T> Quat<T>::operator -(const Quat<T>& quaternion) const {
+    return Subtract(quaternion);
+}
+
+template<typename T>
+Quat<T> Quat<T>::operator *(const Quat<T>& quaternion) const {
+    return Multiply(quaternion);
+}
+
+template<typename T>
+Quat<T> Quat<T>::operator /(const Quat<T>& quaternion) const {
+    return Divide(quaternion);
+}
+
+template<typename T>
+Quat<T> Quat<T>::operator /(const T& scalar) const {
+    return Divide(scalar);
+}
+
+// Static function definitions
+
+template<typename T>
+Quat<T> Quat<T>::Add(const Quat<T>& q1, const Quat<T>& q2) {
+    return q1.Add(q2);
+}
+
+template<typename T>
+Quat<T> Quat<T>::Subtract(const Quat<T>& q1, const Quat<T>& q2) {
+    return q1.Subtract(q2);
+}
+
+template<typename T>
+Quat<T> Quat<T>::Multiply(const Quat<T>& q1, const Quat<T>& q2) {
+    return q1.Multiply(q2);
+}
+
+template<typename T>
+Quat<T> Quat<T>::Divide(const Quat<T>& q1, const Quat<T>& q2) {
+    return q1.Divide(q2);
+}
+
+template<typename T>
+Quat<T> Quat<T>::Power(const Quat<T>& q1, const Quat<T>& q2) {
+    return q1.Power(q2);
+}
+
+template<typename T>
+T Quat<T>::DotProduct(const Quat<T>& q1, const Quat<T>& q2) {
+    return q1.DotProduct(q2);
+}
+
+template<typename T>
+Quat<T> Quat<T>::Power(const Quat<T>& quaternion, const T& exponent) {
+    return quaternion.Power(exponent);
+}
+
+template<typename T>
+Quat<T> Quat<T>::Permutate(const Quat<T>& quaternion, const Vector3<T>& vector) {
+    return quaternion.Permutate(vector);
+}
+
+template<typename T>
+Quat<T> Quat<T>::Absolute(const Quat<T>& quaternion) {
+    return quaternion.Absolute();
+}
+
+template<typename T>
+Quat<T> Quat<T>::AdditiveInverse(const Quat<T>& quaternion) {
+    return quaternion.AdditiveInverse();
+}
+
+template<typename T>
+Quat<T> Quat<T>::MultiplicativeInverse(const Quat<T>& quaternion) {
+    return quaternion.MultiplicativeInverse();
+}
+
+template<typename T>
+Quat<T> Quat<T>::Conjugate(const Quat<T>& quaternion) {
+    return quaternion.Conjugate();
+}
+
+template<typename T>
+Quat<T> Quat<T>::UnitQuaternion(const Quat<T>& quaternion) {
+    return quaternion.UnitQuaternion();
+}
+
+template<typename T>
+T Quat<T>::Magnitude(const Quat<T>& quaternion) {
+    return quaternion.Magnitude();
+}
+
+template<typename T>
+T Quat<T>::Normal(const Quat<T>& quaternion) {
+    return quaternion.Normal();
+}
@@ -0,0 +1,93 @@
+/**
+ * @file ScalarMath.h
+ * @brief Defines the ScalarMath class template giving vector types the functions of their scalar type.
+ *
+ * Vector2, Vector3 and Quat are written against a scalar type T. Arithmetic operators come from T
+ * itself, ScalarMath supplies the rest: roots, absolute values, trigonometry and comparisons with
+ * a tolerance, each in the precision the scalar type can hold.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <cmath>
+#include "fixedpoint.hpp"
+#include "mathematics.hpp"
+
+/**
+ * @class ScalarMath
+ * @brief Static functions on a scalar type, computed in float.
+ *
+ * The general version converts to float and back, which is exact for float and suits half
+ * floats such as `_Float16` or `__fp16` where the compiler provides them. Double and the
+ * FixedPoint formats are specialized below.
+ *
+ * @tparam T The scalar type.
+ */
+template<typename T>
+class ScalarMath {
+public:
+    static float ToFloat(const T& value) { return float(value); }
+    static T Epsilon() { return T(Mathematics::EPSILON); }
+    static T Abs(const T& value) { return T(fabsf(float(value))); }
+    static T Sqrt(const T& value) { return T(Mathematics::Sqrt(float(value))); }
+    static T Pow(const T& value, const T& exponent) { return T(Mathematics::Pow(float(value), float(exponent))); }
+    static T Sin(const T& value) { return T(sinf(float(value))); }
+    static T Cos(const T& value) { return T(cosf(float(value))); }
+    static T Acos(const T& value) { return T(acosf(float(value))); }
+    static bool IsClose(const T& v1, const T& v2, const T& epsilon) { return Abs(v1 - v2) < epsilon; }
+    static bool IsNaN(const T& value) { return Mathematics::IsNaN(float(value)); }
+    static bool IsInfinite(const T& value) { return Mathematics::IsInfinite(float(value)); }
+    static bool IsFinite(const T& value) { return Mathematics::IsFinite(float(value)); }
+};
+
+/**
+ * @brief Double keeps its precision, for computations done offline or on a host.
+ */
+template<>
+class ScalarMath<double> {
+public:
+    static float ToFloat(const double& value) { return float(value); }
+    static double Epsilon() { return double(Mathematics::EPSILON); }
+    static double Abs(const double& value) { return std::fabs(value); }
+    static double Sqrt(const double& value) { return std::sqrt(value); }
+    static double Pow(const double& value, const double& exponent) { return std::pow(value, exponent); }
+    static double Sin(const double& value) { return std::sin(value); }
+    static double Cos(const double& value) { return std::cos(value); }
+    static double Acos(const double& value) { return std::acos(value); }
+    static bool IsClose(const double& v1, const double& v2, const double& epsilon) { return std::fabs(v1 - v2) < epsilon; }
+    static bool IsNaN(const double& value) { return value != value; }
+    static bool IsInfinite(const double& value) { return std::isinf(value); }
+    static bool IsFinite(const double& value) { return std::isfinite(value); }
+};
+
+/**
+ * @brief Fixed-point values take roots and absolute values on the integers.
+ *
+ * Trigonometry still goes through float, it is only used to build rotations and not per pixel.
+ * The tolerance is at least one step of the format, so comparisons stay meaningful in Q8.8.
+ * Fixed-point values are never NaN or infinite, they saturate instead.
+ */
+template<typename Storage, typename Wide, uint8_t FractionBits>
+class ScalarMath<FixedPoint<Storage, Wide, FractionBits>> {
+public:
+    using Fixed = FixedPoint<Storage, Wide, FractionBits>; ///< The fixed-point type.
+
+    static float ToFloat(const Fixed& value) { return value.ToFloat(); }
+    static Fixed Epsilon();
+    static Fixed Abs(const Fixed& value) { return value.GetRaw() < 0 ? -value : value; }
+    static Fixed Sqrt(const Fixed& value);
+    static Fixed Pow(const Fixed& value, const Fixed& exponent) { return Fixed(Mathematics::Pow(value.ToFloat(), exponent.ToFloat())); }
+    static Fixed Sin(const Fixed& value) { return Fixed(sinf(value.ToFloat())); }
+    static Fixed Cos(const Fixed& value) { return Fixed(cosf(value.ToFloat())); }
+    static Fixed Acos(const Fixed& value) { return Fixed(acosf(value.ToFloat())); }
+    static bool IsClose(const Fixed& v1, const Fixed& v2, const Fixed& epsilon) { return Abs(v1 - v2) < epsilon; }
+    static bool IsNaN(const Fixed&) { return false; }
+    static bool IsInfinite(const Fixed&) { return false; }
+    static bool IsFinite(const Fixed&) { return true; }
+};
+
+#include "scalarmath.tpp" // Include the template implementation.
@@ -0,0 +1,33 @@
+#pragma once
+
+template<typename Storage, typename Wide, uint8_t FractionBits>
+FixedPoint<Storage, Wide, FractionBits> ScalarMath<FixedPoint<Storage, Wide, FractionBits>>::Epsilon() {
+    Fixed epsilon(Mathematics::EPSILON);
+
+    return epsilon.GetRaw() > 0 ? epsilon : Fixed::FromRaw(1);
+}
+
+template<typename Storage, typename Wide, uint8_t FractionBits>
+FixedPoint<Storage, Wide, FractionBits> ScalarMath<FixedPoint<Storage, Wide, FractionBits>>::Sqrt(const Fixed& value) {
+    if (value.GetRaw() <= 0) return Fixed();
+
+    // sqrt(raw / 2^F) * 2^F = sqrt(raw * 2^F), an integer root computed bit by bit
+    Wide remainder = Wide(value.GetRaw()) << FractionBits;
+    Wide root = 0;
+    Wide bit = Wide(1) << (sizeof(Wide) * 8 - 2);
+
+    while (bit > remainder) bit >>= 2;
+
+    while (bit != 0) {
+        if (remainder >= root + bit) {
+            remainder -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+
+        bit >>= 2;
+    }
+
+    return Fixed::FromRaw(Storage(root));
+}
@@ -41,8 +41,27 @@ Transform::Transform(const Transform& transform) {
     this->scaleOffset = transform.scaleOffset;
 }
 
+Transform& Transform::operator=(const Transform& transform) {
+    this->baseRotation = transform.baseRotation;
+    this->rotation = transform.rotation;
+    this->position = transform.position;
+    this->scale = transform.scale;
+    this->scaleRotationOffset = transform.scaleRotationOffset;
+    this->rotationOffset = transform.rotationOffset;
+    this->scaleOffset = transform.scaleOffset;
+
+    // Versions of different transforms are unrelated, advancing our own keeps caches keyed on this one honest
+    version++;
+
+    return *this;
+}
+
 void Transform::SetBaseRotation(const Quaternion& baseRotation) {
+    // Renderers reapply the camera layout rotation every frame, only a real change invalidates caches
+    if (this->baseRotation.IsEqual(baseRotation)) return;
+
     this->baseRotation = baseRotation;
+    version++;
 }
 
 Quaternion Transform::GetBaseRotation() const {
@@ -51,10 +70,12 @@ Quaternion Transform::GetBaseRotation() const {
 
 void Transform::SetRotation(const Quaternion& rotation) {
     this->rotation = rotation;
+    version++;
 }
 
 void Transform::SetRotation(const Vector3D& eulerXYZS) {
     this->rotation = Rotation(EulerAngles(eulerXYZS, EulerConstants::EulerOrderXYZS)).GetQuaternion();
+    version++;
 }
 
 Quaternion Transform::GetRotation() const {
@@ -63,6 +84,7 @@ Quaternion Transform::GetRotation() const {
 
 void Transform::SetPosition(const Vector3D& position) {
     this->position = position;
+    version++;
 }
 
 Vector3D Transform::GetPosition() const {
@@ -71,6 +93,7 @@ Vector3D Transform::GetPosition() const {
 
 void Transform::SetScale(const Vector3D& scale) {
     this->scale = scale;
+    version++;
 }
 
 Vector3D Transform::GetScale() const {
@@ -79,6 +102,7 @@ Vector3D Transform::GetScale() const {
 
 void Transform::SetScaleRotationOffset(const Quaternion& scaleRotationOffset) {
     this->scaleRotationOffset = scaleRotationOffset;
+    version++;
 }
 
 Quaternion Transform::GetScaleRotationOffset() const {
@@ -87,6 +111,7 @@ Quaternion Transform::GetScaleRotationOffset() const {
 
 void Transform::SetRotationOffset(const Vector3D& rotationOffset) {
     this->rotationOffset = rotationOffset;
+    version++;
 }
 
 Vector3D Transform::GetRotationOffset() const {
@@ -95,6 +120,7 @@ Vector3D Transform::GetRotationOffset() const {
 
 void Transform::SetScaleOffset(const Vector3D& scaleOffset) {
     this->scaleOffset = scaleOffset;
+    version++;
 }
 
 Vector3D Transform::GetScaleOffset() const {
@@ -103,18 +129,26 @@ Vector3D Transform::GetScaleOffset() const {
 
 void Transform::Rotate(const Vector3D& eulerXYZS) {
     this->rotation = this->rotation * Rotation(EulerAngles(eulerXYZS, EulerConstants::EulerOrderXYZS)).GetQuaternion();
+    version++;
 }
 
 void Transform::Rotate(const Quaternion& rotation) {
     this->rotation = this->rotation * rotation;
+    version++;
 }
 
 void Transform::Translate(const Vector3D& offset) {
     this->position = this->position + offset;
+    version++;
 }
 
 void Transform::Scale(const Vector3D& scale) {
     this->scale = this->scale * scale;
+    version++;
+}
+
+uint32_t Transform::GetVersion() const {
+    return version;
 }
 
 uc3d::UString Transform::ToString(){
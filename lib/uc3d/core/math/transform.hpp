@@ -31,6 +31,7 @@ private:
 
     Vector3D scaleOffset; ///< Offset applied to the scale.
     Vector3D rotationOffset; ///< Offset applied to the rotation.
+    uint32_t version = 0; ///< Incremented whenever a setter or mutator changes the transform.
 
 public:
     /**
@@ -75,11 +76,18 @@ public:
     Transform(const Quaternion& rotation, const Vector3D& position, const Vector3D& scale, const Vector3D& rotationOffset, const Vector3D& scaleOffset);
 
     /**
-     * @brief Copy constructor.
+     * @brief Copy constructor, the copy starts with a fresh version.
      * @param transform The transform to copy.
      */
     Transform(const Transform& transform);
 
+    /**
+     * @brief Copies the components of another transform and advances the version.
+     * @param transform The transform to copy.
+     * @return Reference to this transform.
+     */
+    Transform& operator=(const Transform& transform);
+
     /**
      * @brief Sets the base rotation of the object.
      * @param baseRotation The base rotation as a quaternion.
@@ -194,6 +202,16 @@ public:
      */
     void Scale(const Vector3D& scale);
 
+    /**
+     * @brief Retrieves the version counter of the transform.
+     *
+     * The counter changes whenever the transform may have changed, so caches derived
+     * from it can compare versions instead of every component.
+     *
+     * @return The current version.
+     */
+    uint32_t GetVersion() const;
+
     /**
      * @brief Converts the transform to a string representation.
      * @return A string representing the transform.
@@ -2,7 +2,7 @@
  * @file Vector2D.h
  * @brief Defines a 2D vector and various related operations.
  *
- * The `Vector2D` class provides a simple 2D vector representation along with
+ * The `Vector2` class template provides a simple 2D vector representation along with
  * utilities for common vector arithmetic, constraints, and geometric operations.
  *
  * @date 22/12/2024
@@ -13,92 +13,107 @@
 #pragma once
 
 #include "mathematics.hpp"
+#include "scalarmath.hpp"
 
 /**
- * @class Vector2D
+ * @class Vector2
  * @brief Represents a 2D vector (X, Y) and provides methods for vector arithmetic.
  *
- * The `Vector2D` class defines basic 2D vector operations such as addition, subtraction,
+ * The `Vector2` class template defines basic 2D vector operations such as addition, subtraction,
  * multiplication, division, dot product, cross product, and geometric queries. It also
- * includes static functions to perform operations on multiple `Vector2D` objects without
+ * includes static functions to perform operations on multiple `Vector2` objects without
  * requiring an instance.
+ *
+ * The scalar type T can be float, double, a half float or a FixedPoint format, `Vector2D` is the
+ * float version used throughout the library. Functions other than arithmetic, such as roots and
+ * trigonometry, come from ScalarMath<T>.
+ *
+ * @tparam T The scalar type of the components.
  */
-class Vector2D {
+template<typename T>
+class Vector2 {
 public:
-    float X; ///< The X-component of the 2D vector.
-    float Y; ///< The Y-component of the 2D vector.
+    T X; ///< The X-component of the 2D vector.
+    T Y; ///< The Y-component of the 2D vector.
+
+    /**
+     * @brief Constructs a default `Vector2` with X = 0 and Y = 0.
+     */
+    constexpr Vector2() : X(0), Y(0) {}
 
     /**
-     * @brief Constructs a default `Vector2D` with X = 0 and Y = 0.
+     * @brief Copy constructor. Initializes this vector with the same values as another `Vector2`.
+     * @param vector The `Vector2` to copy from.
      */
-    Vector2D();
+    constexpr Vector2(const Vector2& vector) : X(vector.X), Y(vector.Y) {}
 
     /**
-     * @brief Copy constructor. Initializes this vector with the same values as another `Vector2D`.
-     * @param vector The `Vector2D` to copy from.
+     * @brief Converts a vector of another scalar type, through float.
+     * @param vector The vector to convert.
      */
-    Vector2D(const Vector2D& vector);
+    template<typename U>
+    explicit Vector2(const Vector2<U>& vector) : X(T(ScalarMath<U>::ToFloat(vector.X))), Y(T(ScalarMath<U>::ToFloat(vector.Y))) {}
 
     /**
-     * @brief Constructs a `Vector2D` using specified float components.
+     * @brief Constructs a `Vector2` using specified scalar components.
      * @param X The X-component of the vector.
      * @param Y The Y-component of the vector.
      */
-    Vector2D(const float& X, const float& Y);
+    constexpr Vector2(const T& X, const T& Y) : X(X), Y(Y) {}
 
     /**
      * @brief Returns a vector with the absolute value of each component.
-     * @return A `Vector2D` where each component is `abs(X)` and `abs(Y)`.
+     * @return A `Vector2` where each component is `abs(X)` and `abs(Y)`.
      */
-    Vector2D Absolute() const;
+    Vector2 Absolute() const;
 
     /**
      * @brief Computes the squared magnitude of the vector (X^2 + Y^2).
-     * @return A `Vector2D` whose components are squared. (Typically used as an internal helper.)
+     * @return A `Vector2` whose components are squared. (Typically used as an internal helper.)
      */
-    Vector2D Normal() const;
+    Vector2 Normal() const;
 
     /**
-     * @brief Adds this vector to another `Vector2D` component-wise.
+     * @brief Adds this vector to another `Vector2` component-wise.
      * @param vector The vector to add.
-     * @return A new `Vector2D` representing the sum.
+     * @return A new `Vector2` representing the sum.
      */
-    Vector2D Add(const Vector2D& vector) const;
+    Vector2 Add(const Vector2& vector) const;
 
     /**
-     * @brief Subtracts another `Vector2D` from this vector component-wise.
+     * @brief Subtracts another `Vector2` from this vector component-wise.
      * @param vector The vector to subtract.
-     * @return A new `Vector2D` representing the difference.
+     * @return A new `Vector2` representing the difference.
      */
-    Vector2D Subtract(const Vector2D& vector) const;
+    Vector2 Subtract(const Vector2& vector) const;
 
     /**
-     * @brief Multiplies this vector by another `Vector2D` component-wise.
+     * @brief Multiplies this vector by another `Vector2` component-wise.
      * @param vector The vector to multiply by.
-     * @return A new `Vector2D` representing the product.
+     * @return A new `Vector2` representing the product.
      */
-    Vector2D Multiply(const Vector2D& vector) const;
+    Vector2 Multiply(const Vector2& vector) const;
 
     /**
-     * @brief Divides this vector by another `Vector2D` component-wise.
+     * @brief Divides this vector by another `Vector2` component-wise.
      * @param vector The vector to divide by.
-     * @return A new `Vector2D` representing the quotient.
+     * @return A new `Vector2` representing the quotient.
      */
-    Vector2D Divide(const Vector2D& vector) const;
+    Vector2 Divide(const Vector2& vector) const;
 
     /**
-     * @brief Scales this vector by a float.
+     * @brief Scales this vector by a scalar.
      * @param scalar The scalar value.
-     * @return A new `Vector2D` scaled by `scalar`.
+     * @return A new `Vector2` scaled by `scalar`.
      */
-    Vector2D Multiply(const float& scalar) const;
+    Vector2 Multiply(const T& scalar) const;
 
     /**
      * @brief Divides this vector by a scalar.
      * @param scalar The scalar divisor.
-     * @return A new `Vector2D` after division by `scalar`.
+     * @return A new `Vector2` after division by `scalar`.
      */
-    Vector2D Divide(const float& scalar) const;
+    Vector2 Divide(const T& scalar) const;
 
     /**
      * @brief Calculates the 2D cross product of this vector with another.
@@ -106,100 +121,100 @@ public:
      * For 2D vectors, the "cross product" reduces to a scalar, which is conceptually
      * the Z-component of the 3D cross product.
      *
-     * @param vector The other `Vector2D`.
+     * @param vector The other `Vector2`.
      * @return The scalar cross product result.
      */
-    float CrossProduct(const Vector2D& vector) const;
+    T CrossProduct(const Vector2& vector) const;
 
     /**
      * @brief Normalizes this vector such that its magnitude is 1 (if non-zero).
      * @return A unit circle vector pointing in the same direction.
      */
-    Vector2D UnitCircle() const;
+    Vector2 UnitCircle() const;
 
     /**
      * @brief Constrains each component of this vector between the specified minimum and maximum.
      * @param minimum The lower bound.
      * @param maximum The upper bound.
-     * @return A new `Vector2D` with each component constrained.
+     * @return A new `Vector2` with each component constrained.
      */
-    Vector2D Constrain(const float& minimum, const float& maximum) const;
+    Vector2 Constrain(const T& minimum, const T& maximum) const;
 
     /**
      * @brief Constrains each component of this vector between the corresponding components
-     *        of two other `Vector2D` objects.
+     *        of two other `Vector2` objects.
      * @param minimum The lower bound vector.
      * @param maximum The upper bound vector.
-     * @return A new `Vector2D` with each component constrained.
+     * @return A new `Vector2` with each component constrained.
      */
-    Vector2D Constrain(const Vector2D& minimum, const Vector2D& maximum) const;
+    Vector2 Constrain(const Vector2& minimum, const Vector2& maximum) const;
 
     /**
-     * @brief Computes the minimum components between this vector and another `Vector2D`.
-     * @param v The other `Vector2D`.
-     * @return A new `Vector2D` taking the minimum of X and Y components.
+     * @brief Computes the minimum components between this vector and another `Vector2`.
+     * @param v The other `Vector2`.
+     * @return A new `Vector2` taking the minimum of X and Y components.
      */
-    Vector2D Minimum(const Vector2D& v) const;
+    Vector2 Minimum(const Vector2& v) const;
 
     /**
-     * @brief Computes the maximum components between this vector and another `Vector2D`.
-     * @param v The other `Vector2D`.
-     * @return A new `Vector2D` taking the maximum of X and Y components.
+     * @brief Computes the maximum components between this vector and another `Vector2`.
+     * @param v The other `Vector2`.
+     * @return A new `Vector2` taking the maximum of X and Y components.
      */
-    Vector2D Maximum(const Vector2D& v) const;
+    Vector2 Maximum(const Vector2& v) const;
 
     /**
      * @brief Rotates this vector by a specified angle (in degrees or radians) around a given offset.
      * @param angle The angle of rotation.
      * @param offset The origin about which to rotate.
-     * @return A new `Vector2D` representing the rotated vector.
+     * @return A new `Vector2` representing the rotated vector.
      */
-    Vector2D Rotate(const float& angle, const Vector2D& offset) const;
+    Vector2 Rotate(const T& angle, const Vector2& offset) const;
 
     /**
-     * @brief Checks if this vector lies within the bounds of two other `Vector2D` objects.
-     * @param minimum The lower bound `Vector2D`.
-     * @param maximum The upper bound `Vector2D`.
+     * @brief Checks if this vector lies within the bounds of two other `Vector2` objects.
+     * @param minimum The lower bound `Vector2`.
+     * @param maximum The upper bound `Vector2`.
      * @return `true` if within bounds, otherwise `false`.
      */
-    bool CheckBounds(const Vector2D& minimum, const Vector2D& maximum) const;
+    bool CheckBounds(const Vector2& minimum, const Vector2& maximum) const;
 
     /**
      * @brief Computes the magnitude (length) of this vector using the formula sqrt(X^2 + Y^2).
      * @return The length of the vector.
      */
-    float Magnitude() const;
+    T Magnitude() const;
 
     /**
-     * @brief Computes the dot product of this vector with another `Vector2D`.
-     * @param vector The other `Vector2D`.
+     * @brief Computes the dot product of this vector with another `Vector2`.
+     * @param vector The other `Vector2`.
      * @return The dot product result (X1*X2 + Y1*Y2).
      */
-    float DotProduct(const Vector2D& vector) const;
+    T DotProduct(const Vector2& vector) const;
 
     /**
-     * @brief Calculates the Euclidean distance between this vector and another `Vector2D`.
-     * @param vector The other `Vector2D`.
+     * @brief Calculates the Euclidean distance between this vector and another `Vector2`.
+     * @param vector The other `Vector2`.
      * @return The distance between the two vectors.
      */
-    float CalculateEuclideanDistance(const Vector2D& vector) const;
+    T CalculateEuclideanDistance(const Vector2& vector) const;
 
     /**
      * @brief 90-degree counter-clockwise perpendicular.
      */
-    Vector2D Perpendicular() const;
+    Vector2 Perpendicular() const;
 
     /**
      * @brief 90-degree clockwise perpendicular.
      */
-    Vector2D RightPerpendicular() const;
+    Vector2 RightPerpendicular() const;
 
     /**
-     * @brief Checks if this vector is equal to another `Vector2D` component-wise.
-     * @param vector The `Vector2D` to compare.
+     * @brief Checks if this vector is equal to another `Vector2` component-wise.
+     * @param vector The `Vector2` to compare.
      * @return `true` if equal, otherwise `false`.
      */
-    bool IsEqual(const Vector2D& vector) const;
+    bool IsEqual(const Vector2& vector) const;
 
     /**
      * @brief Converts the vector to a string representation.
@@ -211,143 +226,143 @@ public:
     // --- Static function declarations ---
 
     /**
-     * @brief Returns the squared magnitude of a given vector (X^2 + Y^2) as a Vector2D.
+     * @brief Returns the squared magnitude of a given vector (X^2 + Y^2) as a Vector2.
      *
      * Note: This function name can be misleading since "Normal" typically implies a normalized vector.
      *       Here, it is used as in "square of the magnitude" or "norm".
      *
-     * @param vector The input `Vector2D`.
-     * @return A `Vector2D` containing squared values of each component.
+     * @param vector The input `Vector2`.
+     * @return A `Vector2` containing squared values of each component.
      */
-    static Vector2D Normal(const Vector2D& vector);
+    static Vector2 Normal(const Vector2& vector);
 
     /**
      * @brief Adds two vectors (component-wise).
-     * @param v1 The first `Vector2D`.
-     * @param v2 The second `Vector2D`.
-     * @return A new `Vector2D` representing the sum.
+     * @param v1 The first `Vector2`.
+     * @param v2 The second `Vector2`.
+     * @return A new `Vector2` representing the sum.
      */
-    static Vector2D Add(const Vector2D& v1, const Vector2D& v2);
+    static Vector2 Add(const Vector2& v1, const Vector2& v2);
 
     /**
      * @brief Subtracts one vector from another (component-wise).
-     * @param v1 The first `Vector2D`.
-     * @param v2 The second `Vector2D` to subtract from `v1`.
-     * @return A new `Vector2D` representing the difference.
+     * @param v1 The first `Vector2`.
+     * @param v2 The second `Vector2` to subtract from `v1`.
+     * @return A new `Vector2` representing the difference.
      */
-    static Vector2D Subtract(const Vector2D& v1, const Vector2D& v2);
+    static Vector2 Subtract(const Vector2& v1, const Vector2& v2);
 
     /**
      * @brief Multiplies two vectors component-wise.
-     * @param v1 The first `Vector2D`.
-     * @param v2 The second `Vector2D`.
-     * @return A new `Vector2D` representing the product.
+     * @param v1 The first `Vector2`.
+     * @param v2 The second `Vector2`.
+     * @return A new `Vector2` representing the product.
      */
-    static Vector2D Multiply(const Vector2D& v1, const Vector2D& v2);
+    static Vector2 Multiply(const Vector2& v1, const Vector2& v2);
 
     /**
      * @brief Divides two vectors component-wise.
-     * @param v1 The first `Vector2D`.
-     * @param v2 The second `Vector2D` (divisor).
-     * @return A new `Vector2D` representing the quotient.
+     * @param v1 The first `Vector2`.
+     * @param v2 The second `Vector2` (divisor).
+     * @return A new `Vector2` representing the quotient.
      */
-    static Vector2D Divide(const Vector2D& v1, const Vector2D& v2);
+    static Vector2 Divide(const Vector2& v1, const Vector2& v2);
 
     /**
-     * @brief Scales a `Vector2D` by a float, component-wise.
-     * @param vector The `Vector2D`.
+     * @brief Scales a `Vector2` by a scalar, component-wise.
+     * @param vector The `Vector2`.
      * @param scalar The scaling factor.
-     * @return A new `Vector2D` scaled by `scalar`.
+     * @return A new `Vector2` scaled by `scalar`.
      */
-    static Vector2D Multiply(const Vector2D& vector, const float& scalar);
+    static Vector2 Multiply(const Vector2& vector, const T& scalar);
 
     /**
-     * @brief Scales a `Vector2D` by a float, component-wise (scalar on the left).
+     * @brief Scales a `Vector2` by a scalar, component-wise (scalar on the left).
      * @param scalar The scaling factor.
-     * @param vector The `Vector2D`.
-     * @return A new `Vector2D` scaled by `scalar`.
+     * @param vector The `Vector2`.
+     * @return A new `Vector2` scaled by `scalar`.
      */
-    static Vector2D Multiply(const float& scalar, const Vector2D& vector);
+    static Vector2 Multiply(const T& scalar, const Vector2& vector);
 
     /**
-     * @brief Divides a `Vector2D` by a scalar, component-wise.
-     * @param vector The `Vector2D`.
+     * @brief Divides a `Vector2` by a scalar, component-wise.
+     * @param vector The `Vector2`.
      * @param scalar The scalar divisor.
-     * @return A new `Vector2D` after the division.
+     * @return A new `Vector2` after the division.
      */
-    static Vector2D Divide(const Vector2D& vector, const float& scalar);
+    static Vector2 Divide(const Vector2& vector, const T& scalar);
 
     /**
      * @brief Computes the 2D cross product of two vectors, returning a scalar (Z-component in 3D).
-     * @param v1 The first `Vector2D`.
-     * @param v2 The second `Vector2D`.
+     * @param v1 The first `Vector2`.
+     * @param v2 The second `Vector2`.
      * @return The scalar cross product (v1.x*v2.y - v1.y*v2.x).
      */
-    static float CrossProduct(const Vector2D& v1, const Vector2D& v2);
+    static T CrossProduct(const Vector2& v1, const Vector2& v2);
 
     /**
-     * @brief Computes the dot product of two `Vector2D`s.
-     * @param v1 The first `Vector2D`.
-     * @param v2 The second `Vector2D`.
+     * @brief Computes the dot product of two `Vector2`s.
+     * @param v1 The first `Vector2`.
+     * @param v2 The second `Vector2`.
      * @return The dot product (v1.x*v2.x + v1.y*v2.y).
      */
-    static float DotProduct(const Vector2D& v1, const Vector2D& v2);
+    static T DotProduct(const Vector2& v1, const Vector2& v2);
 
     /**
-     * @brief Calculates the Euclidean distance between two `Vector2D`s.
-     * @param v1 The first `Vector2D`.
-     * @param v2 The second `Vector2D`.
+     * @brief Calculates the Euclidean distance between two `Vector2`s.
+     * @param v1 The first `Vector2`.
+     * @param v2 The second `Vector2`.
      * @return The distance between `v1` and `v2`.
      */
-    static float CalculateEuclideanDistance(const Vector2D& v1, const Vector2D& v2);
+    static T CalculateEuclideanDistance(const Vector2& v1, const Vector2& v2);
 
     /**
-     * @brief Checks if two `Vector2D`s are equal component-wise.
-     * @param v1 The first `Vector2D`.
-     * @param v2 The second `Vector2D`.
+     * @brief Checks if two `Vector2`s are equal component-wise.
+     * @param v1 The first `Vector2`.
+     * @param v2 The second `Vector2`.
      * @return `true` if equal, otherwise `false`.
      */
-    static bool IsEqual(const Vector2D& v1, const Vector2D& v2);
+    static bool IsEqual(const Vector2& v1, const Vector2& v2);
 
     /**
-     * @brief Returns a new vector with the minimum components of two `Vector2D`s.
-     * @param v1 The first `Vector2D`.
-     * @param v2 The second `Vector2D`.
-     * @return A `Vector2D` with per-component minimums.
+     * @brief Returns a new vector with the minimum components of two `Vector2`s.
+     * @param v1 The first `Vector2`.
+     * @param v2 The second `Vector2`.
+     * @return A `Vector2` with per-component minimums.
      */
-    static Vector2D Minimum(const Vector2D& v1, const Vector2D& v2);
+    static Vector2 Minimum(const Vector2& v1, const Vector2& v2);
 
     /**
-     * @brief Returns a new vector with the maximum components of two `Vector2D`s.
-     * @param v1 The first `Vector2D`.
-     * @param v2 The second `Vector2D`.
-     * @return A `Vector2D` with per-component maximums.
+     * @brief Returns a new vector with the maximum components of two `Vector2`s.
+     * @param v1 The first `Vector2`.
+     * @param v2 The second `Vector2`.
+     * @return A `Vector2` with per-component maximums.
      */
-    static Vector2D Maximum(const Vector2D& v1, const Vector2D& v2);
+    static Vector2 Maximum(const Vector2& v1, const Vector2& v2);
 
     /**
-     * @brief Performs linear interpolation between two `Vector2D`s.
-     * @param start The start `Vector2D`.
-     * @param finish The end `Vector2D`.
+     * @brief Performs linear interpolation between two `Vector2`s.
+     * @param start The start `Vector2`.
+     * @param finish The end `Vector2`.
      * @param ratio A normalized factor (0 to 1).
-     * @return A new `Vector2D` representing the linear interpolation result.
+     * @return A new `Vector2` representing the linear interpolation result.
      */
-    static Vector2D LERP(const Vector2D& start, const Vector2D& finish, const float& ratio);
+    static Vector2 LERP(const Vector2& start, const Vector2& finish, const T& ratio);
 
 
     /**
      * @brief Converts a vector of degrees to radians (component-wise).
      * @param degrees The vector in degrees.
-     * @return A `Vector2D` in radians.
+     * @return A `Vector2` in radians.
      */
-    static Vector2D DegreesToRadians(const Vector2D& degrees);
+    static Vector2 DegreesToRadians(const Vector2& degrees);
 
     /**
      * @brief Converts a vector of radians to degrees (component-wise).
      * @param radians The vector in radians.
-     * @return A `Vector2D` in degrees.
+     * @return A `Vector2` in degrees.
      */
-    static Vector2D RadiansToDegrees(const Vector2D& radians);
+    static Vector2 RadiansToDegrees(const Vector2& radians);
 
     /**
      * @brief Checks if two line segments defined by (p1, p2) and (q1, q2) intersect in 2D space.
@@ -357,72 +372,78 @@ public:
      * @param q2 End of the second segment.
      * @return `true` if the segments intersect, otherwise `false`.
      */
-    static bool LineSegmentsIntersect(const Vector2D& p1, const Vector2D& p2,
-                                      const Vector2D& q1, const Vector2D& q2);
+    static bool LineSegmentsIntersect(const Vector2& p1, const Vector2& p2,
+                                      const Vector2& q1, const Vector2& q2);
 
 
     // --- Operator overloads ---
 
     /**
-     * @brief Equality operator. Checks if two `Vector2D`s are equal (component-wise).
+     * @brief Equality operator. Checks if two `Vector2`s are equal (component-wise).
      * @param vector The vector to compare with.
      * @return `true` if equal, otherwise `false`.
      */
-    bool operator ==(const Vector2D& vector) const;
+    bool operator ==(const Vector2& vector) const;
 
     /**
-     * @brief Inequality operator. Checks if two `Vector2D`s differ (component-wise).
+     * @brief Inequality operator. Checks if two `Vector2`s differ (component-wise).
      * @param vector The vector to compare with.
      * @return `true` if not equal, otherwise `false`.
      */
-    bool operator !=(const Vector2D& vector) const;
+    bool operator !=(const Vector2& vector) const;
 
     /**
-     * @brief Assignment operator. Copies another `Vector2D` into this one.
+     * @brief Assignment operator. Copies another `Vector2` into this one.
      * @param vector The vector to copy.
-     * @return A reference to this `Vector2D`.
+     * @return A reference to this `Vector2`.
      */
-    Vector2D operator =(const Vector2D& vector);
+    Vector2 operator =(const Vector2& vector);
 
     /**
      * @brief Addition operator. Adds two vectors component-wise.
-     * @param vector The right-hand side `Vector2D`.
-     * @return A new `Vector2D` representing the sum.
+     * @param vector The right-hand side `Vector2`.
+     * @return A new `Vector2` representing the sum.
      */
-    Vector2D operator +(const Vector2D& vector) const;
+    Vector2 operator +(const Vector2& vector) const;
 
     /**
      * @brief Subtraction operator. Subtracts two vectors component-wise.
-     * @param vector The right-hand side `Vector2D`.
-     * @return A new `Vector2D` representing the difference.
+     * @param vector The right-hand side `Vector2`.
+     * @return A new `Vector2` representing the difference.
      */
-    Vector2D operator -(const Vector2D& vector) const;
+    Vector2 operator -(const Vector2& vector) const;
 
     /**
      * @brief Multiplication operator. Multiplies two vectors component-wise.
-     * @param vector The right-hand side `Vector2D`.
-     * @return A new `Vector2D` representing the product.
+     * @param vector The right-hand side `Vector2`.
+     * @return A new `Vector2` representing the product.
      */
-    Vector2D operator *(const Vector2D& vector) const;
+    Vector2 operator *(const Vector2& vector) const;
 
     /**
      * @brief Division operator. Divides two vectors component-wise.
-     * @param vector The right-hand side `Vector2D` (divisor).
-     * @return A new `Vector2D` representing the quotient.
+     * @param vector The right-hand side `Vector2` (divisor).
+     * @return A new `Vector2` representing the quotient.
      */
-    Vector2D operator /(const Vector2D& vector) const;
+    Vector2 operator /(const Vector2& vector) const;
 
     /**
-     * @brief Multiplication operator by a float scalar (on the right).
+     * @brief Multiplication operator by a scalar (on the right).
      * @param value The scalar factor.
-     * @return A new `Vector2D` scaled by `value`.
+     * @return A new `Vector2` scaled by `value`.
      */
-    Vector2D operator *(const float& value) const;
+    Vector2 operator *(const T& value) const;
 
     /**
-     * @brief Division operator by a float scalar.
+     * @brief Division operator by a scalar.
      * @param value The scalar divisor.
-     * @return A new `Vector2D` after division by `value`.
+     * @return A new `Vector2` after division by `value`.
      */
-    Vector2D operator /(const float& value) const;
+    Vector2 operator /(const T& value) const;
 };
+
+#include "vector2d.tpp" // Include the template implementation.
+
+extern template class Vector2<float>;
+
+using Vector2D = Vector2<float>; ///< Single precision 2D vector, the type used throughout the library.
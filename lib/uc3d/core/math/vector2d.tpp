@@ -0,0 +1,356 @@
+#pragma once
+
+template<typename T>
+Vector2<T> Vector2<T>::Absolute() const {
+    return Vector2<T>{
+        ScalarMath<T>::Abs(X),
+        ScalarMath<T>::Abs(Y)
+    };
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Normal() const {
+    T magn = Magnitude();
+    
+    if (ScalarMath<T>::IsClose(magn, T(1), ScalarMath<T>::Epsilon())){
+        return (*this);
+    }
+    else if (ScalarMath<T>::IsClose(magn, T(0), ScalarMath<T>::Epsilon())){
+        return Multiply(T(3.40282e+038f));
+    }
+    else{
+        return Multiply(T(1) / magn);
+    }
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Add(const Vector2<T>& vector) const {
+    return Vector2<T>{
+        X + vector.X,
+        Y + vector.Y
+    };
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Subtract(const Vector2<T>& vector) const {
+    return Vector2<T>{
+        X - vector.X,
+        Y - vector.Y
+    };
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Multiply(const Vector2<T>& vector) const {
+    return Vector2<T>{
+        X * vector.X,
+        Y * vector.Y
+    };
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Divide(const Vector2<T>& vector) const {
+    return Vector2<T>{
+        X / vector.X,
+        Y / vector.Y
+    };
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Multiply(const T& scalar) const {
+    if (ScalarMath<T>::IsClose(scalar, T(1), ScalarMath<T>::Epsilon())) return (*this);
+    if (ScalarMath<T>::IsClose(scalar, T(0), ScalarMath<T>::Epsilon())) return Vector2<T>();
+
+    return Vector2<T>{
+        X * scalar,
+        Y * scalar
+    };
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Divide(const T& scalar) const {
+    if (ScalarMath<T>::IsClose(scalar, T(1), ScalarMath<T>::Epsilon())) return (*this);
+    if (ScalarMath<T>::IsClose(scalar, T(0), ScalarMath<T>::Epsilon())) return Vector2<T>();
+    
+    return Vector2<T>{
+        X / scalar,
+        Y / scalar
+    };
+}
+
+template<typename T>
+T Vector2<T>::CrossProduct(const Vector2<T>& vector) const {
+    return (X * vector.Y) - (Y * vector.X);
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::UnitCircle() const {
+    T length = Magnitude();
+
+    if (ScalarMath<T>::IsClose(length, T(1), ScalarMath<T>::Epsilon())) return Vector2<T>(this->X, this->Y);
+    if (length == 0) return Vector2<T>(0, 1);
+
+    return Vector2<T>{
+        X / length,
+        Y / length
+    };
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Constrain(const T& minimum, const T& maximum) const {
+    return Vector2<T>{
+        Mathematics::Constrain(X, minimum, maximum),
+        Mathematics::Constrain(Y, minimum, maximum)
+    };
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Constrain(const Vector2<T>& minimum, const Vector2<T>& maximum) const {
+    return Vector2<T>{
+        Mathematics::Constrain(X, minimum.X, maximum.X),
+        Mathematics::Constrain(Y, minimum.Y, maximum.Y)
+    };
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Minimum(const Vector2<T>& v) const {
+    return Vector2<T>{
+        X < v.X ? X : v.X,
+        Y < v.Y ? Y : v.Y
+    };
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Maximum(const Vector2<T>& v) const {
+    return Vector2<T>{
+        X > v.X ? X : v.X,
+        Y > v.Y ? Y : v.Y
+    };
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Rotate(const T& angle, const Vector2<T>& offset) const {
+    Vector2<T> v = Vector2<T>(X, Y).Subtract(offset);
+
+    T angleMPD18 = angle * T(Mathematics::MPID180);
+
+    T cs = ScalarMath<T>::Cos(angleMPD18);
+    T sn = ScalarMath<T>::Sin(angleMPD18);
+
+    return Vector2<T>{
+        v.X * cs - v.Y * sn + offset.X,
+        v.X * sn + v.Y * cs + offset.Y
+    };
+}
+
+template<typename T>
+bool Vector2<T>::CheckBounds(const Vector2<T>& minimum, const Vector2<T>& maximum) const {
+    return X > minimum.X && X < maximum.X && Y > minimum.Y && Y < maximum.Y;
+}
+
+template<typename T>
+T Vector2<T>::Magnitude() const {
+    return ScalarMath<T>::Sqrt(X * X + Y * Y);
+}
+
+template<typename T>
+T Vector2<T>::DotProduct(const Vector2<T>& vector) const {
+    return (X * vector.X) + (Y * vector.Y);
+}
+
+template<typename T>
+T Vector2<T>::CalculateEuclideanDistance(const Vector2<T>& vector) const {
+    Vector2<T> offset = Vector2<T>(X - vector.X, Y - vector.Y);
+
+    return offset.Magnitude();
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Perpendicular() const {
+    return Vector2<T>(-Y, X);
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::RightPerpendicular() const {
+    return Vector2<T>(Y, -X);
+}
+
+template<typename T>
+bool Vector2<T>::IsEqual(const Vector2<T>& vector) const {
+    return (X == vector.X) && (Y == vector.Y);
+}
+
+template<typename T>
+uc3d::UString Vector2<T>::ToString() const {
+    uc3d::UString x = Mathematics::DoubleToCleanString(ScalarMath<T>::ToFloat(X));
+    uc3d::UString y = Mathematics::DoubleToCleanString(ScalarMath<T>::ToFloat(Y));
+
+    return "[" + x + ", " + y + "]";
+}
+
+
+// Implementations of static member functions
+template<typename T>
+Vector2<T> Vector2<T>::Minimum(const Vector2<T>& v1, const Vector2<T>& v2) {
+    return Vector2<T>{
+        v1.X < v2.X ? v1.X : v2.X,
+        v1.Y < v2.Y ? v1.Y : v2.Y
+    };
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Maximum(const Vector2<T>& v1, const Vector2<T>& v2) {
+    return Vector2<T>{
+        v1.X > v2.X ? v1.X : v2.X,
+        v1.Y > v2.Y ? v1.Y : v2.Y
+    };
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::LERP(const Vector2<T>& start, const Vector2<T>& finish, const T& ratio) {
+    Vector2<T> startL = start, finishL = finish;
+
+    return finishL * ratio + startL * (T(1) - ratio);
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::DegreesToRadians(const Vector2<T>& degrees) {
+    return Vector2<T>(degrees.X * T(Mathematics::MPID180), degrees.Y * T(Mathematics::MPID180));
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::RadiansToDegrees(const Vector2<T>& radians) {
+    return Vector2<T>(radians.X * T(Mathematics::M180DPI), radians.Y * T(Mathematics::M180DPI));
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Normal(const Vector2<T>& vector) {
+    Vector2<T> normal = vector;
+
+    return normal.Normal();
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Add(const Vector2<T>& v1, const Vector2<T>& v2) {
+    return Vector2<T>(v1.X + v2.X, v1.Y + v2.Y);
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Subtract(const Vector2<T>& v1, const Vector2<T>& v2) {
+    return Vector2<T>(v1.X - v2.X, v1.Y - v2.Y);
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Multiply(const Vector2<T>& v1, const Vector2<T>& v2) {
+    return Vector2<T>(v1.X * v2.X, v1.Y * v2.Y);
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Divide(const Vector2<T>& v1, const Vector2<T>& v2) {
+    return Vector2<T>(v1.X / v2.X, v1.Y / v2.Y);
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Multiply(const Vector2<T>& vector, const T& scalar) {
+    return Vector2<T>(vector.X * scalar, vector.Y * scalar);
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Multiply(const T& scalar, const Vector2<T>& vector) {
+    return Vector2<T>(vector.X * scalar, vector.Y * scalar);
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::Divide(const Vector2<T>& vector, const T& scalar) {
+    return Vector2<T>(vector.X / scalar, vector.Y / scalar);
+}
+
+template<typename T>
+T Vector2<T>::CrossProduct(const Vector2<T>& v1, const Vector2<T>& v2) {
+    return (v1.X * v2.Y) - (v1.Y * v2.X);
+}
+
+template<typename T>
+T Vector2<T>::DotProduct(const Vector2<T>& v1, const Vector2<T>& v2) {
+    return (v1.X * v2.X) + (v1.Y * v2.Y);
+}
+
+template<typename T>
+T Vector2<T>::CalculateEuclideanDistance(const Vector2<T>& v1, const Vector2<T>& v2) {
+    Vector2<T> offset = Vector2<T>(v1.X - v2.X, v1.Y - v2.Y);
+
+    return offset.Magnitude();
+}
+
+template<typename T>
+bool Vector2<T>::IsEqual(const Vector2<T>& v1, const Vector2<T>& v2) {
+    return (v1.X == v2.X) && (v1.Y == v2.Y);
+}
+
+template<typename T>
+bool Vector2<T>::LineSegmentsIntersect(const Vector2<T>& p1, const Vector2<T>& p2, const Vector2<T>& q1, const Vector2<T>& q2) {
+    Vector2<T> dirP = p2 - p1;
+    Vector2<T> dirQ = q2 - q1;
+    T crossPQ = dirP.CrossProduct(dirQ);
+
+    if (ScalarMath<T>::Abs(crossPQ) < ScalarMath<T>::Epsilon()) return false;
+
+    Vector2<T> diffPQ1 = q1 - p1;
+    Vector2<T> diffPQ2 = q2 - p1;
+    T crossPDiff1 = dirP.CrossProduct(diffPQ1);
+    T crossPDiff2 = dirP.CrossProduct(diffPQ2);
+    
+    if ((crossPDiff1 * crossPDiff2) <= 0) {
+        return true;
+    }
+    
+    return false;
+}
+
+// Operator overloads
+template<typename T>
+bool Vector2<T>::operator ==(const Vector2<T>& vector) const {
+    return this->IsEqual(vector);
+}
+
+template<typename T>
+bool Vector2<T>::operator !=(const Vector2<T>& vector) const {
+    return !(this->IsEqual(vector));
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::operator =(const Vector2<T>& vector) {
+    this->X = vector.X;
+    this->Y = vector.Y;
+
+    return *this;
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::operator +(const Vector2<T>& vector) const {
+    return Add(vector);
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::operator -(const Vector2<T>& vector) const {
+    return Subtract(vector);
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::operator *(const Vector2<T>& vector) const {
+    return Multiply(vector);
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::operator /(const Vector2<T>& vector) const {
+    return Divide(vector);
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::operator *(const T& value) const {
+    return Multiply(value);
+}
+
+template<typename T>
+Vector2<T> Vector2<T>::operator /(const T& value) const {
+    return Divide(value);
+}
\ No newline at end of file
@@ -0,0 +1,391 @@
+#pragma once
+
+template<typename T>
+Vector3<T>::Vector3() : X(0), Y(0), Z(0) {}
+
+template<typename T>
+Vector3<T>::Vector3(const Vector3<T>& vector) : X(vector.X), Y(vector.Y), Z(vector.Z) {}
+
+template<typename T>
+Vector3<T>::Vector3(const Vector3<T>* vector) : X(vector->X), Y(vector->Y), Z(vector->Z) {}
+
+template<typename T>
+Vector3<T>::Vector3(const T& X, const T& Y, const T& Z) : X(X), Y(Y), Z(Z) {}
+
+// Implementations of non-static member functions
+template<typename T>
+Vector3<T> Vector3<T>::Absolute() const {
+    return Vector3<T>{
+        ScalarMath<T>::Abs(this->X),
+        ScalarMath<T>::Abs(this->Y),
+        ScalarMath<T>::Abs(this->Z)
+    };
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Normal() const {
+    T magn = Magnitude();
+	
+    if (ScalarMath<T>::IsClose(magn, T(1), ScalarMath<T>::Epsilon())){
+        return (*this);
+    }
+    else if (ScalarMath<T>::IsClose(magn, T(0), ScalarMath<T>::Epsilon())){
+        return Multiply(T(3.40282e+038f));
+    }
+    else{
+        return Multiply(T(1) / magn);
+    }
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Add(const T& value) const {
+    return Vector3<T>{
+        this->X + value,
+        this->Y + value,
+        this->Z + value 
+    };
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Subtract(const T& value) const {
+    return Vector3<T> {
+        this->X - value,
+        this->Y - value,
+        this->Z - value
+    };
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Add(const Vector3<T>& vector) const {
+    return Vector3<T>{
+        this->X + vector.X,
+        this->Y + vector.Y,
+        this->Z + vector.Z 
+    };
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Subtract(const Vector3<T>& vector) const {
+    return Vector3<T> {
+        this->X - vector.X,
+        this->Y - vector.Y,
+        this->Z - vector.Z 
+    };
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Multiply(const Vector3<T>& vector) const {
+    return Vector3<T> {
+        this->X * vector.X,
+        this->Y * vector.Y,
+        this->Z * vector.Z 
+    };
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Divide(const Vector3<T>& vector) const {
+    return Vector3<T> {
+        this->X / vector.X,
+        this->Y / vector.Y,
+        this->Z / vector.Z 
+    };
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Multiply(const T& scalar) const {
+    return Vector3<T> {
+        this->X * scalar,
+        this->Y * scalar,
+        this->Z * scalar 
+    };
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Divide(const T& scalar) const {
+    return Vector3<T> {
+        this->X / scalar,
+        this->Y / scalar,
+        this->Z / scalar
+    };
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::CrossProduct(const Vector3<T>& vector) const {
+    return Vector3<T> {
+        (this->Y * vector.Z) - (this->Z * vector.Y),
+        (this->Z * vector.X) - (this->X * vector.Z),
+        (this->X * vector.Y) - (this->Y * vector.X) 
+    };
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::UnitSphere() const {
+    Vector3<T> vector = Vector3<T>(this->X, this->Y, this->Z);
+    T length = vector.Magnitude();
+
+    if (ScalarMath<T>::IsClose(length, T(1), ScalarMath<T>::Epsilon())) return Vector3<T>(this->X, this->Y, this->Z);
+    if (length == 0) return Vector3<T>(0, 1, 0);
+
+    return Vector3<T> {
+        vector.X / length,
+        vector.Y / length,
+        vector.Z / length 
+    };
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Constrain(const T& minimum, const T& maximum) const {
+    return Vector3<T>{
+        Mathematics::Constrain(X, minimum, maximum),
+        Mathematics::Constrain(Y, minimum, maximum),
+        Mathematics::Constrain(Z, minimum, maximum)
+    };
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Constrain(const Vector3<T>& minimum, const Vector3<T>& maximum) const {
+    return Vector3<T>{
+        Mathematics::Constrain(X, minimum.X, maximum.X),
+        Mathematics::Constrain(Y, minimum.Y, maximum.Y),
+        Mathematics::Constrain(Z, minimum.Z, maximum.Z)
+    };
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Permutate(const Vector3<T>& permutation) const {
+    Vector3<T> v = Vector3<T>(this->X, this->Y, this->Z);
+    T perm[3];
+
+    perm[int(ScalarMath<T>::ToFloat(permutation.X))] = v.X;
+    perm[int(ScalarMath<T>::ToFloat(permutation.Y))] = v.Y;
+    perm[int(ScalarMath<T>::ToFloat(permutation.Z))] = v.Z;
+
+    v.X = perm[0];
+    v.Y = perm[1];
+    v.Z = perm[2];
+
+    return v;
+}
+
+template<typename T>
+T Vector3<T>::Magnitude() const {
+    return ScalarMath<T>::Sqrt(X * X + Y * Y + Z * Z);
+}
+
+template<typename T>
+T Vector3<T>::DotProduct(const Vector3<T>& vector) const {
+    return (X * vector.X) + (Y * vector.Y) + (Z * vector.Z);
+}
+
+template<typename T>
+T Vector3<T>::CalculateEuclideanDistance(const Vector3<T>& vector) const {
+    Vector3<T> offset = Vector3<T>(X - vector.X, Y - vector.Y, Z - vector.Z);
+
+    return offset.Magnitude();
+}
+
+template<typename T>
+T Vector3<T>::AverageHighestTwoComponents() const {
+    Vector3<T> absV = this->Absolute();
+
+    // Find the two largest absolute values
+    T max1 = absV.Max();
+    T max2 = (max1 == absV.X) ? Mathematics::Max(absV.Y, absV.Z) : (max1 == absV.Y) ? Mathematics::Max(absV.X, absV.Z) : Mathematics::Max(absV.X, absV.Y);
+
+    // Compute the average of the two largest values
+    return (max1 + max2) / T(2);
+}
+
+template<typename T>
+T Vector3<T>::Max() const{
+    return Mathematics::Max(X, Y, Z);
+}
+
+template<typename T>
+T Vector3<T>::Min() const{
+    return Mathematics::Min(X, Y, Z);
+}
+
+template<typename T>
+bool Vector3<T>::IsEqual(const Vector3<T>& vector) const {
+    return (this->X == vector.X) && (this->Y == vector.Y) && (this->Z == vector.Z);
+
+}
+
+template<typename T>
+uc3d::UString Vector3<T>::ToString() const {
+    uc3d::UString x = Mathematics::DoubleToCleanString(ScalarMath<T>::ToFloat(this->X));
+    uc3d::UString y = Mathematics::DoubleToCleanString(ScalarMath<T>::ToFloat(this->Y));
+    uc3d::UString z = Mathematics::DoubleToCleanString(ScalarMath<T>::ToFloat(this->Z));
+
+    return "[" + x + ", " + y + ", " + z + "]";
+}
+
+// Implementations of static member functions
+template<typename T>
+Vector3<T> Vector3<T>::Max(const Vector3<T>& max, const Vector3<T>& input) {
+    return Vector3<T>(input.X > max.X ? input.X : max.X,
+		input.Y > max.Y ? input.Y : max.Y,
+		input.Z > max.Z ? input.Z : max.Z);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Min(const Vector3<T>& min, const Vector3<T>& input) {
+    return Vector3<T>(input.X < min.X ? input.X : min.X,
+		input.Y < min.Y ? input.Y : min.Y,
+		input.Z < min.Z ? input.Z : min.Z);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::LERP(const Vector3<T>& start, const Vector3<T>& finish, const T& ratio) {
+    Vector3<T> startL = start, finishL = finish;
+
+    return finishL * ratio + startL * (T(1) - ratio);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::DegreesToRadians(const Vector3<T>& degrees) {
+    return Vector3<T>(degrees.X * T(Mathematics::MPID180), degrees.Y * T(Mathematics::MPID180), degrees.Z * T(Mathematics::MPID180));
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::RadiansToDegrees(const Vector3<T>& radians) {
+    return Vector3<T>(radians.X * T(Mathematics::M180DPI), radians.Y * T(Mathematics::M180DPI), radians.Z * T(Mathematics::M180DPI));
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Normal(const Vector3<T>& vector) {
+    Vector3<T> normal = vector;
+
+    return normal.Normal();
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Add(const Vector3<T>& v1, const Vector3<T>& v2) {
+    return Vector3<T>(v1.X + v2.X, v1.Y + v2.Y, v1.Z + v2.Z);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Subtract(const Vector3<T>& v1, const Vector3<T>& v2) {
+    return Vector3<T>(v1.X - v2.X, v1.Y - v2.Y, v1.Z - v2.Z);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Multiply(const Vector3<T>& v1, const Vector3<T>& v2) {
+    return Vector3<T>(v1.X * v2.X, v1.Y * v2.Y, v1.Z * v2.Z);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Divide(const Vector3<T>& v1, const Vector3<T>& v2) {
+    return Vector3<T>(v1.X / v2.X, v1.Y / v2.Y, v1.Z / v2.Z);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Multiply(const Vector3<T>& vector, const T& scalar) {
+    return Vector3<T>(vector.X * scalar, vector.Y * scalar, vector.Z * scalar);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Multiply(const T& scalar, const Vector3<T>& vector) {
+    return Vector3<T>(vector.X * scalar, vector.Y * scalar, vector.Z * scalar);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::Divide(const Vector3<T>& vector, const T& scalar) {
+    return Vector3<T>(vector.X / scalar, vector.Y / scalar, vector.Z / scalar);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::CrossProduct(const Vector3<T>& v1, const Vector3<T>& v2) {
+    return Vector3<T> {
+        (v1.Y * v2.Z) - (v1.Z * v2.Y),
+        (v1.Z * v2.X) - (v1.X * v2.Z),
+        (v1.X * v2.Y) - (v1.Y * v2.X) 
+    };
+}
+
+template<typename T>
+T Vector3<T>::DotProduct(const Vector3<T>& v1, const Vector3<T>& v2) {
+    return (v1.X * v2.X) + (v1.Y * v2.Y) + (v1.Z * v2.Z);
+}
+
+template<typename T>
+T Vector3<T>::CalculateEuclideanDistance(const Vector3<T>& v1, const Vector3<T>& v2) {
+    Vector3<T> offset = Vector3<T>(v1.X - v2.X, v1.Y - v2.Y, v1.Z - v2.Z);
+
+    return offset.Magnitude();
+}
+
+template<typename T>
+bool Vector3<T>::IsEqual(const Vector3<T>& v1, const Vector3<T>& v2) {
+    return (v1.X == v2.X) && (v1.Y == v2.Y) && (v1.Z == v2.Z);
+}
+
+// Operator overloads
+template<typename T>
+bool Vector3<T>::operator ==(const Vector3<T>& vector) const {
+    return this->IsEqual(vector);
+}
+
+template<typename T>
+bool Vector3<T>::operator !=(const Vector3<T>& vector) const {
+    return !(this->IsEqual(vector));
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::operator +=(const Vector3<T>& vector) {
+    this->X += vector.X;
+    this->Y += vector.Y;
+    this->Z += vector.Z;
+
+    return *this;
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::operator =(const Vector3<T>& vector) {
+    this->X = vector.X;
+    this->Y = vector.Y;
+    this->Z = vector.Z;
+
+    return *this;
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::operator +(const Vector3<T>& vector) const {
+    return Add(vector);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::operator -(const Vector3<T>& vector) const {
+    return Subtract(vector);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::operator *(const Vector3<T>& vector) const {
+    return Multiply(vector);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::operator /(const Vector3<T>& vector) const {
+    return Divide(vector);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::operator +(const T& value) const {
+    return Add(value);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::operator -(const T& value) const {
+    return Subtract(value);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::operator *(const T& value) const {
+    return Multiply(value);
+}
+
+template<typename T>
+Vector3<T> Vector3<T>::operator /(const T& value) const {
+    return Divide(value);
+}
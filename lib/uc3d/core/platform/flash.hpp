@@ -0,0 +1,27 @@
+#pragma once
+
+/**
+ * @file flash.hpp
+ * @brief Declares the `UC3D_FLASH` storage qualifier for read-only tables.
+ *
+ * Teensy 4.x copies `const` data into RAM at startup unless it is marked `PROGMEM`, and
+ * its flash is memory mapped so marked tables can still be read through plain pointers.
+ * On every other target the qualifier expands to nothing. AVR is excluded on purpose
+ * since its flash can only be read with `pgm_read_*`.
+ *
+ * @code
+ * UC3D_FLASH constexpr Vector2D layout[] = { ... };
+ * @endcode
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#if defined(ARDUINO) && defined(__IMXRT1062__)
+    #include <Arduino.h>
+
+    #define UC3D_FLASH PROGMEM
+#else
+    #define UC3D_FLASH
+#endif
@@ -0,0 +1,305 @@
+#include "threadpool.hpp"
+
+#if !defined(ARDUINO)
+// Workers record which pool and deque they belong to, every other thread uses the shared deque
+static thread_local const ThreadPool* currentPool = nullptr;
+static thread_local uint8_t currentIndex = 0;
+#endif
+
+ThreadPool::ThreadPool(uint8_t threadCount) {
+#if !defined(ARDUINO)
+    if (threadCount == 0) {
+        unsigned int hardware = std::thread::hardware_concurrency();
+
+        threadCount = uint8_t(hardware == 0 ? 1 : (hardware > 255 ? 255 : hardware));
+    }
+
+    workerCount = threadCount - 1;
+    jobs = new Job[kMaxJobs];
+    deques = new Deque[workerCount + 1];
+
+    for (uint16_t i = 0; i <= workerCount; i++) {
+        deques[i].jobs = new Job*[kMaxJobs];
+    }
+
+    if (workerCount > 0) {
+        workers = new std::thread[workerCount];
+
+        for (uint8_t i = 0; i < workerCount; i++) {
+            workers[i] = std::thread(&ThreadPool::WorkerLoop, this, i);
+        }
+    }
+#else
+    (void)threadCount;
+#endif
+}
+
+ThreadPool::~ThreadPool() {
+#if !defined(ARDUINO)
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stop = true;
+    }
+
+    wake.notify_all();
+
+    for (uint8_t i = 0; i < workerCount; i++) {
+        workers[i].join();
+    }
+
+    for (uint16_t i = 0; i <= workerCount; i++) {
+        delete[] deques[i].jobs;
+    }
+
+    delete[] workers;
+    delete[] deques;
+    delete[] jobs;
+#endif
+}
+
+#if !defined(ARDUINO)
+uint8_t ThreadPool::GetThreadIndex() const {
+    return currentPool == this ? currentIndex : workerCount;
+}
+
+ThreadPool::Job* ThreadPool::Claim() {
+    for (uint32_t attempt = 1; ; attempt++) {
+        Job* job = &jobs[nextJob.fetch_add(1) % kMaxJobs];
+
+        // Records of jobs still queued or running are skipped. Claiming happens under the lock,
+        // so a submitter recording a dependency sees the generation and the flag change together,
+        // and the previous run of the record has finished copying out its continuations.
+        if (job->finished.load(std::memory_order_relaxed)) {
+            Lock(job);
+
+            if (job->finished.load(std::memory_order_relaxed)) {
+                job->generation.store(job->generation.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                job->finished.store(false, std::memory_order_release);
+                job->continuationCount = 0;
+
+                Unlock(job);
+                return job;
+            }
+
+            Unlock(job);
+        }
+
+        // The whole ring is in use, help finish jobs before scanning it again
+        if (attempt % kMaxJobs == 0 && !RunOne(GetThreadIndex())) std::this_thread::yield();
+    }
+}
+
+void ThreadPool::WorkerLoop(uint8_t index) {
+    currentPool = this;
+    currentIndex = index;
+
+    for (;;) {
+        if (RunOne(index)) continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wake.wait(lock, [&] { return stop || queued.load() > 0; });
+
+        if (stop) return;
+    }
+}
+
+void ThreadPool::Push(Job* job) {
+    Deque& deque = deques[GetThreadIndex()];
+
+    {
+        std::lock_guard<std::mutex> lock(deque.mutex);
+        deque.jobs[deque.back++ % kMaxJobs] = job;
+    }
+
+    // Counted before taking the sleep lock, so a worker checking the predicate cannot miss it
+    queued.fetch_add(1);
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+
+    wake.notify_one();
+}
+
+ThreadPool::Job* ThreadPool::Take(uint8_t index) {
+    Deque& own = deques[index];
+
+    {
+        std::lock_guard<std::mutex> lock(own.mutex);
+
+        if (own.back != own.front) return own.jobs[--own.back % kMaxJobs];
+    }
+
+    // Steal the oldest job of another thread, it is the most likely to spawn further work
+    for (uint16_t i = 1; i <= workerCount; i++) {
+        Deque& victim = deques[(index + i) % (workerCount + 1)];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+
+        if (victim.back != victim.front) return victim.jobs[victim.front++ % kMaxJobs];
+    }
+
+    return nullptr;
+}
+
+bool ThreadPool::RunOne(uint8_t index) {
+    Job* job = Take(index);
+
+    if (!job) return false;
+
+    queued.fetch_sub(1);
+    Execute(job);
+
+    return true;
+}
+
+void ThreadPool::Execute(Job* job) {
+    job->function(job->index, job->context);
+
+    Lock(job);
+
+    job->finished.store(true, std::memory_order_release);
+
+    uint8_t continuationCount = job->continuationCount;
+    Job* continuations[kMaxContinuations];
+
+    for (uint8_t i = 0; i < continuationCount; i++) {
+        continuations[i] = job->continuations[i];
+    }
+
+    Unlock(job);
+
+    for (uint8_t i = 0; i < continuationCount; i++) {
+        if (continuations[i]->pending.fetch_sub(1) == 1) Push(continuations[i]);
+    }
+}
+
+void ThreadPool::Lock(Job* job) {
+    while (job->locked.exchange(true, std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+}
+
+void ThreadPool::Unlock(Job* job) {
+    job->locked.store(false, std::memory_order_release);
+}
+
+void ThreadPool::RunChunk(uint32_t chunk, void* context) {
+    LoopRange* range = static_cast<LoopRange*>(context);
+    uint32_t first = uint32_t(uint64_t(range->count) * chunk / range->chunkCount);
+    uint32_t last = uint32_t(uint64_t(range->count) * (chunk + 1) / range->chunkCount);
+
+    for (uint32_t i = first; i < last; i++) {
+        range->function(i, range->context);
+    }
+
+    range->remaining.fetch_sub(1, std::memory_order_release);
+}
+#endif
+
+ThreadPool::JobHandle ThreadPool::Submit(Function function, void* context, uint32_t index, const JobHandle* dependencies, uint8_t dependencyCount) {
+#if !defined(ARDUINO)
+    Job* job = Claim();
+    JobHandle handle(job, job->generation.load(std::memory_order_relaxed));
+
+    job->function = function;
+    job->context = context;
+    job->index = index;
+    job->pending.store(1); // Held until every dependency is recorded so the job cannot start early
+
+    for (uint8_t i = 0; i < dependencyCount; i++) {
+        Job* dependency = dependencies[i].job;
+
+        // A dependency whose record was claimed again has finished long ago
+        if (!dependency || dependency == job) continue;
+
+        Lock(dependency);
+
+        if (!dependency->finished.load(std::memory_order_acquire) && dependency->generation.load(std::memory_order_relaxed) == dependencies[i].generation) {
+            if (dependency->continuationCount < kMaxContinuations) {
+                dependency->continuations[dependency->continuationCount++] = job;
+                job->pending.fetch_add(1);
+                Unlock(dependency);
+                continue;
+            }
+
+            // No room to record this job, wait for the dependency here instead
+            Unlock(dependency);
+            Wait(dependencies[i]);
+            continue;
+        }
+
+        Unlock(dependency);
+    }
+
+    if (job->pending.fetch_sub(1) == 1) Push(job);
+
+    return handle;
+#else
+    // Jobs run in submission order, so every dependency has already finished
+    (void)dependencies;
+    (void)dependencyCount;
+
+    function(index, context);
+
+    return nullptr;
+#endif
+}
+
+bool ThreadPool::IsFinished(JobHandle job) const {
+#if !defined(ARDUINO)
+    // The generation is written before the flag is cleared, so a cleared flag shows a reuse
+    if (!job.job || job.job->finished.load(std::memory_order_acquire)) return true;
+
+    return job.job->generation.load(std::memory_order_relaxed) != job.generation;
+#else
+    (void)job;
+
+    return true;
+#endif
+}
+
+void ThreadPool::Wait(JobHandle job) {
+#if !defined(ARDUINO)
+    uint8_t index = GetThreadIndex();
+
+    // Help with other jobs rather than block, this keeps nested waits from deadlocking
+    while (!IsFinished(job)) {
+        if (!RunOne(index)) std::this_thread::yield();
+    }
+#else
+    (void)job;
+#endif
+}
+
+void ThreadPool::ParallelFor(uint32_t count, Function function, void* context) {
+#if !defined(ARDUINO)
+    if (workerCount > 0 && count > 1) {
+        // A few chunks per thread leaves room for stealing when iterations are uneven
+        uint32_t chunkCount = uint32_t(workerCount + 1) * 4;
+
+        if (chunkCount > count) chunkCount = count;
+
+        LoopRange range{ function, context, count, chunkCount, {chunkCount} };
+        uint8_t index = GetThreadIndex();
+
+        for (uint32_t i = 0; i < chunkCount; i++) {
+            Submit(RunChunk, &range, i);
+        }
+
+        // The chunk records may be reused once they finish, so only the countdown is waited on
+        while (range.remaining.load(std::memory_order_acquire) > 0) {
+            if (!RunOne(index)) std::this_thread::yield();
+        }
+
+        return;
+    }
+#endif
+
+    for (uint32_t i = 0; i < count; i++) {
+        function(i, context);
+    }
+}
+
+uint8_t ThreadPool::GetThreadCount() const {
+    return workerCount + 1;
+}
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <cstddef> // For std::nullptr_t
+#include <cstdint> // For std::uint8_t, std::uint32_t
+
+#if !defined(ARDUINO)
+    #include <atomic>
+    #include <condition_variable>
+    #include <mutex>
+    #include <thread>
+#endif
+
+/**
+ * @file ThreadPool.hpp
+ * @brief A platform-agnostic job system running on a fixed pool of worker threads.
+ * @date 16/10/2026
+ * @author Coela Can't
+ */
+
+/**
+ * @class ThreadPool
+ * @brief Runs jobs and data-parallel loops on a fixed set of work-stealing worker threads.
+ *
+ * Every thread owns a deque of ready jobs. Threads push and pop their own jobs at the back,
+ * which keeps recently spawned work hot in cache, and idle threads steal the oldest job from
+ * the front of another deque. Threads that are not workers share one extra deque.
+ *
+ * Jobs may depend on other jobs and only become ready once all of them have finished.
+ * Waiting on a job runs other ready jobs in the meantime, so jobs may submit and wait on
+ * further jobs, and ParallelFor may be nested.
+ *
+ * Job records come from a fixed ring of kMaxJobs. A record is only handed out again once its
+ * job has finished, so at most kMaxJobs jobs are queued or running at a time. Submitting
+ * beyond that makes the submitter run ready jobs until a record frees up. Every reuse advances
+ * the generation of the record, and handles carry the generation they were issued with, so a
+ * handle kept after its record was reused still reports its own job as finished.
+ *
+ * On Arduino targets no threads exist: jobs run as soon as they are submitted and every
+ * loop runs serially on the caller.
+ *
+ * @code
+ * void Deform(uint32_t index, void* context) {
+ *     ...
+ * }
+ *
+ * ThreadPool pool;
+ * ThreadPool::JobHandle deform = pool.Submit(Deform, &mesh);
+ * ThreadPool::JobHandle render = pool.Submit(Render, &frame, 0, &deform, 1);
+ *
+ * pool.Wait(render);
+ * @endcode
+ */
+class ThreadPool {
+public:
+    /**
+     * @brief Function run by a job or for each iteration of a loop.
+     * @param index The job or iteration index.
+     * @param context The context pointer passed on submission.
+     */
+    typedef void (*Function)(uint32_t index, void* context);
+
+#if !defined(ARDUINO)
+    static constexpr uint32_t kMaxJobs = 1024; ///< Size of the job ring and of every deque.
+    static constexpr uint8_t kMaxContinuations = 8; ///< Dependents recorded per job before submitters wait instead.
+
+    /**
+     * @struct Job
+     * @brief A unit of work with the jobs waiting for it to finish.
+     */
+    struct Job {
+        Function function; ///< Body of the job.
+        void* context; ///< Context passed to the body.
+        uint32_t index; ///< Index passed to the body.
+        std::atomic<uint16_t> pending{0}; ///< Unfinished dependencies, plus one until submission completes.
+        std::atomic<bool> finished{true}; ///< Set once the body returned.
+        std::atomic<uint32_t> generation{0}; ///< Number of times the record was claimed.
+        std::atomic<bool> locked{false}; ///< Guards the continuation list and claiming against the job finishing.
+        Job* continuations[kMaxContinuations]; ///< Jobs depending on this one.
+        uint8_t continuationCount = 0; ///< Number of recorded continuations.
+    };
+#else
+    struct Job {}; ///< Jobs run on submission, no record is kept.
+#endif
+
+    /**
+     * @struct JobHandle
+     * @brief Handle of a submitted job, nullptr for jobs that already finished.
+     */
+    struct JobHandle {
+        Job* job = nullptr; ///< Record of the job.
+        uint32_t generation = 0; ///< Generation of the record the job was submitted in.
+
+        JobHandle() = default;
+        JobHandle(std::nullptr_t) {}
+        JobHandle(Job* job, uint32_t generation) : job(job), generation(generation) {}
+    };
+
+private:
+    uint8_t workerCount = 0; ///< Number of worker threads, not counting the caller.
+
+#if !defined(ARDUINO)
+    /**
+     * @struct Deque
+     * @brief Ring buffer of ready jobs, popped at the back by its owner and stolen from the front.
+     */
+    struct Deque {
+        std::mutex mutex; ///< Guards the ring indices.
+        Job** jobs = nullptr; ///< Ring of kMaxJobs job pointers.
+        uint32_t front = 0; ///< Position of the oldest job.
+        uint32_t back = 0; ///< Position one past the newest job.
+    };
+
+    std::thread* workers = nullptr; ///< Worker threads.
+    Deque* deques = nullptr; ///< One deque per worker followed by the deque shared by other threads.
+    Job* jobs = nullptr; ///< Ring of job records.
+    std::atomic<uint32_t> nextJob{0}; ///< Next record of the ring to try when submitting.
+    std::atomic<uint32_t> queued{0}; ///< Number of ready jobs in all deques.
+
+    std::mutex sleepMutex; ///< Guards sleeping workers.
+    std::condition_variable wake; ///< Signals workers that jobs were queued or the pool stops.
+    bool stop = false; ///< Set when the pool is destroyed.
+
+    /**
+     * @struct LoopRange
+     * @brief Splits the iterations of a ParallelFor into contiguous chunks, one job each.
+     */
+    struct LoopRange {
+        Function function; ///< Body of the loop.
+        void* context; ///< Context of the loop.
+        uint32_t count; ///< Number of iterations.
+        uint32_t chunkCount; ///< Number of chunks.
+        std::atomic<uint32_t> remaining; ///< Chunks that have not finished yet.
+    };
+
+    /** @brief Retrieves the deque owned by the calling thread. */
+    uint8_t GetThreadIndex() const;
+
+    /** @brief Takes the next record of the ring whose job has finished and advances its generation. */
+    Job* Claim();
+
+    /** @brief Worker thread main loop. */
+    void WorkerLoop(uint8_t index);
+
+    /** @brief Adds a ready job to the calling thread's deque and wakes a worker. */
+    void Push(Job* job);
+
+    /** @brief Takes a ready job from the thread's own deque or steals one from another. */
+    Job* Take(uint8_t index);
+
+    /** @brief Runs one ready job if there is any, returns false otherwise. */
+    bool RunOne(uint8_t index);
+
+    /** @brief Runs a job and releases the jobs depending on it. */
+    void Execute(Job* job);
+
+    /** @brief Locks the continuation list of a job. */
+    static void Lock(Job* job);
+
+    /** @brief Unlocks the continuation list of a job. */
+    static void Unlock(Job* job);
+
+    /** @brief Runs the iterations of one chunk of a LoopRange. */
+    static void RunChunk(uint32_t chunk, void* context);
+#endif
+
+public:
+    /**
+     * @brief Starts the worker threads.
+     * @param threadCount Total threads used including the caller, 0 for one per hardware thread.
+     */
+    explicit ThreadPool(uint8_t threadCount = 0);
+
+    /**
+     * @brief Stops and joins the worker threads, jobs still queued are not run.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Submits a job that runs once all of its dependencies have finished.
+     *
+     * @param function Body of the job.
+     * @param context Pointer passed to the body.
+     * @param index Index passed to the body.
+     * @param dependencies Jobs that must finish first, may contain nullptr.
+     * @param dependencyCount Number of dependencies.
+     * @return Handle to wait on, it stays valid after the record is reused by a later submission.
+     */
+    JobHandle Submit(Function function, void* context, uint32_t index = 0, const JobHandle* dependencies = nullptr, uint8_t dependencyCount = 0);
+
+    /**
+     * @brief Checks if a job has finished.
+     * @param job Handle returned by Submit.
+     * @return True if the body of the job returned.
+     */
+    bool IsFinished(JobHandle job) const;
+
+    /**
+     * @brief Runs other ready jobs until a job has finished.
+     * @param job Handle returned by Submit.
+     */
+    void Wait(JobHandle job);
+
+    /**
+     * @brief Runs function(i, context) for every i in [0, count) and waits for completion.
+     *
+     * Iterations are split into a few contiguous chunks per thread, idle threads steal chunks
+     * from busy ones. The caller waits on a countdown of the loop rather than on the chunk
+     * records, and runs other ready jobs meanwhile.
+     *
+     * @param count Number of iterations.
+     * @param function Body of the loop, must be safe to run concurrently for different indices.
+     * @param context Pointer passed to every iteration.
+     */
+    void ParallelFor(uint32_t count, Function function, void* context);
+
+    /**
+     * @brief Retrieves the number of threads running jobs, including the caller.
+     * @return The thread count, 1 on Arduino targets.
+     */
+    uint8_t GetThreadCount() const;
+};
@@ -0,0 +1,54 @@
+/**
+ * @file IDisplayDriver.h
+ * @brief Declares the IDisplayDriver interface for asynchronous frame output.
+ *
+ * Display hardware such as LED matrices driven by DMA outputs a frame while the processor
+ * keeps working. IDisplayDriver exposes that as a non-blocking submit followed by completion
+ * polling, so the caller can compute the next frame during output.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "../../core/color/rgbcolor.hpp"
+
+/**
+ * @class IDisplayDriver
+ * @brief Interface for drivers that output frame buffers in the background.
+ *
+ * A frame is made of one buffer per camera. After a successful Submit the buffers and the
+ * arrays describing them are owned by the driver until IsComplete returns true, and must not
+ * be modified in the meantime.
+ */
+class IDisplayDriver {
+public:
+    virtual ~IDisplayDriver() = default;
+
+    /**
+     * @brief Starts outputting a frame and returns without waiting for it.
+     *
+     * @param buffers Array of bufferCount pixel color buffers.
+     * @param pixelCounts Number of pixels in each buffer.
+     * @param bufferCount Number of buffers in the frame.
+     * @return False if the previous frame is still being output or the driver is unavailable.
+     */
+    virtual bool Submit(const RGBColor* const* buffers, const uint16_t* pixelCounts, uint8_t bufferCount) = 0;
+
+    /**
+     * @brief Checks if the last submitted frame has been output.
+     *
+     * @return True once the buffers of the last frame may be modified again.
+     */
+    virtual bool IsComplete() = 0;
+
+    /**
+     * @brief Blocks until the last submitted frame has been output.
+     */
+    virtual void Wait() {
+        while (!IsComplete()) {}
+    }
+};
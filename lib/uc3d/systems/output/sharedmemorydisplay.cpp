@@ -0,0 +1,153 @@
+#include "sharedmemorydisplay.hpp"
+
+#if !defined(ARDUINO)
+
+#if defined(__unix__) || defined(__APPLE__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "Ring counters must be lock-free to be shared between processes");
+
+SharedMemoryDisplay::SharedMemoryDisplay(const char* path, uint32_t maxPixels, uint32_t slotCount) : maxPixels(maxPixels) {
+#if defined(__unix__) || defined(__APPLE__)
+    // Frames are spread over the slots by modulo, an empty ring cannot hold any
+    if (slotCount == 0) return;
+
+    // Slots stay 4-byte aligned so their atomic sequence numbers are aligned
+    uint32_t slotSize = (uint32_t(sizeof(SlotHeader)) + maxPixels * 3 + 3) & ~uint32_t(3);
+    uint32_t size = uint32_t(sizeof(Header)) + slotSize * slotCount;
+    int file = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    if (file < 0) return;
+
+    if (ftruncate(file, off_t(size)) == 0) {
+        void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+
+        if (memory != MAP_FAILED) {
+            mapping = static_cast<uint8_t*>(memory);
+            mappingSize = size;
+        }
+    }
+
+    // The mapping keeps the file alive
+    close(file);
+
+    if (!mapping) return;
+
+    Header* header = reinterpret_cast<Header*>(mapping);
+
+    header->magic = kMagic;
+    header->slotCount = slotCount;
+    header->slotSize = slotSize;
+    header->written.store(0);
+
+    writer = std::thread(&SharedMemoryDisplay::WriterLoop, this);
+#else
+    (void)path;
+    (void)slotCount;
+#endif
+}
+
+SharedMemoryDisplay::~SharedMemoryDisplay() {
+    if (!mapping) return;
+
+    Wait();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+
+    changed.notify_all();
+    writer.join();
+
+#if defined(__unix__) || defined(__APPLE__)
+    munmap(mapping, mappingSize);
+#endif
+}
+
+void SharedMemoryDisplay::WriterLoop() {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [&] { return stop || pending.load(); });
+
+            if (stop) return;
+        }
+
+        WriteFrame();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending.store(false);
+        }
+
+        changed.notify_all();
+    }
+}
+
+void SharedMemoryDisplay::WriteFrame() {
+    Header* header = reinterpret_cast<Header*>(mapping);
+    uint8_t* slot = mapping + sizeof(Header) + ((frame - 1) % header->slotCount) * header->slotSize;
+    SlotHeader* slotHeader = reinterpret_cast<SlotHeader*>(slot);
+    uint8_t* pixels = slot + sizeof(SlotHeader);
+    uint32_t pixelCount = 0;
+
+    slotHeader->sequence.store(0);
+
+    // Keeps the pixel stores below from becoming visible before the slot is marked as being written
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (uint8_t i = 0; i < bufferCount; i++) {
+        const RGBColor* colors = buffers[i];
+
+        for (uint16_t j = 0; j < pixelCounts[i] && pixelCount < maxPixels; j++, pixelCount++) {
+            pixels[pixelCount * 3] = colors[j].R;
+            pixels[pixelCount * 3 + 1] = colors[j].G;
+            pixels[pixelCount * 3 + 2] = colors[j].B;
+        }
+    }
+
+    slotHeader->pixelCount = pixelCount;
+    slotHeader->sequence.store(frame, std::memory_order_release);
+    header->written.store(frame, std::memory_order_release);
+}
+
+bool SharedMemoryDisplay::IsOpen() const {
+    return mapping != nullptr;
+}
+
+uint32_t SharedMemoryDisplay::GetFramesWritten() const {
+    return mapping ? reinterpret_cast<const Header*>(mapping)->written.load(std::memory_order_acquire) : 0;
+}
+
+bool SharedMemoryDisplay::Submit(const RGBColor* const* buffers, const uint16_t* pixelCounts, uint8_t bufferCount) {
+    if (!mapping || pending.load()) return false;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        this->buffers = buffers;
+        this->pixelCounts = pixelCounts;
+        this->bufferCount = bufferCount;
+        frame++;
+        pending.store(true);
+    }
+
+    changed.notify_all();
+
+    return true;
+}
+
+bool SharedMemoryDisplay::IsComplete() {
+    return !pending.load();
+}
+
+void SharedMemoryDisplay::Wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    changed.wait(lock, [&] { return !pending.load(); });
+}
+
+#endif
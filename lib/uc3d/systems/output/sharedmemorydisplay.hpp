@@ -0,0 +1,116 @@
+/**
+ * @file SharedMemoryDisplay.h
+ * @brief Declares the SharedMemoryDisplay class, a native stand-in for display hardware.
+ *
+ * SharedMemoryDisplay writes frames into a ring of slots in a memory-mapped file, from a
+ * background thread standing in for DMA. Mapping a file under /dev/shm shares the ring with
+ * other processes, such as a previewer or a throughput monitor, without any hardware.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#if !defined(ARDUINO)
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include "idisplaydriver.hpp"
+
+/**
+ * @class SharedMemoryDisplay
+ * @brief Outputs frames to a memory-mapped ring file on native targets.
+ *
+ * The file starts with a Header followed by slotCount slots. Each slot holds a SlotHeader
+ * and the RGB bytes of every buffer of one frame, back to back. Frames are numbered from 1
+ * and written to slot (frame - 1) % slotCount. A slot's sequence is zero while it is being
+ * written and set to the frame number afterwards, then Header::written is advanced. Readers
+ * load Header::written, copy that slot, and discard the copy if the sequence changed.
+ */
+class SharedMemoryDisplay : public IDisplayDriver {
+public:
+    static constexpr uint32_t kMagic = 0x75633364; ///< Identifies the file layout, "uc3d".
+
+    /**
+     * @struct Header
+     * @brief Layout of the start of the ring file.
+     */
+    struct Header {
+        uint32_t magic; ///< Always kMagic.
+        uint32_t slotCount; ///< Number of slots in the ring.
+        uint32_t slotSize; ///< Size of each slot in bytes, including its SlotHeader.
+        std::atomic<uint32_t> written; ///< Number of the last completely written frame, 0 if none.
+    };
+
+    /**
+     * @struct SlotHeader
+     * @brief Layout of the start of every slot.
+     */
+    struct SlotHeader {
+        std::atomic<uint32_t> sequence; ///< Frame number stored in the slot, 0 while being written.
+        uint32_t pixelCount; ///< Number of RGB pixels following the header.
+    };
+
+private:
+    uint8_t* mapping = nullptr; ///< Start of the mapped file.
+    uint32_t mappingSize = 0; ///< Size of the mapped file in bytes.
+    uint32_t maxPixels; ///< Number of pixels each slot can hold.
+    uint32_t frame = 0; ///< Number of the last submitted frame.
+
+    const RGBColor* const* buffers = nullptr; ///< Buffers of the frame being written.
+    const uint16_t* pixelCounts = nullptr; ///< Pixel counts of the frame being written.
+    uint8_t bufferCount = 0; ///< Number of buffers of the frame being written.
+
+    std::thread writer; ///< Background thread writing frames into the ring.
+    std::mutex mutex; ///< Guards the pending frame and the stop flag.
+    std::condition_variable changed; ///< Signals a submitted frame, a finished frame or stop.
+    std::atomic<bool> pending{false}; ///< True from Submit until the frame is in the ring.
+    bool stop = false; ///< Set when the driver is destroyed.
+
+    /** @brief Writer thread main loop. */
+    void WriterLoop();
+
+    /** @brief Copies the pending frame into its slot and publishes it. */
+    void WriteFrame();
+
+public:
+    /**
+     * @brief Creates or replaces a ring file and starts the writer thread.
+     *
+     * @param path File to map, for example "/dev/shm/uc3d" for shared memory.
+     * @param maxPixels Largest total pixel count of a frame, over all buffers.
+     * @param slotCount Number of frames kept in the ring, the driver stays closed if zero.
+     */
+    SharedMemoryDisplay(const char* path, uint32_t maxPixels, uint32_t slotCount = 3);
+
+    /**
+     * @brief Finishes the pending frame, stops the writer thread and unmaps the file.
+     */
+    ~SharedMemoryDisplay();
+
+    SharedMemoryDisplay(const SharedMemoryDisplay&) = delete;
+    SharedMemoryDisplay& operator=(const SharedMemoryDisplay&) = delete;
+
+    /**
+     * @brief Checks if the ring file was created and mapped.
+     * @return True if frames can be submitted.
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Retrieves the number of frames written into the ring.
+     * @return The frame count.
+     */
+    uint32_t GetFramesWritten() const;
+
+    bool Submit(const RGBColor* const* buffers, const uint16_t* pixelCounts, uint8_t bufferCount) override;
+    bool IsComplete() override;
+    void Wait() override;
+};
+
+#endif
@@ -26,7 +26,7 @@
 template<size_t pixelCount>
 class Camera : public CameraBase {
 private:
-    PixelGroup<pixelCount>* pixelGroup; ///< Pointer to the associated PixelGroup instance.
+    LayoutPixelGroup<pixelCount>* pixelGroup; ///< Pointer to the associated PixelGroup instance.
     Vector2D maxC; ///< Cached maximum coordinate of the camera.
     Vector2D minC; ///< Cached minimum coordinate of the camera.
     bool calculatedMax = false; ///< Indicates if the maximum coordinate has been calculated.
@@ -39,7 +39,7 @@ public:
      * @param transform Pointer to the Transform associated with the camera.
      * @param pixelGroup Pointer to the PixelGroup associated with the camera.
      */
-    Camera(Transform* transform, PixelGroup<pixelCount>* pixelGroup);
+    Camera(Transform* transform, LayoutPixelGroup<pixelCount>* pixelGroup);
 
     /**
      * @brief Constructs a Camera with a transform, camera layout, and pixel group.
@@ -48,14 +48,14 @@ public:
      * @param cameraLayout Pointer to the CameraLayout for the camera.
      * @param pixelGroup Pointer to the PixelGroup associated with the camera.
      */
-    Camera(Transform* transform, CameraLayout* cameraLayout, PixelGroup<pixelCount>* pixelGroup);
+    Camera(Transform* transform, CameraLayout* cameraLayout, LayoutPixelGroup<pixelCount>* pixelGroup);
 
     /**
      * @brief Retrieves the associated PixelGroup.
      *
      * @return Pointer to the PixelGroup.
      */
-    PixelGroup<pixelCount>* GetPixelGroup() override;
+    LayoutPixelGroup<pixelCount>* GetPixelGroup() override;
 
     /**
      * @brief Retrieves the minimum coordinate of the camera.
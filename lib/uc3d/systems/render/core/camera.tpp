@@ -1,7 +1,7 @@
 #pragma once
 
 template<size_t pixelCount>
-Camera<pixelCount>::Camera(Transform* transform, PixelGroup<pixelCount>* pixelGroup) {
+Camera<pixelCount>::Camera(Transform* transform, LayoutPixelGroup<pixelCount>* pixelGroup) {
     this->transform = transform;
     this->pixelGroup = pixelGroup;
 
@@ -9,7 +9,7 @@ Camera<pixelCount>::Camera(Transform* transform, PixelGroup<pixelCount>* pixelGr
 }
 
 template<size_t pixelCount>
-Camera<pixelCount>::Camera(Transform* transform, CameraLayout* cameraLayout, PixelGroup<pixelCount>* pixelGroup) {
+Camera<pixelCount>::Camera(Transform* transform, CameraLayout* cameraLayout, LayoutPixelGroup<pixelCount>* pixelGroup) {
     this->transform = transform;
     this->pixelGroup = pixelGroup;
     this->cameraLayout = cameraLayout;
@@ -20,16 +20,20 @@ Camera<pixelCount>::Camera(Transform* transform, CameraLayout* cameraLayout, Pix
 }
 
 template<size_t pixelCount>
-PixelGroup<pixelCount>* Camera<pixelCount>::GetPixelGroup() {
+LayoutPixelGroup<pixelCount>* Camera<pixelCount>::GetPixelGroup() {
     return pixelGroup;
 }
 
 template<size_t pixelCount>
 Vector2D Camera<pixelCount>::GetCameraMinCoordinate() {
     if(!calculatedMin){
-        for(uint16_t i = 0; i < pixelGroup->GetPixelCount(); i++){
-            minC.X = pixelGroup->GetCoordinate(i).X < minC.X ? pixelGroup->GetCoordinate(i).X : minC.X;
-            minC.Y = pixelGroup->GetCoordinate(i).Y < minC.Y ? pixelGroup->GetCoordinate(i).Y : minC.Y;
+        PixelCoordinates coordinates = pixelGroup->GetCoordinates();
+
+        minC = coordinates[0];
+
+        for(Vector2D coordinate : coordinates){
+            minC.X = coordinate.X < minC.X ? coordinate.X : minC.X;
+            minC.Y = coordinate.Y < minC.Y ? coordinate.Y : minC.Y;
         }
 
         calculatedMin = true;
@@ -41,9 +45,13 @@ Vector2D Camera<pixelCount>::GetCameraMinCoordinate() {
 template<size_t pixelCount>
 Vector2D Camera<pixelCount>::GetCameraMaxCoordinate() {
     if(!calculatedMax){
-        for(uint16_t i = 0; i < pixelGroup->GetPixelCount(); i++){
-            maxC.X = pixelGroup->GetCoordinate(i).X > maxC.X ? pixelGroup->GetCoordinate(i).X : maxC.X;
-            maxC.Y = pixelGroup->GetCoordinate(i).Y > maxC.Y ? pixelGroup->GetCoordinate(i).Y : maxC.Y;
+        PixelCoordinates coordinates = pixelGroup->GetCoordinates();
+
+        maxC = coordinates[0];
+
+        for(Vector2D coordinate : coordinates){
+            maxC.X = coordinate.X > maxC.X ? coordinate.X : maxC.X;
+            maxC.Y = coordinate.Y > maxC.Y ? coordinate.Y : maxC.Y;
         }
 
         calculatedMax = true;
@@ -10,6 +10,36 @@ Transform* CameraBase::GetTransform() {
     return transform;
 }
 
+const CameraProjection& CameraBase::GetProjection() {
+    transform->SetBaseRotation(cameraLayout->GetRotation());
+
+    if (!projection.IsCurrent(*transform, lookOffset)) {
+        projection.Update(*transform, lookOffset);
+    }
+
+    return projection;
+}
+
+FrameHistory* CameraBase::GetFrameHistory() {
+    return &history;
+}
+
+ResolutionScaler* CameraBase::GetResolutionScaler() {
+    return &resolutionScaler;
+}
+
+RasterScratch* CameraBase::GetRasterScratch() {
+    return &rasterScratch;
+}
+
+void CameraBase::SetShadingRate(uint8_t rate) {
+    shadingRate = rate > 0 ? rate : 1;
+}
+
+uint8_t CameraBase::GetShadingRate() const {
+    return shadingRate;
+}
+
 bool CameraBase::Is2D() {
     return is2D;
 }
@@ -12,7 +12,11 @@
 #pragma once
 
 #include "cameralayout.hpp" // Include for camera layout management.
+#include "cameraprojection.hpp" // Include for cached projection constants.
+#include "framehistory.hpp" // Include for incremental rendering.
 #include "ipixelgroup.hpp" // Include for pixel group interface.
+#include "resolutionscaler.hpp" // Include for reduced-resolution rendering.
+#include "../raster/helpers/rasterscratch.hpp" // Include for the rasterizer's working arrays.
 #include "../../../core/math/transform.hpp" // Include for transformation utilities.
 
 /**
@@ -29,6 +33,11 @@ protected:
     CameraLayout* cameraLayout; ///< Pointer to the camera's layout information.
     Quaternion lookOffset; ///< Look offset for the camera's orientation.
     bool is2D = false; ///< Flag indicating whether the camera operates in 2D mode.
+    CameraProjection projection; ///< Projection constants cached for the current transform.
+    FrameHistory history; ///< What the camera rendered last frame, disabled by default.
+    uint8_t shadingRate = 1; ///< Pixel spacing of shaded samples on grid layouts.
+    ResolutionScaler resolutionScaler; ///< Internal grid rendered instead of the pixels, inactive by default.
+    RasterScratch rasterScratch; ///< Working arrays of the rasterizer, kept between frames.
 
 public:
     /**
@@ -99,6 +108,64 @@ public:
      */
     Transform* GetTransform();
 
+    /**
+     * @brief Retrieves the projection constants of the camera.
+     *
+     * Applies the layout rotation to the transform and recomputes the constants only if
+     * the transform version or look offset changed since the last call. Only valid for
+     * cameras with a layout.
+     *
+     * @return Reference to the cached projection.
+     */
+    const CameraProjection& GetProjection();
+
+    /**
+     * @brief Retrieves the history used to only shade the changed region of each frame.
+     *
+     * Enable it with FrameHistory::SetEnabled, only the renderer may then write to the
+     * camera's pixel colors.
+     *
+     * @return Pointer to the FrameHistory.
+     */
+    FrameHistory* GetFrameHistory();
+
+    /**
+     * @brief Retrieves the scaler used to render at a reduced resolution.
+     *
+     * Set a scale below 1 with ResolutionScaler::SetScale, or a render time budget with
+     * ResolutionScaler::SetDynamic, to rasterize an internal grid and upscale it.
+     *
+     * @return Pointer to the ResolutionScaler.
+     */
+    ResolutionScaler* GetResolutionScaler();
+
+    /**
+     * @brief Retrieves the working arrays the rasterizer reuses between frames.
+     *
+     * @return Pointer to the RasterScratch.
+     */
+    RasterScratch* GetRasterScratch();
+
+    /**
+     * @brief Sets the default spacing of shaded pixels for grid layouts.
+     *
+     * With a rate of 2 or 4 only every 2nd or 4th pixel of each row and column is shaded and
+     * the pixels in between are interpolated, unless they lie on a triangle or material edge.
+     * Materials with their own rate override it, see IMaterial::SetShadingRate. Cameras with
+     * arbitrary pixel positions shade at full rate unless they render through the grid of
+     * their ResolutionScaler.
+     *
+     * @param rate Pixel spacing, 1 shades every pixel.
+     */
+    void SetShadingRate(uint8_t rate);
+
+    /**
+     * @brief Retrieves the default spacing of shaded pixels.
+     *
+     * @return The shading rate.
+     */
+    uint8_t GetShadingRate() const;
+
     /**
      * @brief Checks if the camera operates in 2D mode.
      *
@@ -0,0 +1,27 @@
+#include "cameraprojection.hpp"
+
+bool CameraProjection::IsCurrent(const Transform& transform, const Quaternion& lookOffset) const {
+    return this->transform == &transform && version == transform.GetVersion() && this->lookOffset.IsEqual(lookOffset);
+}
+
+void CameraProjection::Update(const Transform& transform, const Quaternion& lookOffset) {
+    this->transform = &transform;
+    this->version = transform.GetVersion();
+    this->lookOffset = lookOffset;
+
+    // The look direction is applied on top of the camera rotation, matching the original projection
+    Quaternion lookDirection = transform.GetRotation().Multiply(lookOffset);
+
+    position = transform.GetPosition();
+    scale = transform.GetScale();
+    rotation = transform.GetRotation().Multiply(lookDirection);
+    inverseRotation = rotation.Conjugate();
+
+    right = rotation.RotateVector(Vector3D(scale.X, 0.0f, 0.0f));
+    up = rotation.RotateVector(Vector3D(0.0f, scale.Y, 0.0f));
+    direction = rotation.RotateVector(Vector3D(0.0f, 0.0f, 1.0f)).UnitSphere();
+}
+
+bool CameraProjection::Matches(const CameraProjection& other) const {
+    return position.IsEqual(other.position) && scale.IsEqual(other.scale) && rotation.IsEqual(other.rotation);
+}
@@ -0,0 +1,101 @@
+/**
+ * @file CameraProjection.h
+ * @brief Declares the CameraProjection class caching the projection constants of a camera.
+ *
+ * The camera transform, layout rotation and look offset rarely change between frames, yet
+ * every projected vertex and every primary ray is derived from them. CameraProjection
+ * derives the rotations and the camera basis once and is only refreshed when the camera
+ * transform version or look offset changes.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "../../../core/math/transform.hpp" // Include for the camera transform.
+#include "../../../core/math/quaternion.hpp"
+#include "../../../core/math/vector2d.hpp"
+#include "../../../core/math/vector3d.hpp"
+
+/**
+ * @class CameraProjection
+ * @brief Projection constants shared by the rasterizer and the ray tracer.
+ *
+ * Pixel coordinates lie in the camera plane, scaled and rotated by the camera transform.
+ * Points are projected into that plane with Project, and the primary ray of a pixel starts
+ * at GetRayOrigin and travels along GetDirection.
+ */
+class CameraProjection {
+private:
+    const Transform* transform = nullptr; ///< Transform the constants were derived from.
+    uint32_t version = 0; ///< Version of the transform the constants were derived from.
+    Quaternion lookOffset; ///< Look offset the constants were derived from.
+
+    Vector3D position; ///< Position of the camera.
+    Vector3D scale; ///< Scale of the camera plane.
+    Quaternion rotation; ///< Rotation from camera space to world space.
+    Quaternion inverseRotation; ///< Rotation from world space to camera space.
+    Vector3D right; ///< World-space offset of one unit along the pixel X axis.
+    Vector3D up; ///< World-space offset of one unit along the pixel Y axis.
+    Vector3D direction; ///< Normalized world-space direction of every primary ray.
+
+public:
+    /**
+     * @brief Checks if the constants were derived from the current state of a camera.
+     *
+     * @param transform Camera transform, with the layout rotation already applied as base rotation.
+     * @param lookOffset Look offset of the camera.
+     * @return True if the constants are up to date.
+     */
+    bool IsCurrent(const Transform& transform, const Quaternion& lookOffset) const;
+
+    /**
+     * @brief Derives the constants from a camera.
+     *
+     * @param transform Camera transform, with the layout rotation already applied as base rotation.
+     * @param lookOffset Look offset of the camera.
+     */
+    void Update(const Transform& transform, const Quaternion& lookOffset);
+
+    /**
+     * @brief Checks if another projection maps every point to the same camera space.
+     *
+     * Cameras with matching projections see the same projected triangles and only differ
+     * in which pixel coordinates they sample.
+     *
+     * @param other The projection to compare with.
+     * @return True if the position, scale and rotation are equal.
+     */
+    bool Matches(const CameraProjection& other) const;
+
+    /**
+     * @brief Projects a world-space point into camera space.
+     *
+     * @param point The world-space point.
+     * @return X and Y in pixel coordinates, Z as depth along the view, smaller is closer.
+     */
+    Vector3D Project(const Vector3D& point) const {
+        return inverseRotation.RotateVector(point - position) / scale;
+    }
+
+    /**
+     * @brief Retrieves the world-space point on the camera plane under a pixel.
+     *
+     * @param pixel Pixel coordinate.
+     * @return The origin of the pixel's primary ray.
+     */
+    Vector3D GetRayOrigin(const Vector2D& pixel) const {
+        return position + right * pixel.X + up * pixel.Y;
+    }
+
+    Vector3D GetPosition() const { return position; } ///< Position of the camera.
+    Vector3D GetScale() const { return scale; } ///< Scale of the camera plane.
+    Quaternion GetRotation() const { return rotation; } ///< Rotation from camera space to world space.
+    Quaternion GetInverseRotation() const { return inverseRotation; } ///< Rotation from world space to camera space.
+    Vector3D GetRight() const { return right; } ///< World-space offset of one unit along the pixel X axis.
+    Vector3D GetUp() const { return up; } ///< World-space offset of one unit along the pixel Y axis.
+    Vector3D GetDirection() const { return direction; } ///< Normalized direction of every primary ray.
+};
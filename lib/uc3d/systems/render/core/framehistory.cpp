@@ -0,0 +1,128 @@
+#include "framehistory.hpp"
+
+FrameHistory::~FrameHistory() {
+    delete[] entries;
+    delete[] matched;
+    delete[] hits;
+}
+
+void FrameHistory::SetEnabled(bool enabled) {
+    this->enabled = enabled;
+
+    Invalidate();
+}
+
+bool FrameHistory::IsEnabled() const {
+    return enabled;
+}
+
+void FrameHistory::Invalidate() {
+    valid = false;
+}
+
+void FrameHistory::Include(Region& region, const Vector2D& minimum, const Vector2D& maximum) {
+    region.minimum = Vector2D::Minimum(region.minimum, minimum);
+    region.maximum = Vector2D::Maximum(region.maximum, maximum);
+}
+
+FrameHistory::Region FrameHistory::Update(const CameraProjection& projection, const Entry* current, uint8_t count) {
+    Region region{ Vector2D(Mathematics::FLTMAX, Mathematics::FLTMAX), Vector2D(-Mathematics::FLTMAX, -Mathematics::FLTMAX), false };
+
+    if (!enabled) {
+        region.full = true;
+        return region;
+    }
+
+    if (!valid || !projection.Matches(this->projection)) {
+        region.full = true;
+    } else {
+        for (uint8_t j = 0; j < entryCount; ++j) {
+            matched[j] = false;
+        }
+
+        for (uint8_t i = 0; i < count; ++i) {
+            const Entry& entry = current[i];
+            uint8_t j = i;
+
+            // Meshes keep their order between frames unless one is toggled, try the same slot first
+            if (j >= entryCount || entries[j].mesh != entry.mesh) {
+                for (j = 0; j < entryCount; ++j) {
+                    if (!matched[j] && entries[j].mesh == entry.mesh) break;
+                }
+            }
+
+            if (j == entryCount) {
+                Include(region, entry.minimum, entry.maximum);
+                continue;
+            }
+
+            const Entry& previous = entries[j];
+
+            matched[j] = true;
+
+            bool moved = previous.minimum.X != entry.minimum.X || previous.minimum.Y != entry.minimum.Y ||
+                         previous.maximum.X != entry.maximum.X || previous.maximum.Y != entry.maximum.Y;
+
+            if (moved || previous.version != entry.version || previous.materialVersion != entry.materialVersion) {
+                Include(region, previous.minimum, previous.maximum);
+                Include(region, entry.minimum, entry.maximum);
+            }
+        }
+
+        // Meshes that were removed or disabled leave their old area behind
+        for (uint8_t j = 0; j < entryCount; ++j) {
+            if (!matched[j]) Include(region, entries[j].minimum, entries[j].maximum);
+        }
+    }
+
+    if (count > capacity) {
+        delete[] entries;
+        delete[] matched;
+
+        capacity = count;
+        entries = new Entry[capacity];
+        matched = new bool[capacity];
+    }
+
+    for (uint8_t i = 0; i < count; ++i) {
+        entries[i] = current[i];
+    }
+
+    entryCount = count;
+    this->projection = projection;
+    valid = true;
+
+    return region;
+}
+
+void FrameHistory::SetHitCacheEnabled(bool enabled) {
+    cacheHits = enabled;
+
+    if (!enabled) {
+        delete[] hits;
+
+        hits = nullptr;
+        hitCount = 0;
+    }
+}
+
+uint32_t* FrameHistory::GetHits(uint16_t pixelCount) {
+    if (!cacheHits) return nullptr;
+
+    if (!hits || hitCount != pixelCount) {
+        delete[] hits;
+
+        hitCount = pixelCount;
+        hits = new uint32_t[hitCount];
+
+        for (uint16_t i = 0; i < hitCount; ++i) {
+            hits[i] = kNoHit;
+        }
+    }
+
+    return hits;
+}
+
+TriangleCache* FrameHistory::GetTriangleCache() {
+    return &triangleCache;
+}
@@ -0,0 +1,179 @@
+/**
+ * @file FrameHistory.h
+ * @brief Declares the FrameHistory class remembering what a camera rendered last frame.
+ *
+ * Most frames only change a small part of the image, such as blinking eyes or a moving
+ * mouth. FrameHistory keeps the versions and the projected bounds of every mesh a camera
+ * rendered, and compares them with the next frame to find the screen region that has to be
+ * shaded again. Pixels outside of it keep their colors from the previous frame.
+ *
+ * Animations move slowly relative to the pixel pitch, so a pixel usually shows the same
+ * triangle as in the previous frame. FrameHistory also remembers that triangle per pixel so
+ * the rasterizer can test it first and reject most other candidates by depth.
+ *
+ * Finally, it holds the projected triangles of the previous frame so meshes that did not
+ * move are not projected again, see TriangleCache.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "cameraprojection.hpp" // Include for the projection the bounds are measured in.
+#include "../raster/helpers/trianglecache.hpp" // Include for the projected triangles of the last frame.
+#include "../../../core/math/vector2d.hpp"
+
+class Mesh;
+
+/**
+ * @class FrameHistory
+ * @brief Finds the region of a camera that changed since the previous frame.
+ *
+ * The whole camera is dirty on the first frame, after Invalidate, and whenever the projection
+ * changes. Otherwise the region is the union of the old and the new bounds of every mesh whose
+ * versions or bounds changed, including meshes that appeared or disappeared. Colors written
+ * into the pixel group by anything other than the renderer, such as in-place post effects,
+ * are not tracked, so the history must be invalidated or left disabled in that case.
+ *
+ * Hits are identified by the index of the mesh in the scene and of the triangle in the mesh,
+ * which stay valid when other meshes are toggled. A stale hit only costs one extra test, the
+ * rasterizer checks that the triangle still covers the pixel before using it.
+ */
+class FrameHistory {
+public:
+    static constexpr uint32_t kNoHit = 0xFFFFFFFF; ///< Hit of pixels that showed no triangle.
+    static constexpr uint8_t kTriangleBits = 24; ///< Low bits of a hit holding the triangle index.
+
+    /**
+     * @struct Entry
+     * @brief State of one mesh as seen by the camera.
+     */
+    struct Entry {
+        const Mesh* mesh; ///< The mesh, used to match entries between frames.
+        uint32_t version; ///< Version of the mesh, see Mesh::GetVersion.
+        uint32_t materialVersion; ///< Version of the material of the mesh, see IMaterial::GetVersion.
+        Vector2D minimum; ///< Minimum corner of the projected bounds.
+        Vector2D maximum; ///< Maximum corner of the projected bounds.
+    };
+
+    /**
+     * @struct Region
+     * @brief Pixel coordinates that must be shaded again.
+     */
+    struct Region {
+        Vector2D minimum; ///< Minimum corner of the dirty rectangle.
+        Vector2D maximum; ///< Maximum corner of the dirty rectangle.
+        bool full; ///< Set if every pixel must be shaded, the rectangle is ignored.
+
+        /** @brief Checks if no pixel must be shaded. */
+        bool IsEmpty() const {
+            return !full && (minimum.X > maximum.X || minimum.Y > maximum.Y);
+        }
+
+        /** @brief Checks if a pixel must be shaded. */
+        bool Contains(const Vector2D& pixel) const {
+            return full || (pixel.X >= minimum.X && pixel.X <= maximum.X && pixel.Y >= minimum.Y && pixel.Y <= maximum.Y);
+        }
+    };
+
+private:
+    Entry* entries = nullptr; ///< Meshes rendered in the previous frame.
+    uint8_t entryCount = 0; ///< Number of entries in use.
+    bool* matched = nullptr; ///< Marks the entries found again while comparing a frame.
+    uint8_t capacity = 0; ///< Allocated number of entries and marks.
+    CameraProjection projection; ///< Projection of the previous frame.
+    bool enabled = false; ///< Set if the camera renders incrementally.
+    bool valid = false; ///< Set once a frame has been recorded.
+    uint32_t* hits = nullptr; ///< Triangle shown by each pixel in the previous frame.
+    uint16_t hitCount = 0; ///< Number of pixels in the hit cache.
+#if defined(ARDUINO)
+    bool cacheHits = false; ///< Set if the hit cache is used.
+#else
+    bool cacheHits = true; ///< Set if the hit cache is used.
+#endif
+    TriangleCache triangleCache; ///< Projected triangles of the previous frame.
+
+    /** @brief Grows a region to cover a rectangle. */
+    static void Include(Region& region, const Vector2D& minimum, const Vector2D& maximum);
+
+public:
+    FrameHistory() = default;
+
+    /**
+     * @brief Releases the recorded entries, the hit cache and the cached triangles.
+     */
+    ~FrameHistory();
+
+    FrameHistory(const FrameHistory&) = delete;
+    FrameHistory& operator=(const FrameHistory&) = delete;
+
+    /**
+     * @brief Enables or disables incremental rendering, either way the next frame is full.
+     *
+     * @param enabled True to only shade the changed region from the next frame on.
+     */
+    void SetEnabled(bool enabled);
+
+    /**
+     * @brief Checks if incremental rendering is enabled.
+     */
+    bool IsEnabled() const;
+
+    /**
+     * @brief Forgets the previous frame so the next one is shaded in full.
+     */
+    void Invalidate();
+
+    /**
+     * @brief Compares a frame with the previous one and records it.
+     *
+     * @param projection Projection the bounds were measured in.
+     * @param current State of every mesh rendered in this frame.
+     * @param count Number of entries.
+     * @return The region that must be shaded, full if the history is disabled.
+     */
+    Region Update(const CameraProjection& projection, const Entry* current, uint8_t count);
+
+    /**
+     * @brief Enables or disables the per-pixel hit cache.
+     *
+     * The cache costs 4 bytes per pixel, so it is disabled by default on Arduino targets.
+     *
+     * @param enabled False to release the cache and test every candidate from scratch.
+     */
+    void SetHitCacheEnabled(bool enabled);
+
+    /**
+     * @brief Retrieves the hit cache, sized for a pixel count.
+     *
+     * The cache is reset to kNoHit whenever it is allocated or the pixel count changes.
+     *
+     * @param pixelCount Number of pixels of the camera.
+     * @return One hit per pixel, nullptr if the cache is disabled.
+     */
+    uint32_t* GetHits(uint16_t pixelCount);
+
+    /**
+     * @brief Retrieves the projected triangles of the previous frame.
+     *
+     * Cameras rendered as a group share one set of triangles, only the cache of the first
+     * camera of the group is used.
+     *
+     * @return Pointer to the TriangleCache.
+     */
+    TriangleCache* GetTriangleCache();
+
+    /**
+     * @brief Builds the hit identifying a triangle of a mesh.
+     *
+     * @param mesh Index of the mesh in the scene.
+     * @param triangle Index of the triangle in the mesh, below 2^kTriangleBits.
+     * @return The combined hit.
+     */
+    static uint32_t MakeHit(uint8_t mesh, uint32_t triangle) {
+        return (uint32_t(mesh) << kTriangleBits) | triangle;
+    }
+};
@@ -13,6 +13,7 @@
 
 #include "../../../core/color/rgbcolor.hpp" // Include for RGB color representation.
 #include "../../../core/geometry/2d/rectangle.hpp" // Include for 2D bounding box representation.
+#include "pixelcoordinates.hpp" // Include for streamed pixel coordinates.
 
 /**
  * @class IPixelGroup
@@ -33,6 +34,11 @@ public:
         MAXTOZERO  ///< Traverse from maximum to minimum indices.
     };
 
+    /**
+     * @brief Virtual destructor so pixel groups can be released through the interface.
+     */
+    virtual ~IPixelGroup() = default;
+
     /**
      * @brief Retrieves the center coordinate of the pixel group.
      *
@@ -55,6 +61,15 @@ public:
      */
     virtual Vector2D GetCoordinate(uint16_t count) = 0;
 
+    /**
+     * @brief Retrieves a view resolving the coordinates of every pixel without virtual calls.
+     *
+     * Prefer this over GetCoordinate when looping over all pixels.
+     *
+     * @return The coordinates of the pixel group.
+     */
+    virtual PixelCoordinates GetCoordinates() = 0;
+
     /**
      * @brief Retrieves the index of a pixel at a specific location.
      *
@@ -144,6 +159,26 @@ public:
      */
     virtual bool GetRightIndex(uint16_t count, uint16_t* rightIndex) = 0;
 
+    /**
+     * @brief Retrieves the pixel indices ordered row by row, from left to right.
+     *
+     * Each row is stored contiguously; consecutive entries belong to the same row
+     * as long as each entry is the right neighbor of the one before it.
+     *
+     * @return Pointer to an array of GetPixelCount() pixel indices.
+     */
+    virtual const uint16_t* GetRowOrder() = 0;
+
+    /**
+     * @brief Retrieves the pixel indices ordered column by column, from bottom to top.
+     *
+     * Each column is stored contiguously; consecutive entries belong to the same column
+     * as long as each entry is the up neighbor of the one before it.
+     *
+     * @return Pointer to an array of GetPixelCount() pixel indices.
+     */
+    virtual const uint16_t* GetColumnOrder() = 0;
+
     /**
      * @brief Retrieves an alternate X-axis index for a given pixel.
      *
@@ -0,0 +1,159 @@
+/**
+ * @file LayoutPixelGroup.h
+ * @brief Declares the LayoutPixelGroup template class, a pixel group over a layout it does not own.
+ *
+ * This file defines the LayoutPixelGroup class, which implements the IPixelGroup interface
+ * to manage a fixed number of pixels whose spatial tables live in a separate PixelLayout.
+ *
+ * @date 16/10/2026
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <cstddef>
+#include "ipixelgroup.hpp" // Include for the base pixel group interface.
+#include "pixellayout.hpp" // Include for the neighbor tables and bounds.
+#include "../../../core/geometry/2d/overlap.hpp"
+
+/**
+ * @class LayoutPixelGroup
+ * @brief Manages a collection of pixels with colors, reading their spatial relationships from a PixelLayout.
+ *
+ * The group only keeps a pointer to its layout, so a constexpr layout placed in flash costs
+ * neither startup time nor RAM for its tables and can be shared by several groups:
+ * @code
+ * UC3D_FLASH constexpr PixelLayout<4> layout(positions);
+ *
+ * LayoutPixelGroup<4> pixelGroup(layout);
+ * @endcode
+ *
+ * Cameras accept any LayoutPixelGroup. PixelGroup derives from it to build and own its layout
+ * at runtime.
+ *
+ * @tparam pixelCount The total number of pixels in the group.
+ */
+template<size_t pixelCount>
+class LayoutPixelGroup : public IPixelGroup {
+private:
+    const PixelLayout<pixelCount>* layout; ///< Spatial tables and bounds of the pixels.
+    RGBColor pixelColors[pixelCount]; ///< Array of pixel colors.
+    RGBColor pixelBuffer[pixelCount]; ///< Array of color buffers for temporary use.
+    uint8_t jumpLevels = 0; ///< Number of power-of-two jump levels above the neighbor tables.
+    uint16_t* jumpTables = nullptr; ///< Jump tables, pixelCount entries per neighbor and level.
+
+    /**
+     * @enum Neighbor
+     * @brief Identifies the neighbor tables used for walking and jumping.
+     */
+    enum Neighbor : uint8_t {
+        UP,
+        DOWN,
+        LEFT,
+        RIGHT
+    };
+
+    /**
+     * @brief Retrieves the table mapping each pixel to the pixel 2^level steps away.
+     *
+     * @param neighbor Direction of the steps.
+     * @param level Jump level, 0 returns the neighbor table itself.
+     * @return Pointer to an array of pixelCount indices.
+     */
+    const uint16_t* GetJumpTable(Neighbor neighbor, uint8_t level) const;
+
+    /**
+     * @brief Walks a number of steps in one direction using the largest available jumps.
+     *
+     * @param neighbor Direction of the steps.
+     * @param index Starting pixel index.
+     * @param steps Number of steps to take.
+     * @return The reached pixel index, or 65535 if the walk leaves the group.
+     */
+    uint16_t Jump(Neighbor neighbor, uint16_t index, int steps) const;
+
+    /**
+     * @brief Retrieves an offset index in a rectangular group directly from its row and column.
+     *
+     * @param count The index of the current pixel.
+     * @param index Pointer to store the offset index.
+     * @param x1 The X-axis offset value.
+     * @param y1 The Y-axis offset value.
+     * @return True if the offset pixel lies within the grid, otherwise false.
+     */
+    bool GetGridOffsetIndex(uint16_t count, uint16_t* index, int x1, int y1) const;
+
+    /**
+     * @brief Rebuilds the jump tables from the current neighbor tables.
+     */
+    void BuildJumpTables();
+
+protected:
+    /**
+     * @brief Constructs a group over a layout that may not be built yet.
+     *
+     * The layout is only read once the group is used, so derived classes may pass a layout
+     * they construct after this base.
+     *
+     * @param layout Layout of the pixels, must outlive the group.
+     */
+    explicit LayoutPixelGroup(const PixelLayout<pixelCount>* layout);
+
+public:
+    /**
+     * @brief Constructs a LayoutPixelGroup over a precomputed layout.
+     *
+     * No neighbor tables are computed or copied, GridSort only rebuilds the jump tables.
+     *
+     * @param layout Layout of the pixels, must outlive the group.
+     */
+    explicit LayoutPixelGroup(const PixelLayout<pixelCount>& layout);
+
+    /**
+     * @brief Destroys the LayoutPixelGroup object.
+     */
+    ~LayoutPixelGroup();
+
+    LayoutPixelGroup(const LayoutPixelGroup&) = delete;
+    LayoutPixelGroup& operator=(const LayoutPixelGroup&) = delete;
+
+    /**
+     * @brief Enables power-of-two jump tables for offset and radial lookups.
+     *
+     * Each level doubles the stride of the level below, so an offset of r pixels takes
+     * O(log r) table reads for r below 2^levels instead of r neighbor steps. Rectangular
+     * groups resolve offsets from their row and column directly and do not need the tables.
+     * Radial lookups keep the order of their walk and jump over each straight run of it.
+     * Costs 8 bytes per pixel per level, passing 0 releases the tables.
+     *
+     * @param levels Number of jump levels above the neighbor tables.
+     */
+    void EnableJumpTables(uint8_t levels);
+
+    Vector2D GetCenterCoordinate() override;
+    Vector2D GetSize() override;
+    Vector2D GetCoordinate(uint16_t count) override;
+    PixelCoordinates GetCoordinates() override;
+    int GetPixelIndex(Vector2D location) override;
+    RGBColor* GetColor(uint16_t count) override;
+    RGBColor* GetColors() override;
+    RGBColor* GetColorBuffer() override;
+    uint16_t GetPixelCount() override;
+    bool Overlaps(Rectangle2D* box) override;
+    bool ContainsVector2D(Vector2D v) override;
+    bool GetUpIndex(uint16_t count, uint16_t* upIndex) override;
+    bool GetDownIndex(uint16_t count, uint16_t* downIndex) override;
+    bool GetLeftIndex(uint16_t count, uint16_t* leftIndex) override;
+    bool GetRightIndex(uint16_t count, uint16_t* rightIndex) override;
+    const uint16_t* GetRowOrder() override;
+    const uint16_t* GetColumnOrder() override;
+    bool GetAlternateXIndex(uint16_t count, uint16_t* index) override;
+    bool GetAlternateYIndex(uint16_t count, uint16_t* index) override;
+    bool GetOffsetXIndex(uint16_t count, uint16_t* index, int x1) override;
+    bool GetOffsetYIndex(uint16_t count, uint16_t* index, int y1) override;
+    bool GetOffsetXYIndex(uint16_t count, uint16_t* index, int x1, int y1) override;
+    bool GetRadialIndex(uint16_t count, uint16_t* index, int pixels, float angle) override;
+    void GridSort() override;
+};
+
+#include "layoutpixelgroup.tpp" // Include the template implementation.
@@ -0,0 +1,308 @@
+#pragma once
+
+template<size_t pixelCount>
+LayoutPixelGroup<pixelCount>::LayoutPixelGroup(const PixelLayout<pixelCount>* layout) : layout(layout) {}
+
+template<size_t pixelCount>
+LayoutPixelGroup<pixelCount>::LayoutPixelGroup(const PixelLayout<pixelCount>& layout) : layout(&layout) {}
+
+template<size_t pixelCount>
+LayoutPixelGroup<pixelCount>::~LayoutPixelGroup(){
+    delete[] jumpTables;
+}
+
+template<size_t pixelCount>
+void LayoutPixelGroup<pixelCount>::EnableJumpTables(uint8_t levels){
+    delete[] jumpTables;
+
+    jumpLevels = levels;
+    jumpTables = levels > 0 ? new uint16_t[4 * size_t(levels) * pixelCount] : nullptr;
+
+    BuildJumpTables();
+}
+
+template<size_t pixelCount>
+void LayoutPixelGroup<pixelCount>::BuildJumpTables(){
+    for (uint8_t neighbor = UP; neighbor <= RIGHT; neighbor++){
+        for (uint8_t level = 1; level <= jumpLevels; level++){
+            const uint16_t* previous = GetJumpTable(Neighbor(neighbor), level - 1);
+            uint16_t* current = &jumpTables[(neighbor * jumpLevels + level - 1) * pixelCount];
+
+            for (uint16_t i = 0; i < pixelCount; i++){
+                current[i] = previous[i] < 65535 ? previous[previous[i]] : 65535;
+            }
+        }
+    }
+}
+
+template<size_t pixelCount>
+const uint16_t* LayoutPixelGroup<pixelCount>::GetJumpTable(Neighbor neighbor, uint8_t level) const {
+    if (level > 0) return &jumpTables[(neighbor * jumpLevels + level - 1) * pixelCount];
+
+    switch (neighbor){
+        case UP: return layout->GetUp();
+        case DOWN: return layout->GetDown();
+        case LEFT: return layout->GetLeft();
+        default: return layout->GetRight();
+    }
+}
+
+template<size_t pixelCount>
+uint16_t LayoutPixelGroup<pixelCount>::Jump(Neighbor neighbor, uint16_t index, int steps) const {
+    const uint16_t* top = GetJumpTable(neighbor, jumpLevels);
+    int topStride = 1 << jumpLevels;
+
+    // Take the largest stride while it fits, then finish with the binary decomposition of the remainder
+    for (; steps >= topStride && index < 65535; steps -= topStride){
+        index = top[index];
+    }
+
+    for (int8_t level = jumpLevels - 1; level >= 0 && index < 65535; level--){
+        if (steps & (1 << level)) index = GetJumpTable(neighbor, level)[index];
+    }
+
+    return index;
+}
+
+template<size_t pixelCount>
+bool LayoutPixelGroup<pixelCount>::GetGridOffsetIndex(uint16_t count, uint16_t* index, int x1, int y1) const {
+    uint16_t rowCount = layout->GetRowCount();
+    int x = int(count % rowCount) + x1;
+    int y = int(count / rowCount) + y1;
+    bool valid = x >= 0 && x < int(rowCount) && y >= 0 && y < int(layout->GetColumnCount());
+
+    *index = valid ? uint16_t(y * rowCount + x) : 65535;
+
+    return valid;
+}
+
+template<size_t pixelCount>
+Vector2D LayoutPixelGroup<pixelCount>::GetCenterCoordinate(){
+    return (layout->GetMaximum() + layout->GetMinimum()) / 2.0f;
+}
+
+template<size_t pixelCount>
+Vector2D LayoutPixelGroup<pixelCount>::GetSize(){
+    return layout->GetMaximum() - layout->GetMinimum();
+}
+
+template<size_t pixelCount>
+Vector2D LayoutPixelGroup<pixelCount>::GetCoordinate(uint16_t count){
+    return GetCoordinates()[Mathematics::Constrain<int>(count, 0, pixelCount - 1)];
+}
+
+template<size_t pixelCount>
+PixelCoordinates LayoutPixelGroup<pixelCount>::GetCoordinates(){
+    const Vector2D* pixelPositions = layout->GetPositions();
+
+    if (pixelPositions) return PixelCoordinates(pixelPositions, pixelCount, layout->GetDirection() == MAXTOZERO);
+
+    uint16_t rowCount = layout->GetRowCount();
+    Vector2D size = layout->GetGridSize();
+    Vector2D step(size.X / float(rowCount), size.Y / float(layout->GetColumnCount()));
+
+    return PixelCoordinates(layout->GetGridPosition(), step, rowCount, pixelCount);
+}
+
+template<size_t pixelCount>
+int LayoutPixelGroup<pixelCount>::GetPixelIndex(Vector2D location){
+    uint16_t rowCount = layout->GetRowCount();
+    uint16_t colCount = layout->GetColumnCount();
+    Vector2D size = layout->GetGridSize();
+    Vector2D position = layout->GetGridPosition();
+
+    float row = Mathematics::Map(location.X, position.X, position.X + size.X, 0.0f, float(rowCount));
+    float col = Mathematics::Map(location.Y, position.Y, position.Y + size.Y, 0.0f, float(colCount));
+
+    uint16_t count = row + col * rowCount;
+
+    if (count < pixelCount && count > 0 && row > 0 && row < rowCount && col > 0 && col < colCount){
+        return count;
+    }
+    else{
+        return -1;
+    }
+}
+
+template<size_t pixelCount>
+RGBColor* LayoutPixelGroup<pixelCount>::GetColor(uint16_t count){
+    return &pixelColors[count];
+}
+
+template<size_t pixelCount>
+RGBColor* LayoutPixelGroup<pixelCount>::GetColors(){
+    return &pixelColors[0];
+}
+
+template<size_t pixelCount>
+RGBColor* LayoutPixelGroup<pixelCount>::GetColorBuffer(){
+    return &pixelBuffer[0];
+}
+
+template<size_t pixelCount>
+uint16_t LayoutPixelGroup<pixelCount>::GetPixelCount(){
+    return pixelCount;
+}
+
+template<size_t pixelCount>
+bool LayoutPixelGroup<pixelCount>::Overlaps(Rectangle2D* box){
+    return Overlap2D::Overlaps(Rectangle2D(Rectangle2D::Bounds{layout->GetMinimum(), layout->GetMaximum()}), *box);
+}
+
+template<size_t pixelCount>
+bool LayoutPixelGroup<pixelCount>::ContainsVector2D(Vector2D v){
+    return v.CheckBounds(layout->GetMinimum(), layout->GetMaximum());
+}
+
+template<size_t pixelCount>
+bool LayoutPixelGroup<pixelCount>::GetUpIndex(uint16_t count, uint16_t* upIndex){
+    *upIndex = layout->GetUp()[count];
+
+    return *upIndex < 65535;
+}
+
+template<size_t pixelCount>
+bool LayoutPixelGroup<pixelCount>::GetDownIndex(uint16_t count, uint16_t* downIndex){
+    *downIndex = layout->GetDown()[count];
+
+    return *downIndex < 65535;
+}
+
+template<size_t pixelCount>
+bool LayoutPixelGroup<pixelCount>::GetLeftIndex(uint16_t count, uint16_t* leftIndex){
+    *leftIndex = layout->GetLeft()[count];
+
+    return *leftIndex < 65535;
+}
+
+template<size_t pixelCount>
+bool LayoutPixelGroup<pixelCount>::GetRightIndex(uint16_t count, uint16_t* rightIndex){
+    *rightIndex = layout->GetRight()[count];
+
+    return *rightIndex < 65535;
+}
+
+template<size_t pixelCount>
+const uint16_t* LayoutPixelGroup<pixelCount>::GetRowOrder(){
+    return layout->GetRowOrder();
+}
+
+template<size_t pixelCount>
+const uint16_t* LayoutPixelGroup<pixelCount>::GetColumnOrder(){
+    return layout->GetColumnOrder();
+}
+
+template<size_t pixelCount>
+bool LayoutPixelGroup<pixelCount>::GetAlternateXIndex(uint16_t count, uint16_t* index){
+    bool isEven = count % 2;
+
+    *index = Jump(isEven ? RIGHT : LEFT, count, count / 2);
+
+    return *index < 65535;
+}
+
+template<size_t pixelCount>
+bool LayoutPixelGroup<pixelCount>::GetAlternateYIndex(uint16_t count, uint16_t* index){
+    bool isEven = count % 2;
+
+    *index = Jump(isEven ? UP : DOWN, count, count / 2);
+
+    return *index < 65535;
+}
+
+template<size_t pixelCount>
+bool LayoutPixelGroup<pixelCount>::GetOffsetXIndex(uint16_t count, uint16_t* index, int x1){
+    if (layout->IsRectangular()) return GetGridOffsetIndex(count, index, x1, 0);
+
+    *index = Jump(x1 > 0 ? RIGHT : LEFT, count, abs(x1));
+
+    return *index < 65535;
+}
+
+template<size_t pixelCount>
+bool LayoutPixelGroup<pixelCount>::GetOffsetYIndex(uint16_t count, uint16_t* index, int y1){
+    if (layout->IsRectangular()) return GetGridOffsetIndex(count, index, 0, y1);
+
+    *index = Jump(y1 > 0 ? UP : DOWN, count, abs(y1));
+
+    return *index < 65535;
+}
+
+template<size_t pixelCount>
+bool LayoutPixelGroup<pixelCount>::GetOffsetXYIndex(uint16_t count, uint16_t* index, int x1, int y1){
+    if (layout->IsRectangular()) return GetGridOffsetIndex(count, index, x1, y1);
+
+    uint16_t tempIndex = Jump(x1 > 0 ? RIGHT : LEFT, count, abs(x1));
+
+    *index = Jump(y1 > 0 ? UP : DOWN, tempIndex, abs(y1));
+
+    return *index < 65535;
+}
+
+template<size_t pixelCount>
+bool LayoutPixelGroup<pixelCount>::GetRadialIndex(uint16_t count, uint16_t* index, int pixels, float angle){//walks in the direction of the angle to a target pixel to grab an index
+    int x1 = int(float(pixels) * cosf(angle * Mathematics::MPID180));
+    int y1 = int(float(pixels) * sinf(angle * Mathematics::MPID180));
+
+    if (pixels <= 0){
+        *index = count;
+
+        return true;
+    }
+
+    // The walk ends on its last interpolated step, (pixels - 1) / pixels of the way to the target
+    int x = Mathematics::Map(pixels - 1, 0, pixels, 0, x1);
+    int y = Mathematics::Map(pixels - 1, 0, pixels, 0, y1);
+
+    if (layout->IsRectangular()) return GetGridOffsetIndex(count, index, x, y);
+
+    uint16_t tempIndex = count;
+    Neighbor direction = RIGHT;
+    int run = 0;
+
+    int previousX = 0;
+    int previousY = 0;
+
+    // Irregular layouts depend on the order of the steps, so replay the interpolated walk and only
+    // merge consecutive steps in the same direction into one jump
+    for(int i = 0; i < pixels && tempIndex < 65535; i++){
+        x = Mathematics::Map(i, 0, pixels, 0, x1);
+        y = Mathematics::Map(i, 0, pixels, 0, y1);
+
+        if (x != previousX){
+            Neighbor next = x > previousX ? RIGHT : LEFT;
+
+            if (next != direction){
+                tempIndex = Jump(direction, tempIndex, run);
+                direction = next;
+                run = 0;
+            }
+
+            run += abs(x - previousX);
+        }
+
+        if (y != previousY){
+            Neighbor next = y > previousY ? UP : DOWN;
+
+            if (next != direction){
+                tempIndex = Jump(direction, tempIndex, run);
+                direction = next;
+                run = 0;
+            }
+
+            run += abs(y - previousY);
+        }
+
+        previousX = x;
+        previousY = y;
+    }
+
+    *index = Jump(direction, tempIndex, run);
+
+    return *index < 65535;
+}
+
+template<size_t pixelCount>
+void LayoutPixelGroup<pixelCount>::GridSort(){
+    if (jumpTables) BuildJumpTables();
+}
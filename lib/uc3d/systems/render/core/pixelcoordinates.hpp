@@ -0,0 +1,203 @@
+/**
+ * @file PixelCoordinates.h
+ * @brief Declares the PixelCoordinates class for streaming the coordinates of a pixel group.
+ *
+ * Per-pixel coordinate lookups through IPixelGroup::GetCoordinate cost a virtual call
+ * each. PixelCoordinates is fetched once per pass and resolves coordinates inline,
+ * either from the layout's position array or from the grid origin and spacing.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "../../../core/math/vector2d.hpp"
+
+/**
+ * @class PixelCoordinates
+ * @brief Lightweight, copyable view of the coordinates of every pixel in a group.
+ *
+ * Holds no per-pixel storage and no mutable state, so a view may be shared by threads.
+ * Accessors are defined inline so loops over pixels compile down to array reads or a
+ * multiply-add per axis.
+ *
+ * @code
+ * PixelCoordinates coordinates = pixelGroup->GetCoordinates();
+ *
+ * for (uint16_t i = 0; i < coordinates.GetPixelCount(); i++) {
+ *     Vector2D coordinate = coordinates[i];
+ * }
+ * @endcode
+ */
+class PixelCoordinates {
+private:
+    const Vector2D* positions = nullptr; ///< Array of pixel positions, null for rectangular grids.
+    uint16_t pixelCount = 0; ///< Number of pixels in the group.
+    bool reversed = false; ///< True if positions are traversed from the end.
+    uint16_t rowCount = 1; ///< Number of pixels in each row of the grid.
+    Vector2D origin; ///< Coordinate of the first grid pixel.
+    Vector2D step; ///< Spacing between grid pixels.
+
+public:
+    /**
+     * @class Iterator
+     * @brief Forward iterator walking the pixels in index order.
+     *
+     * Grid coordinates are advanced by row and column counters instead of a division per pixel.
+     */
+    class Iterator {
+    private:
+        const PixelCoordinates* coordinates; ///< View being iterated.
+        uint16_t index; ///< Current pixel index.
+        uint16_t column; ///< Current column within the grid row.
+        uint16_t row; ///< Current grid row.
+
+    public:
+        /**
+         * @brief Constructs an iterator at a pixel index.
+         *
+         * @param coordinates View being iterated.
+         * @param index Starting pixel index.
+         */
+        Iterator(const PixelCoordinates* coordinates, uint16_t index)
+            : coordinates(coordinates), index(index), column(index % coordinates->rowCount), row(index / coordinates->rowCount) {}
+
+        /**
+         * @brief Retrieves the coordinate of the current pixel.
+         *
+         * @return The coordinate as a Vector2D.
+         */
+        Vector2D operator*() const {
+            if (coordinates->positions) return coordinates->GetPosition(index);
+
+            return Vector2D(coordinates->origin.X + float(column) * coordinates->step.X, coordinates->origin.Y + float(row) * coordinates->step.Y);
+        }
+
+        /**
+         * @brief Advances to the next pixel.
+         *
+         * @return Reference to this iterator.
+         */
+        Iterator& operator++() {
+            index++;
+
+            if (++column == coordinates->rowCount) {
+                column = 0;
+                row++;
+            }
+
+            return *this;
+        }
+
+        /**
+         * @brief Compares the positions of two iterators.
+         *
+         * @param other Iterator to compare with.
+         * @return True if the iterators point at different pixels.
+         */
+        bool operator!=(const Iterator& other) const {
+            return index != other.index;
+        }
+
+        /**
+         * @brief Retrieves the index of the current pixel.
+         *
+         * @return The pixel index.
+         */
+        uint16_t GetIndex() const {
+            return index;
+        }
+    };
+
+    /**
+     * @brief Constructs a view over an array of arbitrary pixel positions.
+     *
+     * @param positions Array of pixel positions.
+     * @param pixelCount Number of pixels in the array.
+     * @param reversed True if pixel indices run from the end of the array.
+     */
+    PixelCoordinates(const Vector2D* positions, uint16_t pixelCount, bool reversed)
+        : positions(positions), pixelCount(pixelCount), reversed(reversed) {}
+
+    /**
+     * @brief Constructs a view over a row-major rectangular grid.
+     *
+     * @param origin Coordinate of the first pixel.
+     * @param step Spacing between neighboring pixels on each axis.
+     * @param rowCount Number of pixels in each row.
+     * @param pixelCount Number of pixels in the grid.
+     */
+    PixelCoordinates(Vector2D origin, Vector2D step, uint16_t rowCount, uint16_t pixelCount)
+        : pixelCount(pixelCount), rowCount(rowCount), origin(origin), step(step) {}
+
+    /**
+     * @brief Retrieves the coordinate of a pixel.
+     *
+     * @param index The pixel index, must be less than the pixel count.
+     * @return The coordinate as a Vector2D.
+     */
+    Vector2D operator[](uint16_t index) const {
+        if (positions) return GetPosition(index);
+
+        return Vector2D(origin.X + float(index % rowCount) * step.X, origin.Y + float(index / rowCount) * step.Y);
+    }
+
+    /**
+     * @brief Retrieves the number of pixels in the view.
+     *
+     * @return The pixel count.
+     */
+    uint16_t GetPixelCount() const {
+        return pixelCount;
+    }
+
+    /**
+     * @brief Checks if the pixels form a row-major grid.
+     *
+     * @return True for grids, false for arbitrary positions.
+     */
+    bool IsGrid() const {
+        return !positions;
+    }
+
+    /**
+     * @brief Retrieves the number of pixels in each grid row.
+     *
+     * @return The row length, 1 for arbitrary positions.
+     */
+    uint16_t GetRowCount() const {
+        return rowCount;
+    }
+
+    /**
+     * @brief Retrieves an iterator at the first pixel.
+     *
+     * @return The iterator.
+     */
+    Iterator begin() const {
+        return Iterator(this, 0);
+    }
+
+    /**
+     * @brief Retrieves an iterator one past the last pixel.
+     *
+     * @return The iterator.
+     */
+    Iterator end() const {
+        return Iterator(this, pixelCount);
+    }
+
+private:
+    /**
+     * @brief Retrieves a position from the array after applying the traversal direction.
+     *
+     * @param index The pixel index.
+     * @return The position as a Vector2D.
+     */
+    Vector2D GetPosition(uint16_t index) const {
+        return positions[reversed ? pixelCount - index - 1 : index];
+    }
+};
@@ -0,0 +1,214 @@
+/**
+ * @file PixelLayout.h
+ * @brief Declares the PixelLayout template class holding the spatial tables of a pixel group.
+ *
+ * A PixelLayout stores the neighbor tables, traversal orders, bounds and grid detection
+ * of a fixed pixel arrangement. Every constructor is constexpr, so layouts known at
+ * compile time can be baked into read-only tables and shared by LayoutPixelGroup instances,
+ * which then only spend a pointer on them instead of computing and holding the tables.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "ipixelgroup.hpp" // Include for the traversal direction.
+#include "../../../core/math/vector2d.hpp"
+#include "../../../core/platform/flash.hpp"
+
+/**
+ * @class PixelLayout
+ * @brief Computes and stores the spatial relationships of a fixed set of pixels.
+ *
+ * Layouts built from a constant position array can be evaluated at compile time:
+ * @code
+ * UC3D_FLASH constexpr Vector2D positions[4] = { Vector2D(0, 0), Vector2D(1, 0), Vector2D(0, 1), Vector2D(1, 1) };
+ * UC3D_FLASH constexpr PixelLayout<4> layout(positions);
+ *
+ * LayoutPixelGroup<4> pixelGroup(layout);
+ * @endcode
+ *
+ * The tests evaluate a 512 pixel layout within the default limits of GCC, larger layouts
+ * may need a higher compiler evaluation limit, e.g. `-fconstexpr-ops-limit`. Arbitrary layouts whose pixels form an evenly spaced, row-major grid with at
+ * least one unit of spacing are detected as rectangular, enabling direct grid lookups.
+ *
+ * @tparam pixelCount The total number of pixels in the layout.
+ */
+template<size_t pixelCount>
+class PixelLayout {
+private:
+    const Vector2D* positions = nullptr; ///< Array of pixel positions, null for rectangular grids.
+    IPixelGroup::Direction direction = IPixelGroup::ZEROTOMAX; ///< Direction of pixel traversal.
+    uint16_t up[pixelCount] = {}; ///< Indices of pixels above each pixel.
+    uint16_t down[pixelCount] = {}; ///< Indices of pixels below each pixel.
+    uint16_t left[pixelCount] = {}; ///< Indices of pixels to the left of each pixel.
+    uint16_t right[pixelCount] = {}; ///< Indices of pixels to the right of each pixel.
+    uint16_t rowOrder[pixelCount] = {}; ///< Pixel indices grouped into rows, left to right.
+    uint16_t columnOrder[pixelCount] = {}; ///< Pixel indices grouped into columns, bottom to top.
+    Vector2D minimum; ///< Minimum corner of the bounding box.
+    Vector2D maximum; ///< Maximum corner of the bounding box.
+
+    bool isRectangular = false; ///< Indicates if the layout forms a rectangular grid.
+    uint16_t rowCount = 0; ///< Number of pixels in each row of the grid.
+    uint16_t colCount = 0; ///< Number of rows in the grid.
+    Vector2D size; ///< Size of the grid.
+    Vector2D position; ///< Position of the grid.
+
+    static constexpr float kGridTolerance = 0.05f; ///< Allowed deviation from a grid point, relative to the spacing.
+
+    /**
+     * @brief Rounds a value down to an integer, usable in constant expressions.
+     *
+     * @param value The value to round.
+     * @return The largest integer less than or equal to the value.
+     */
+    static constexpr int FloorToInt(float value);
+
+    /**
+     * @brief Computes the absolute value, usable in constant expressions.
+     *
+     * @param value The input value.
+     * @return The absolute value.
+     */
+    static constexpr float Absolute(float value);
+
+    /**
+     * @brief Retrieves the position of a pixel in traversal order.
+     *
+     * @param count The index of the pixel.
+     * @return The position of the pixel after applying the traversal direction.
+     */
+    constexpr Vector2D GetLayoutPosition(uint16_t count) const;
+
+    /**
+     * @brief Fills the neighbor tables of a rectangular grid from its row and column.
+     */
+    constexpr void BuildGridNeighbors();
+
+    /**
+     * @brief Computes the bounding box of the pixel positions.
+     */
+    constexpr void BuildBounds();
+
+    /**
+     * @brief Detects an evenly spaced, row-major grid and records its dimensions.
+     */
+    constexpr void DetectGrid();
+
+    /**
+     * @brief Checks if a pixel sorts before another within the neighbor search bands.
+     *
+     * Pixels are grouped into bands one unit wide across the search axis, then ordered
+     * along the search axis and finally by index.
+     *
+     * @param a Index of the first pixel.
+     * @param b Index of the second pixel.
+     * @param vertical True to band by X and order by Y, false to band by Y and order by X.
+     * @return True if a sorts before b.
+     */
+    constexpr bool IsBandBefore(uint16_t a, uint16_t b, bool vertical) const;
+
+    /**
+     * @brief Restores the max-heap property below a root during the band sort.
+     *
+     * @param sorted Pixel indices being sorted.
+     * @param root Position of the root to sift down.
+     * @param end One past the last position in the heap.
+     * @param vertical Search axis used for sorting.
+     */
+    constexpr void SiftDown(uint16_t* sorted, uint16_t root, uint16_t end, bool vertical) const;
+
+    /**
+     * @brief Sorts all pixel indices with IsBandBefore.
+     *
+     * @param sorted Output array of pixelCount indices.
+     * @param vertical Search axis used for sorting.
+     */
+    constexpr void SortBands(uint16_t* sorted, bool vertical) const;
+
+    /**
+     * @brief Finds the first sorted position whose band and coordinate follow a key.
+     *
+     * @param sorted Pixel indices sorted with IsBandBefore.
+     * @param band Band of the key.
+     * @param along Coordinate of the key along the search axis.
+     * @param vertical Search axis used for sorting.
+     * @param inclusive True to also skip entries equal to the key.
+     * @return Position of the first entry after the key.
+     */
+    constexpr uint16_t FindBandPosition(const uint16_t* sorted, int band, float along, bool vertical, bool inclusive) const;
+
+    /**
+     * @brief Finds the nearest neighbors of every pixel along one axis.
+     *
+     * Candidates must lie within one unit across the axis, so only the pixel's band and
+     * the two adjacent bands are scanned, outward from the pixel until the distance along
+     * the axis exceeds the best match.
+     *
+     * @param sorted Scratch array of pixelCount entries.
+     * @param vertical True to fill the up and down tables, false for left and right.
+     */
+    constexpr void FindNeighbors(uint16_t* sorted, bool vertical);
+
+    /**
+     * @brief Builds a traversal order by following neighbor chains.
+     *
+     * Chains start at pixels without a previous neighbor and follow the next neighbor
+     * until the chain ends, pixels not reached this way start chains of their own.
+     *
+     * @param previous Neighbor table pointing against the traversal direction.
+     * @param next Neighbor table pointing along the traversal direction.
+     * @param order Output array of pixelCount indices.
+     */
+    constexpr void BuildTraversalOrder(const uint16_t* previous, const uint16_t* next, uint16_t* order);
+
+public:
+    /**
+     * @brief Constructs an empty layout without pixels or neighbors.
+     */
+    constexpr PixelLayout() = default;
+
+    /**
+     * @brief Constructs the layout of a rectangular grid.
+     *
+     * @param size Size of the rectangular grid.
+     * @param position Position of the rectangular grid.
+     * @param rowCount Number of pixels in each row of the grid.
+     */
+    constexpr PixelLayout(Vector2D size, Vector2D position, uint16_t rowCount);
+
+    /**
+     * @brief Constructs the layout of arbitrary pixel locations.
+     *
+     * @param pixelLocations Array of pixel locations, must outlive the layout.
+     * @param direction Direction of pixel traversal (default: ZEROTOMAX).
+     */
+    constexpr PixelLayout(const Vector2D* pixelLocations, IPixelGroup::Direction direction = IPixelGroup::ZEROTOMAX);
+
+    /**
+     * @brief Recomputes the neighbor tables and traversal orders.
+     */
+    constexpr void Build();
+
+    constexpr const Vector2D* GetPositions() const { return positions; } ///< Pixel positions, null for rectangular grids.
+    constexpr IPixelGroup::Direction GetDirection() const { return direction; } ///< Direction of pixel traversal.
+    constexpr const uint16_t* GetUp() const { return up; } ///< Indices of pixels above each pixel.
+    constexpr const uint16_t* GetDown() const { return down; } ///< Indices of pixels below each pixel.
+    constexpr const uint16_t* GetLeft() const { return left; } ///< Indices of pixels to the left of each pixel.
+    constexpr const uint16_t* GetRight() const { return right; } ///< Indices of pixels to the right of each pixel.
+    constexpr const uint16_t* GetRowOrder() const { return rowOrder; } ///< Pixel indices grouped into rows.
+    constexpr const uint16_t* GetColumnOrder() const { return columnOrder; } ///< Pixel indices grouped into columns.
+    constexpr Vector2D GetMinimum() const { return minimum; } ///< Minimum corner of the bounding box.
+    constexpr Vector2D GetMaximum() const { return maximum; } ///< Maximum corner of the bounding box.
+    constexpr bool IsRectangular() const { return isRectangular; } ///< True if the pixels form a rectangular grid.
+    constexpr uint16_t GetRowCount() const { return rowCount; } ///< Number of pixels in each row of the grid.
+    constexpr uint16_t GetColumnCount() const { return colCount; } ///< Number of rows in the grid.
+    constexpr Vector2D GetGridSize() const { return size; } ///< Size of the grid.
+    constexpr Vector2D GetGridPosition() const { return position; } ///< Position of the grid.
+};
+
+#include "pixellayout.tpp" // Include the template implementation.
@@ -0,0 +1,278 @@
+#pragma once
+
+template<size_t pixelCount>
+constexpr PixelLayout<pixelCount>::PixelLayout(Vector2D size, Vector2D position, uint16_t rowCount)
+    : isRectangular(true), rowCount(rowCount), colCount(uint16_t(pixelCount / rowCount)), size(size), position(position) {
+    float endX = position.X + size.X;
+    float endY = position.Y + size.Y;
+
+    // Vector2D assignment is not constexpr, components are written directly throughout
+    minimum.X = position.X < endX ? position.X : endX;
+    minimum.Y = position.Y < endY ? position.Y : endY;
+    maximum.X = position.X > endX ? position.X : endX;
+    maximum.Y = position.Y > endY ? position.Y : endY;
+
+    Build();
+}
+
+template<size_t pixelCount>
+constexpr PixelLayout<pixelCount>::PixelLayout(const Vector2D* pixelLocations, IPixelGroup::Direction direction)
+    : positions(pixelLocations), direction(direction) {
+    BuildBounds();
+    DetectGrid();
+    Build();
+}
+
+template<size_t pixelCount>
+constexpr void PixelLayout<pixelCount>::Build(){
+    for (uint16_t i = 0; i < pixelCount; i++){
+        up[i] = 65535;
+        down[i] = 65535;
+        left[i] = 65535;
+        right[i] = 65535;
+    }
+
+    if (positions){
+        // The traversal orders are rebuilt below, borrow them as scratch space for the band sorts
+        FindNeighbors(columnOrder, true);
+        FindNeighbors(rowOrder, false);
+    }
+    else {
+        BuildGridNeighbors();
+    }
+
+    BuildTraversalOrder(left, right, rowOrder);
+    BuildTraversalOrder(down, up, columnOrder);
+}
+
+template<size_t pixelCount>
+constexpr int PixelLayout<pixelCount>::FloorToInt(float value){
+    int truncated = int(value);
+
+    return float(truncated) > value ? truncated - 1 : truncated;
+}
+
+template<size_t pixelCount>
+constexpr float PixelLayout<pixelCount>::Absolute(float value){
+    return value < 0.0f ? -value : value;
+}
+
+template<size_t pixelCount>
+constexpr Vector2D PixelLayout<pixelCount>::GetLayoutPosition(uint16_t count) const {
+    return direction == IPixelGroup::ZEROTOMAX ? positions[count] : positions[pixelCount - count - 1];
+}
+
+template<size_t pixelCount>
+constexpr void PixelLayout<pixelCount>::BuildGridNeighbors(){//optimized algorithm for rectangular matrices
+    for (int i = 0; i < int(pixelCount); i++) {
+        if (i + int(rowCount) < int(pixelCount)) up[i] = uint16_t(i) + rowCount;//up
+        if (i >= int(rowCount)) down[i] = uint16_t(i) - rowCount;//down
+
+        // Rows end at the group edge, the last pixel of a row does not link to the next row
+        if (i % rowCount != 0) left[i] = uint16_t(i) - 1;//left
+        if (i % rowCount != rowCount - 1) right[i] = uint16_t(i) + 1;//right
+    }
+}
+
+template<size_t pixelCount>
+constexpr void PixelLayout<pixelCount>::BuildBounds(){
+    minimum.X = maximum.X = positions[0].X;
+    minimum.Y = maximum.Y = positions[0].Y;
+
+    for (uint16_t i = 1; i < pixelCount; i++){
+        const Vector2D& location = positions[i];
+
+        if (location.X < minimum.X) minimum.X = location.X;
+        if (location.Y < minimum.Y) minimum.Y = location.Y;
+        if (location.X > maximum.X) maximum.X = location.X;
+        if (location.Y > maximum.Y) maximum.Y = location.Y;
+    }
+}
+
+template<size_t pixelCount>
+constexpr void PixelLayout<pixelCount>::DetectGrid(){
+    if (pixelCount < 4) return;
+
+    Vector2D origin = GetLayoutPosition(0);
+    float spacingX = GetLayoutPosition(1).X - origin.X;
+
+    // Neighbor searches accept pixels within one unit across the axis, so tighter grids are not equivalent
+    if (spacingX < 1.0f) return;
+
+    uint16_t columns = 1;
+
+    while (columns < pixelCount && Absolute(GetLayoutPosition(columns).Y - origin.Y) < spacingX * kGridTolerance) columns++;
+
+    if (columns < 2 || columns == pixelCount || pixelCount % columns != 0) return;
+
+    float spacingY = GetLayoutPosition(columns).Y - origin.Y;
+
+    if (spacingY < 1.0f) return;
+
+    for (uint16_t i = 0; i < pixelCount; i++){
+        Vector2D location = GetLayoutPosition(i);
+        float expectedX = origin.X + float(i % columns) * spacingX;
+        float expectedY = origin.Y + float(i / columns) * spacingY;
+
+        if (Absolute(location.X - expectedX) > spacingX * kGridTolerance) return;
+        if (Absolute(location.Y - expectedY) > spacingY * kGridTolerance) return;
+    }
+
+    isRectangular = true;
+    rowCount = columns;
+    colCount = uint16_t(pixelCount / columns);
+    size.X = spacingX * float(rowCount);
+    size.Y = spacingY * float(colCount);
+    position.X = origin.X;
+    position.Y = origin.Y;
+}
+
+template<size_t pixelCount>
+constexpr bool PixelLayout<pixelCount>::IsBandBefore(uint16_t a, uint16_t b, bool vertical) const {
+    Vector2D positionA = GetLayoutPosition(a);
+    Vector2D positionB = GetLayoutPosition(b);
+    int bandA = FloorToInt(vertical ? positionA.X : positionA.Y);
+    int bandB = FloorToInt(vertical ? positionB.X : positionB.Y);
+    float alongA = vertical ? positionA.Y : positionA.X;
+    float alongB = vertical ? positionB.Y : positionB.X;
+
+    if (bandA != bandB) return bandA < bandB;
+    if (alongA != alongB) return alongA < alongB;
+
+    return a < b;
+}
+
+template<size_t pixelCount>
+constexpr void PixelLayout<pixelCount>::SiftDown(uint16_t* sorted, uint16_t root, uint16_t end, bool vertical) const {
+    for (uint16_t child = 2 * root + 1; child < end; child = 2 * root + 1) {
+        if (child + 1 < end && IsBandBefore(sorted[child], sorted[child + 1], vertical)) child++;
+        if (!IsBandBefore(sorted[root], sorted[child], vertical)) break;
+
+        uint16_t temp = sorted[root];
+        sorted[root] = sorted[child];
+        sorted[child] = temp;
+        root = child;
+    }
+}
+
+template<size_t pixelCount>
+constexpr void PixelLayout<pixelCount>::SortBands(uint16_t* sorted, bool vertical) const {
+    for (uint16_t i = 0; i < pixelCount; i++) sorted[i] = i;
+
+    // Heap sort keeps this O(n log n) without recursion or extra memory
+    for (uint16_t start = pixelCount / 2; start-- > 0; ) {
+        SiftDown(sorted, start, pixelCount, vertical);
+    }
+
+    for (uint16_t end = pixelCount; end-- > 1; ) {
+        uint16_t temp = sorted[0];
+        sorted[0] = sorted[end];
+        sorted[end] = temp;
+
+        SiftDown(sorted, 0, end, vertical);
+    }
+}
+
+template<size_t pixelCount>
+constexpr uint16_t PixelLayout<pixelCount>::FindBandPosition(const uint16_t* sorted, int band, float along, bool vertical, bool inclusive) const {
+    uint16_t low = 0;
+    uint16_t high = pixelCount;
+
+    while (low < high) {
+        uint16_t middle = low + (high - low) / 2;
+        Vector2D location = GetLayoutPosition(sorted[middle]);
+        int middleBand = FloorToInt(vertical ? location.X : location.Y);
+        float middleAlong = vertical ? location.Y : location.X;
+        bool before = middleBand < band || (middleBand == band && (middleAlong < along || (inclusive && middleAlong == along)));
+
+        if (before) low = middle + 1;
+        else high = middle;
+    }
+
+    return low;
+}
+
+template<size_t pixelCount>
+constexpr void PixelLayout<pixelCount>::FindNeighbors(uint16_t* sorted, bool vertical){
+    uint16_t* previous = vertical ? down : left;
+    uint16_t* next = vertical ? up : right;
+
+    SortBands(sorted, vertical);
+
+    for (uint16_t i = 0; i < pixelCount; i++) {
+        Vector2D currentPos = GetLayoutPosition(i);
+        float across = vertical ? currentPos.X : currentPos.Y;
+        float along = vertical ? currentPos.Y : currentPos.X;
+        int band = FloorToInt(across);
+
+        // Squared distances keep the search usable in constant expressions and rank neighbors identically
+        float minPrevious = __FLT_MAX__, minNext = __FLT_MAX__;
+        int minPreviousIndex = -1, minNextIndex = -1;
+
+        // Candidates within one unit across the axis can only sit in this band or the adjacent ones
+        for (int b = band - 1; b <= band + 1; b++) {
+            for (uint16_t k = FindBandPosition(sorted, b, along, vertical, true); k < pixelCount; k++) {
+                uint16_t j = sorted[k];
+                Vector2D neighborPos = GetLayoutPosition(j);
+                float neighborAcross = vertical ? neighborPos.X : neighborPos.Y;
+                float offsetAcross = neighborAcross - across;
+                float offsetAlong = (vertical ? neighborPos.Y : neighborPos.X) - along;
+
+                if (FloorToInt(neighborAcross) != b) break;
+                if (offsetAlong * offsetAlong > minNext) break;
+                if (Absolute(offsetAcross) >= 1.0f) continue;
+
+                float dist = offsetAcross * offsetAcross + offsetAlong * offsetAlong;
+
+                if (dist < minNext || (dist == minNext && j < minNextIndex)) {
+                    minNext = dist;
+                    minNextIndex = j;
+                }
+            }
+
+            for (uint16_t k = FindBandPosition(sorted, b, along, vertical, false); k-- > 0; ) {
+                uint16_t j = sorted[k];
+                Vector2D neighborPos = GetLayoutPosition(j);
+                float neighborAcross = vertical ? neighborPos.X : neighborPos.Y;
+                float offsetAcross = neighborAcross - across;
+                float offsetAlong = (vertical ? neighborPos.Y : neighborPos.X) - along;
+
+                if (FloorToInt(neighborAcross) != b) break;
+                if (offsetAlong * offsetAlong > minPrevious) break;
+                if (Absolute(offsetAcross) >= 1.0f) continue;
+
+                float dist = offsetAcross * offsetAcross + offsetAlong * offsetAlong;
+
+                if (dist < minPrevious || (dist == minPrevious && j < minPreviousIndex)) {
+                    minPrevious = dist;
+                    minPreviousIndex = j;
+                }
+            }
+        }
+
+        // Set the indices of the neighboring pixels
+        if (minPreviousIndex != -1) previous[i] = uint16_t(minPreviousIndex);
+        if (minNextIndex != -1) next[i] = uint16_t(minNextIndex);
+    }
+}
+
+template<size_t pixelCount>
+constexpr void PixelLayout<pixelCount>::BuildTraversalOrder(const uint16_t* previous, const uint16_t* next, uint16_t* order){
+    uint8_t visited[(pixelCount + 7) / 8] = {0};
+    uint16_t count = 0;
+
+    // First pass starts chains at pixels without a previous neighbor, second pass picks up the remainder
+    for (uint8_t pass = 0; pass < 2; pass++){
+        for (uint16_t i = 0; i < pixelCount; i++){
+            if (pass == 0 && previous[i] < 65535) continue;
+
+            uint16_t index = i;
+
+            while (index < 65535 && !(visited[index >> 3] & (1 << (index & 7)))){
+                visited[index >> 3] |= uint8_t(1 << (index & 7));
+                order[count++] = index;
+                index = next[index];
+            }
+        }
+    }
+}
@@ -0,0 +1,122 @@
+#include "resolutionscaler.hpp"
+#include "../../../core/math/mathematics.hpp"
+
+ResolutionScaler::~ResolutionScaler() {
+    delete[] colors;
+}
+
+void ResolutionScaler::SetScale(float scale) {
+    this->scale = Mathematics::Constrain(scale, minimumScale, maximumScale);
+}
+
+float ResolutionScaler::GetScale() const {
+    return scale;
+}
+
+void ResolutionScaler::SetDynamic(float targetTime, float minimumScale, float maximumScale) {
+    this->targetTime = targetTime;
+    this->minimumScale = minimumScale;
+    this->maximumScale = maximumScale;
+
+    SetScale(scale);
+}
+
+void ResolutionScaler::ReportRenderTime(float renderTime) {
+    if (targetTime <= 0.0f || renderTime <= 0.0f) return;
+
+    if (renderTime > targetTime) {
+        // The cost follows the pixel count, which is the square of the scale
+        SetScale(scale * Mathematics::Sqrt(targetTime / renderTime));
+    } else if (renderTime < targetTime * kRaiseRatio) {
+        SetScale(scale + kRaiseStep);
+    }
+}
+
+bool ResolutionScaler::IsActive() const {
+    return scale < 1.0f;
+}
+
+bool ResolutionScaler::Prepare(const Vector2D& minimum, const Vector2D& maximum, const PixelCoordinates& physical) {
+    if (!IsActive() || physical.GetPixelCount() == 0) {
+        if (!colors) return false;
+
+        delete[] colors;
+
+        colors = nullptr;
+        columns = 0;
+        rows = 0;
+        return true;
+    }
+
+    float pixelCount = float(physical.GetPixelCount());
+    float width = maximum.X - minimum.X;
+    float height = maximum.Y - minimum.Y;
+    float nativeColumns;
+
+    if (physical.IsGrid()) {
+        nativeColumns = float(physical.GetRowCount());
+    } else if (width <= 0.0f || height <= 0.0f) {
+        // Strips only extend along one axis
+        nativeColumns = width > 0.0f ? pixelCount : 1.0f;
+    } else {
+        nativeColumns = Mathematics::Sqrt(pixelCount * width / height);
+    }
+
+    float nativeRows = pixelCount / nativeColumns;
+    uint16_t newColumns = Mathematics::Max(uint16_t(2), uint16_t(nativeColumns * scale + 0.5f));
+    uint16_t newRows = Mathematics::Max(uint16_t(2), uint16_t(nativeRows * scale + 0.5f));
+    Vector2D newStep(width / float(newColumns - 1), height / float(newRows - 1));
+    bool changed = newColumns != columns || newRows != rows || origin.X != minimum.X || origin.Y != minimum.Y ||
+                   step.X != newStep.X || step.Y != newStep.Y;
+
+    if (!changed) return false;
+
+    if (uint32_t(newColumns) * newRows != uint32_t(columns) * rows) {
+        delete[] colors;
+
+        colors = new RGBColor[uint32_t(newColumns) * newRows];
+    }
+
+    columns = newColumns;
+    rows = newRows;
+    origin = minimum;
+    step = newStep;
+
+    return true;
+}
+
+PixelCoordinates ResolutionScaler::GetCoordinates() const {
+    return PixelCoordinates(origin, step, columns, uint16_t(columns * rows));
+}
+
+RGBColor* ResolutionScaler::GetColors() {
+    return colors;
+}
+
+void ResolutionScaler::Upscale(const PixelCoordinates& physical, RGBColor* output, uint16_t first, uint16_t last) const {
+    for (uint16_t i = first; i < last; ++i) {
+        Vector2D pixel = physical[i];
+        float x = step.X > 0.0f ? Mathematics::Constrain((pixel.X - origin.X) / step.X, 0.0f, float(columns - 1)) : 0.0f;
+        float y = step.Y > 0.0f ? Mathematics::Constrain((pixel.Y - origin.Y) / step.Y, 0.0f, float(rows - 1)) : 0.0f;
+        uint16_t left = uint16_t(x);
+        uint16_t top = uint16_t(y);
+        uint16_t right = Mathematics::Min(uint16_t(left + 1), uint16_t(columns - 1));
+        uint16_t bottom = Mathematics::Min(uint16_t(top + 1), uint16_t(rows - 1));
+        float ratioX = x - float(left);
+        float ratioY = y - float(top);
+        const RGBColor* corners[4] = {
+            &colors[top * columns + left], &colors[top * columns + right],
+            &colors[bottom * columns + left], &colors[bottom * columns + right]
+        };
+        float weights[4] = { (1.0f - ratioX) * (1.0f - ratioY), ratioX * (1.0f - ratioY), (1.0f - ratioX) * ratioY, ratioX * ratioY };
+        float red = 0.5f, green = 0.5f, blue = 0.5f;
+
+        for (uint8_t c = 0; c < 4; ++c) {
+            red += float(corners[c]->R) * weights[c];
+            green += float(corners[c]->G) * weights[c];
+            blue += float(corners[c]->B) * weights[c];
+        }
+
+        output[i] = RGBColor(uint8_t(red), uint8_t(green), uint8_t(blue));
+    }
+}
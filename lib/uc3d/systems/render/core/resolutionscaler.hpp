@@ -0,0 +1,135 @@
+/**
+ * @file ResolutionScaler.h
+ * @brief Declares the ResolutionScaler class rendering a camera at a reduced resolution.
+ *
+ * Dense matrices are bound by the number of pixels the rasterizer has to resolve and shade.
+ * ResolutionScaler holds an internal grid with fewer pixels spanning the same coordinates as
+ * the camera. The rasterizer renders into that grid and bilinearly upscales it into the
+ * physical pixels, which may be laid out as a grid or at arbitrary positions.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "pixelcoordinates.hpp" // Include for the internal grid and the physical pixels.
+#include "../../../core/color/rgbcolor.hpp"
+#include "../../../core/math/vector2d.hpp"
+
+/**
+ * @class ResolutionScaler
+ * @brief Internal reduced-resolution grid of a camera and the scale it is sized by.
+ *
+ * The scale applies to each axis, so a scale of 0.5 renders a quarter of the pixels. It is
+ * fixed with SetScale, or adjusted after every frame from the measured render time when a
+ * target time is set with SetDynamic. Scales of 1 or above render the physical pixels directly.
+ *
+ * The internal grid is reallocated only when its row or column count changes. Renderers must
+ * then discard whatever they kept about the previous internal pixels, see Prepare.
+ */
+class ResolutionScaler {
+private:
+    static constexpr float kRaiseRatio = 0.8f; ///< Fraction of the target below which the scale is raised.
+    static constexpr float kRaiseStep = 0.05f; ///< Scale added per frame with headroom.
+
+    float scale = 1.0f; ///< Current scale per axis.
+    float minimumScale = 0.25f; ///< Lowest scale dynamic scaling may select.
+    float maximumScale = 1.0f; ///< Highest scale dynamic scaling may select.
+    float targetTime = 0.0f; ///< Render time budget of the camera in seconds, 0 disables dynamic scaling.
+    RGBColor* colors = nullptr; ///< Colors of the internal grid.
+    uint16_t columns = 0; ///< Pixels in each row of the internal grid, 0 if not allocated.
+    uint16_t rows = 0; ///< Rows of the internal grid.
+    Vector2D origin; ///< Coordinate of the first internal pixel.
+    Vector2D step; ///< Spacing between internal pixels.
+
+public:
+    ResolutionScaler() = default;
+
+    /**
+     * @brief Releases the internal grid.
+     */
+    ~ResolutionScaler();
+
+    ResolutionScaler(const ResolutionScaler&) = delete;
+    ResolutionScaler& operator=(const ResolutionScaler&) = delete;
+
+    /**
+     * @brief Sets the scale of the internal grid relative to the physical resolution.
+     *
+     * @param scale Scale per axis, clamped to the range set with SetDynamic.
+     */
+    void SetScale(float scale);
+
+    /**
+     * @brief Retrieves the current scale per axis.
+     *
+     * @return The scale, 1 when rendering at the physical resolution.
+     */
+    float GetScale() const;
+
+    /**
+     * @brief Enables scaling driven by the measured render time.
+     *
+     * Frames over the target shrink the scale in proportion, since the cost grows with the
+     * pixel count and thus with the square of the scale. Frames under kRaiseRatio of the
+     * target grow it by kRaiseStep, the gap between the two keeps the scale from oscillating.
+     *
+     * @param targetTime Render time budget of the camera in seconds, 0 to keep the scale fixed.
+     * @param minimumScale Lowest scale per axis.
+     * @param maximumScale Highest scale per axis.
+     */
+    void SetDynamic(float targetTime, float minimumScale = 0.25f, float maximumScale = 1.0f);
+
+    /**
+     * @brief Adjusts the scale after a frame if dynamic scaling is enabled.
+     *
+     * The rasterizer reports the time of every camera it rendered, see Rasterizer.
+     *
+     * @param renderTime Time the camera took to render in seconds.
+     */
+    void ReportRenderTime(float renderTime);
+
+    /**
+     * @brief Checks if the camera renders into the internal grid.
+     */
+    bool IsActive() const;
+
+    /**
+     * @brief Sizes the internal grid for the camera before a frame.
+     *
+     * The native resolution is the row length of grid layouts, and is estimated from the
+     * pixel count and the aspect of the bounds for arbitrary layouts. The internal grid is
+     * released when the scaler is not active.
+     *
+     * @param minimum Minimum coordinate of the camera.
+     * @param maximum Maximum coordinate of the camera.
+     * @param physical Coordinates of the physical pixels.
+     * @return True if the internal pixels changed, so their previous colors are meaningless.
+     */
+    bool Prepare(const Vector2D& minimum, const Vector2D& maximum, const PixelCoordinates& physical);
+
+    /**
+     * @brief Retrieves the coordinates of the internal grid, valid after Prepare.
+     */
+    PixelCoordinates GetCoordinates() const;
+
+    /**
+     * @brief Retrieves the colors of the internal grid, valid after Prepare.
+     */
+    RGBColor* GetColors();
+
+    /**
+     * @brief Bilinearly samples the internal grid at a range of physical pixels.
+     *
+     * Ranges do not share output pixels, so several can be upscaled concurrently.
+     *
+     * @param physical Coordinates of the physical pixels.
+     * @param output Colors of the physical pixels.
+     * @param first First pixel of the range.
+     * @param last One past the last pixel of the range.
+     */
+    void Upscale(const PixelCoordinates& physical, RGBColor* output, uint16_t first, uint16_t last) const;
+};
@@ -1,12 +1,90 @@
 #include "renderer.hpp"
 
+ThreadPool* RenderingEngine::threadPool = nullptr;
+CameraBase** RenderingEngine::ordered = nullptr;
+uint8_t* RenderingEngine::groupStarts = nullptr;
+bool* RenderingEngine::grouped = nullptr;
+uint8_t RenderingEngine::capacity = 0;
+
+void RenderingEngine::RasterizeGroup(uint32_t index, void* context) {
+    const RasterizeJob* job = static_cast<const RasterizeJob*>(context);
+    uint8_t start = job->groupStarts[index];
+
+    Rasterizer::Rasterize(job->scene, job->cameras + start, job->groupStarts[index + 1] - start, job->pool);
+}
+
+void RenderingEngine::SetThreadPool(ThreadPool* pool) {
+    threadPool = pool;
+}
+
 void RenderingEngine::Rasterize(Scene* scene, CameraManager* cameraManager) {
-    for (int i = 0; i < cameraManager->GetCameraCount(); i++) {
-        Rasterizer::Rasterize(scene, cameraManager->GetCameras()[i]);
+    uint8_t cameraCount = cameraManager->GetCameraCount();
+    CameraBase** cameras = cameraManager->GetCameras();
+
+    if (cameraCount == 0) return;
+
+    // Cameras with the same viewpoint share one projected triangle set and quadtree,
+    // groups are stored contiguously so each one can be rendered independently
+    if (cameraCount > capacity) {
+        delete[] ordered;
+        delete[] groupStarts;
+        delete[] grouped;
+
+        capacity = cameraCount;
+        ordered = new CameraBase*[capacity];
+        groupStarts = new uint8_t[capacity + 1];
+        grouped = new bool[capacity];
+    }
+
+    for (uint8_t i = 0; i < cameraCount; i++) {
+        grouped[i] = false;
+    }
+
+    uint8_t orderedCount = 0;
+    uint8_t groupCount = 0;
+
+    for (uint8_t i = 0; i < cameraCount; i++) {
+        if (grouped[i]) continue;
+
+        groupStarts[groupCount++] = orderedCount;
+        ordered[orderedCount++] = cameras[i];
+
+        if (!cameras[i]->Is2D()) {
+            // Projections are refreshed here, on one thread, so rendering only reads them
+            const CameraProjection& projection = cameras[i]->GetProjection();
+
+            for (uint8_t j = i + 1; j < cameraCount; j++) {
+                if (grouped[j] || cameras[j]->Is2D()) continue;
+
+                if (projection.Matches(cameras[j]->GetProjection())) {
+                    ordered[orderedCount++] = cameras[j];
+                    grouped[j] = true;
+                }
+            }
+        }
+    }
+
+    groupStarts[groupCount] = orderedCount;
+
+    RasterizeJob job{ scene, ordered, groupStarts, nullptr };
+
+    if (threadPool && groupCount >= threadPool->GetThreadCount()) {
+        // Enough groups to occupy every thread, render whole groups concurrently
+        threadPool->ParallelFor(groupCount, RasterizeGroup, &job);
+    } else {
+        // Few large groups, split each one across the pool instead
+        job.pool = threadPool;
+
+        for (uint8_t i = 0; i < groupCount; i++) {
+            RasterizeGroup(i, &job);
+        }
     }
 }
 
 void RenderingEngine::RayTrace(Scene* scene, CameraManager* cameraManager) {
+    // Refresh the shared triangle hierarchy once per frame rather than once per camera
+    RayTracer::Prepare(scene);
+
     for (int i = 0; i < cameraManager->GetCameraCount(); i++) {
         RayTracer::RayTrace(scene, cameraManager->GetCameras()[i]);
     }
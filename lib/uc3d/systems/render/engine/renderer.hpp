@@ -15,6 +15,7 @@
 #include "../../scene/scene.hpp" // Include for scene management.
 #include "../raster/rasterizer.hpp" // Include for rasterization operations.
 #include "../ray/raytracer.hpp" // Include for display test utilities.
+#include "../../../core/platform/threadpool.hpp" // Include for parallel camera rendering.
 
 /**
  * @class RenderingEngine
@@ -22,15 +23,56 @@
  *
  * The RenderingEngine class offers functionality for rasterizing scenes using cameras
  * and managing display operations such as filling the screen with a white color.
+ *
+ * When a thread pool is set, cameras are rasterized concurrently. The scene is only read
+ * while rendering and every camera writes its own pixel group, so cameras need no locking.
+ * Frames with fewer camera groups than threads instead split each group's projection and
+ * pixels across the pool.
  */
 class RenderingEngine {
+private:
+    /**
+     * @struct RasterizeJob
+     * @brief Cameras of one frame, ordered so cameras sharing a viewpoint are adjacent.
+     */
+    struct RasterizeJob {
+        Scene* scene; ///< Scene being rendered.
+        CameraBase** cameras; ///< Cameras ordered by group.
+        const uint8_t* groupStarts; ///< First camera of each group, followed by the camera count.
+        ThreadPool* pool; ///< Pool used within each group, null when groups run concurrently.
+    };
+
+    static ThreadPool* threadPool; ///< Pool used to render camera groups concurrently, null to render serially.
+    static CameraBase** ordered; ///< Cameras of the current frame ordered by group.
+    static uint8_t* groupStarts; ///< First camera of each group, followed by the camera count.
+    static bool* grouped; ///< Marks cameras already added to a group.
+    static uint8_t capacity; ///< Allocated number of cameras in the grouping arrays.
+
+    /**
+     * @brief Rasterizes one camera group of a RasterizeJob.
+     *
+     * @param index Index of the group.
+     * @param context Pointer to the RasterizeJob.
+     */
+    static void RasterizeGroup(uint32_t index, void* context);
+
 public:
+    /**
+     * @brief Sets the thread pool used to rasterize cameras concurrently.
+     *
+     * Shaders of the scene's materials must be safe to call from several threads at once.
+     *
+     * @param pool Pool to use, or nullptr to render cameras one after another.
+     */
+    static void SetThreadPool(ThreadPool* pool);
+
     /**
      * @brief Rasterizes the given scene using the cameras managed by the CameraManager.
      *
      * This method iterates through all cameras in the CameraManager and rasterizes the scene
-     * for each camera. If the scene includes a post-processing effect, it applies the effect
-     * to the corresponding pixel group.
+     * for each camera. Cameras with matching projections are rasterized as one group, so the
+     * scene is projected and indexed once per distinct viewpoint rather than once per camera.
+     * The grouping arrays persist between frames, so calls must not overlap.
      *
      * @param scene Pointer to the Scene to be rasterized.
      * @param cameraManager Pointer to the CameraManager managing the cameras.
@@ -25,6 +25,28 @@ public:
     /** Per‑frame update hook (override if animated) */
     virtual void Update(float /*DeltaTime*/) {}
 
+    /**
+     * @brief Version of the state the shader reads, equal versions shade equally.
+     *
+     * Changes with every MarkChanged call. Code writing parameters directly, including an
+     * animated Update, must call MarkChanged for the renderer to see the change.
+     */
+    uint32_t GetVersion() const { return Version_; }
+
+    /** Flags a change of the state the shader reads */
+    void MarkChanged() { ++Version_; }
+
+    /**
+     * @brief Sets how many pixels apart the rasterizer shades this material on grid cameras.
+     *
+     * Smooth materials such as gradients and noise look the same when shaded every 2nd or 4th
+     * pixel and interpolated in between. 0 follows the camera, see CameraBase::SetShadingRate.
+     */
+    void SetShadingRate(uint8_t Rate) { ShadingRate_ = Rate; MarkChanged(); }
+
+    /** Shading rate of the material, 0 if it follows the camera */
+    uint8_t GetShadingRate() const { return ShadingRate_; }
+
     /**
      * @brief Typed access helper with UpperCamelCase name.
      */
@@ -36,4 +58,6 @@ public:
 
 private:
     const IShader* ShaderPtr_;  ///< non‑owning
+    uint32_t Version_ = 0;      ///< bumped by MarkChanged
+    uint8_t ShadingRate_ = 0;   ///< 0 follows the camera
 };
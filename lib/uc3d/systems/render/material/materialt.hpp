@@ -1,6 +1,7 @@
 #pragma once
 
-#include "../shader/ishader.hpp"
+#include <utility>
+#include "imaterial.hpp"
 
 template<typename ParamBlock, typename ShaderT>
 class MaterialT : public IMaterial, public ParamBlock {
@@ -17,5 +18,11 @@ public:
         : IMaterial(ShaderPtr()),
           ParamBlock{std::forward<Args>(ArgsPack)...} {}
 
+    // Writable parameters, the material counts as changed whether they are written or not
+    ParamBlock& EditParams() {
+        MarkChanged();
+        return *this;
+    }
+
     // Override Update() when needed via derived ParamBlock + CRTP if desired
 };
@@ -0,0 +1,57 @@
+#include "boxblur.hpp"
+
+void BoxBlur::Apply(IPixelGroup* pixelGroup, const uint16_t* order, NeighborIndex next, uint16_t range) {
+    uint16_t pixelCount = pixelGroup->GetPixelCount();
+    RGBColor* pixelColors = pixelGroup->GetColors();
+    RGBColor* colorBuffer = pixelGroup->GetColorBuffer();
+    uint16_t start = 0;
+
+    while (start < pixelCount) {
+        // Find the end of the line that begins at start
+        uint16_t end = start + 1;
+        uint16_t neighbor = 0;
+
+        while (end < pixelCount && (pixelGroup->*next)(order[end - 1], &neighbor) && neighbor == order[end]) end++;
+
+        uint16_t length = end - start;
+        uint32_t R = 0, G = 0, B = 0;
+        uint16_t head = 0; // One past the last pixel in the window
+        uint16_t tail = 0; // First pixel in the window
+
+        // Running sum over the window [j - range, j + range] clamped to the line
+        for (uint16_t j = 0; j < length; j++) {
+            while (head < length && head <= j + range) {
+                RGBColor& color = pixelColors[order[start + head]];
+
+                R += color.R;
+                G += color.G;
+                B += color.B;
+                head++;
+            }
+
+            while (tail + range < j) {
+                RGBColor& color = pixelColors[order[start + tail]];
+
+                R -= color.R;
+                G -= color.G;
+                B -= color.B;
+                tail++;
+            }
+
+            uint16_t samples = head - tail;
+            RGBColor& output = colorBuffer[order[start + j]];
+
+            output.R = R / samples;
+            output.G = G / samples;
+            output.B = B / samples;
+        }
+
+        start = end;
+    }
+
+    for (uint16_t i = 0; i < pixelCount; i++) {
+        pixelColors[i].R = colorBuffer[i].R;
+        pixelColors[i].G = colorBuffer[i].G;
+        pixelColors[i].B = colorBuffer[i].B;
+    }
+}
@@ -0,0 +1,45 @@
+/**
+ * @file boxblur.hpp
+ * @brief Declares the `BoxBlur` helper shared by the line blur effects.
+ *
+ * Horizontal and vertical blurs only differ in the traversal order they walk and the neighbor
+ * that continues a line. `BoxBlur` runs the averaging pass for either direction.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include "../core/ipixelgroup.hpp"
+
+/**
+ * @class BoxBlur
+ * @brief Averages each pixel over a window along the lines of a traversal order.
+ *
+ * A line is a run of the order where each pixel is the given neighbor of the one before it.
+ * The window moves along each line with a running sum, so the cost per pixel does not depend
+ * on the blur range.
+ */
+class BoxBlur {
+public:
+    /**
+     * @brief Neighbor lookup of `IPixelGroup` that continues a line, such as GetRightIndex.
+     */
+    typedef bool (IPixelGroup::*NeighborIndex)(uint16_t count, uint16_t* index);
+
+    /**
+     * @brief Blurs the colors of a pixel group along the lines of a traversal order.
+     *
+     * Each pixel is replaced by the average of the pixels within the range on either side of
+     * it, clamped to its line. The color buffer of the pixel group holds the result until it
+     * is copied back.
+     *
+     * @param pixelGroup Pixel group to blur.
+     * @param order Traversal order, such as the row or column order of the pixel group.
+     * @param next Neighbor lookup that steps along a line of the order.
+     * @param range Number of pixels on each side of a pixel included in its average.
+     */
+    static void Apply(IPixelGroup* pixelGroup, const uint16_t* order, NeighborIndex next, uint16_t range);
+};
@@ -13,39 +13,38 @@ void Fisheye::SetAmplitude(float amplitude) {
 void Fisheye::ApplyEffect(IPixelGroup* pixelGroup) {
     RGBColor* pixelColors = pixelGroup->GetColors();
     RGBColor* colorBuffer = pixelGroup->GetColorBuffer();
-    Vector2D mid = pixelGroup->GetCenterCoordinate();
-    float halfWidth = 48.0f; // fGenSize.Update();
-    uint16_t tIndex = 0;
 
-    amplitude = fGenWarp.Update() * ratio;
+    // Coarse steps keep the animated parameters on one table for several frames, the warp is
+    // snapped before scaling so small ratios do not collapse it to a zero exponent
+    amplitude = Mathematics::Max(1.0f, RemapTable::Snap(fGenWarp.Update(), kWarpStep)) * ratio;
 
-    offset.X = fGenX.Update() * ratio;
-    offset.Y = fGenY.Update() * ratio;
+    offset.X = RemapTable::Snap(fGenX.Update() * ratio, kOffsetStep);
+    offset.Y = RemapTable::Snap(fGenY.Update() * ratio, kOffsetStep);
 
-    for (uint16_t i = 0; i < pixelGroup->GetPixelCount(); i++) {
-        Vector2D pos = pixelGroup->GetCoordinate(i) + offset;
-        Vector2D dif = pos - mid;
-        float distance = fabsf(pos.CalculateEuclideanDistance(mid));
-
-        float r = distance / halfWidth;
-        float theta = atan2(dif.Y, dif.X);
-        float newDistance = powf(r, amplitude);
-
-        int offsetX = (int)(newDistance * cosf(theta));
-        int offsetY = (int)(newDistance * sinf(theta));
-
-        // Use this function to find the index of the pixel at the offset x y pixel
-        if (pixelGroup->GetOffsetXYIndex(i, &tIndex, offsetX, offsetY)) {
-            colorBuffer[i].R = pixelColors[tIndex].R; // copy the current pixel color into the buffer
-            colorBuffer[i].G = pixelColors[tIndex].G;
-            colorBuffer[i].B = pixelColors[tIndex].B;
-        } else {
-            colorBuffer[i].R = 0; // copy the current pixel color into the buffer
-            colorBuffer[i].G = 0;
-            colorBuffer[i].B = 0;
+    float parameters[3] = { amplitude, offset.X, offset.Y };
+
+    // Rebuild the displacement table only when the snapped warp parameters change
+    if (table.Prepare(pixelGroup, parameters, 3)) {
+        Vector2D mid = pixelGroup->GetCenterCoordinate();
+        float halfWidth = 48.0f; // fGenSize.Update();
+
+        PixelCoordinates coordinates = pixelGroup->GetCoordinates();
+
+        for (uint16_t i = 0; i < pixelGroup->GetPixelCount(); i++) {
+            Vector2D pos = coordinates[i] + offset;
+            Vector2D dif = pos - mid;
+            float distance = fabsf(pos.CalculateEuclideanDistance(mid));
+
+            float r = distance / halfWidth;
+            float theta = atan2f(dif.Y, dif.X);
+            float newDistance = powf(r, amplitude);
+
+            table.SetOffset(pixelGroup, i, newDistance * cosf(theta), newDistance * sinf(theta));
         }
     }
 
+    table.Gather(pixelColors, colorBuffer);
+
     for (uint16_t i = 0; i < pixelGroup->GetPixelCount(); i++) {
         pixelColors[i].R = colorBuffer[i].R;
         pixelColors[i].G = colorBuffer[i].G;
@@ -12,9 +12,10 @@
 
 #pragma once
 
-#include "Effect.h"
-#include "../../Utils/Signals/FunctionGenerator.h"
-#include "../../Utils/Math/Vector2D.h"
+#include "../effect.hpp"
+#include "../remaptable.hpp"
+#include "../../../../core/signal/functiongenerator.hpp"
+#include "../../../../core/math/vector2d.hpp"
 
 /**
  * @class Fisheye
@@ -25,12 +26,16 @@
  */
 class Fisheye : public Effect {
 private:
+    static constexpr float kWarpStep = 5.0f; ///< Snapping of the warp generator, about 20 tables over its range.
+    static constexpr float kOffsetStep = 8.0f; ///< Snapping of the distortion center in pixels.
+
     Vector2D offset = Vector2D(0.0f, 0.0f); ///< Offset for the fisheye distortion center.
     float amplitude; ///< Amplitude of the distortion effect.
     FunctionGenerator fGenSize = FunctionGenerator(FunctionGenerator::Sine, 1.0f, 48.0f, 2.3f); ///< Controls the size modulation.
     FunctionGenerator fGenX = FunctionGenerator(FunctionGenerator::Sine, -96.0f, 96.0f, 2.7f); ///< Controls X-axis displacement.
     FunctionGenerator fGenY = FunctionGenerator(FunctionGenerator::Sine, -96.0f, 96.0f, 1.7f); ///< Controls Y-axis displacement.
     FunctionGenerator fGenWarp = FunctionGenerator(FunctionGenerator::Sine, 1.0f, 100.0f, 3.7f); ///< Controls warp effect.
+    RemapTable table; ///< Cached source pixels for the current warp parameters.
 
 public:
     /**
@@ -12,8 +12,8 @@
 
 #pragma once
 
-#include "Effect.h"
-#include "../../Utils/Math/Mathematics.h"
+#include "../effect.hpp"
+#include "../boxblur.hpp"
 
 /**
  * @class HorizontalBlur
@@ -36,10 +36,11 @@ public:
 
     /**
      * @brief Applies the horizontal blur effect to the given pixel group.
-     * 
-     * This method blends the colors of neighboring pixels along the X-axis to create
-     * a smooth transition effect.
-     * 
+     *
+     * Each pixel is replaced by the average of the pixels within the blur radius along its
+     * row. The rows are walked in the pixel group's precomputed row order with a running
+     * sum, so the cost per pixel does not depend on the blur radius.
+     *
      * @param pixelGroup Pointer to the `IPixelGroup` to which the effect will be applied.
      */
     void ApplyEffect(IPixelGroup* pixelGroup) override;
@@ -12,8 +12,9 @@
 
 #pragma once
 
-#include "Effect.h"
-#include "../../Utils/Signals/FunctionGenerator.h"
+#include "../effect.hpp"
+#include "../remaptable.hpp"
+#include "../../../../core/signal/functiongenerator.hpp"
 
 /**
  * @class Magnet
@@ -30,6 +31,7 @@ private:
     FunctionGenerator fGenX = FunctionGenerator(FunctionGenerator::Sine, -96.0f, 96.0f, 2.7f); ///< Generator for X-axis warp dynamics.
     FunctionGenerator fGenY = FunctionGenerator(FunctionGenerator::Sine, -96.0f, 96.0f, 1.7f); ///< Generator for Y-axis warp dynamics.
     FunctionGenerator fGenWarp = FunctionGenerator(FunctionGenerator::Sine, 1.0f, 100.0f, 3.7f); ///< Generator for warp intensity dynamics.
+    RemapTable table; ///< Cached source pixels for the current warp parameters.
 
 public:
     /**
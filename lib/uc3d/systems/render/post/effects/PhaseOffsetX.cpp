@@ -1,5 +1,4 @@
 #include "PhaseOffsetX.h"
-#include "../../Utils/Math/Mathematics.h"
 
 PhaseOffsetX::PhaseOffsetX(uint8_t pixels) : pixels(pixels) {}
 
@@ -9,40 +8,39 @@ void PhaseOffsetX::ApplyEffect(IPixelGroup* pixelGroup) {
     RGBColor* pixelColors = pixelGroup->GetColors();
     RGBColor* colorBuffer = pixelGroup->GetColorBuffer();
 
-    for (uint16_t i = 0; i < pixelGroup->GetPixelCount(); i++) {
-        float range = ((pixels - 1) * ratio + 1) / 2.0f;
-        float coordY = pixelGroup->GetCoordinate(i).Y / 10.0f;
-        float mpiR = 2.0f * Mathematics::MPI * fGenPhase.Update();
-        float sineR = sinf(coordY + mpiR * 8.0f);
-        float sineG = sinf(coordY + mpiR * 8.0f + 2.0f * Mathematics::MPI * 0.333f);
-        float sineB = sinf(coordY + mpiR * 8.0f + 2.0f * Mathematics::MPI * 0.666f);
-
-        int8_t blurRangeR = Mathematics::Constrain(int8_t(Mathematics::Map(sineR, -1.0f, 1.0f, -range, range)), int8_t(-range), int8_t(range));
-        int8_t blurRangeG = Mathematics::Constrain(int8_t(Mathematics::Map(sineG, -1.0f, 1.0f, -range, range)), int8_t(-range), int8_t(range));
-        int8_t blurRangeB = Mathematics::Constrain(int8_t(Mathematics::Map(sineB, -1.0f, 1.0f, -range, range)), int8_t(-range), int8_t(range));
-
-        uint16_t indexR = 0, indexG = 0, indexB = 0;
-
-        bool validR = pixelGroup->GetOffsetXIndex(i, &indexR, blurRangeR);
-        bool validG = pixelGroup->GetOffsetXIndex(i, &indexG, blurRangeG);
-        bool validB = pixelGroup->GetOffsetXIndex(i, &indexB, blurRangeB);
-
-        if (validR)
-            colorBuffer[i].R = pixelColors[indexR].R;
-        else
-            colorBuffer[i].R = 0;
-
-        if (validG)
-            colorBuffer[i].G = pixelColors[indexG].G;
-        else
-            colorBuffer[i].G = 0;
-
-        if (validB)
-            colorBuffer[i].B = pixelColors[indexB].B;
-        else
-            colorBuffer[i].B = 0;
+    float range = ((pixels - 1) * ratio + 1) / 2.0f;
+    float phase = RemapTable::Snap(fGenPhase.Update(), 1.0f / 64.0f);
+    float parameters[2] = { range, phase };
+
+    // The offsets only depend on the range and phase, snapped to 64 steps per period
+    if (tableR.Prepare(pixelGroup, parameters, 2)) {
+        tableG.Prepare(pixelGroup, parameters, 2);
+        tableB.Prepare(pixelGroup, parameters, 2);
+
+        float mpiR = 2.0f * Mathematics::MPI * phase;
+
+        PixelCoordinates coordinates = pixelGroup->GetCoordinates();
+
+        for (uint16_t i = 0; i < pixelGroup->GetPixelCount(); i++) {
+            float coordY = coordinates[i].Y / 10.0f;
+            float sineR = sinf(coordY + mpiR * 8.0f);
+            float sineG = sinf(coordY + mpiR * 8.0f + 2.0f * Mathematics::MPI * 0.333f);
+            float sineB = sinf(coordY + mpiR * 8.0f + 2.0f * Mathematics::MPI * 0.666f);
+
+            int8_t blurRangeR = Mathematics::Constrain(int8_t(Mathematics::Map(sineR, -1.0f, 1.0f, -range, range)), int8_t(-range), int8_t(range));
+            int8_t blurRangeG = Mathematics::Constrain(int8_t(Mathematics::Map(sineG, -1.0f, 1.0f, -range, range)), int8_t(-range), int8_t(range));
+            int8_t blurRangeB = Mathematics::Constrain(int8_t(Mathematics::Map(sineB, -1.0f, 1.0f, -range, range)), int8_t(-range), int8_t(range));
+
+            tableR.SetOffset(pixelGroup, i, blurRangeR, 0.0f);
+            tableG.SetOffset(pixelGroup, i, blurRangeG, 0.0f);
+            tableB.SetOffset(pixelGroup, i, blurRangeB, 0.0f);
+        }
     }
 
+    tableR.Gather(pixelColors, colorBuffer, RemapTable::Red);
+    tableG.Gather(pixelColors, colorBuffer, RemapTable::Green);
+    tableB.Gather(pixelColors, colorBuffer, RemapTable::Blue);
+
     for (uint16_t i = 0; i < pixelGroup->GetPixelCount(); i++) {
         pixelColors[i].R = colorBuffer[i].R;
         pixelColors[i].G = colorBuffer[i].G;
@@ -12,9 +12,9 @@
 
 #pragma once
 
-#include "Effect.h"
-#include "../../Utils/Signals/FunctionGenerator.h"
-#include "../../Utils/Math/Mathematics.h"
+#include "../effect.hpp"
+#include "../remaptable.hpp"
+#include "../../../../core/signal/functiongenerator.hpp"
 
 /**
  * @class PhaseOffsetX
@@ -30,6 +30,10 @@ private:
     /// Function generator for horizontal phase offsets.
     FunctionGenerator fGenPhase = FunctionGenerator(FunctionGenerator::Sawtooth, 0.0f, 1.0f, 3.5f);
 
+    RemapTable tableR; ///< Cached source pixels of the red channel.
+    RemapTable tableG; ///< Cached source pixels of the green channel.
+    RemapTable tableB; ///< Cached source pixels of the blue channel.
+
 public:
     /**
      * @brief Constructs a `PhaseOffsetX` effect instance.
@@ -1,5 +1,4 @@
 #include "ShiftR.h"
-#include "../../Utils/Math/Mathematics.h"
 
 ShiftR::ShiftR(uint8_t pixels) : pixels(pixels) {}
 
@@ -8,28 +7,33 @@ void ShiftR::ApplyEffect(IPixelGroup* pixelGroup) {
     RGBColor* pixelColors = pixelGroup->GetColors();
     RGBColor* colorBuffer = pixelGroup->GetColorBuffer();
 
-    float rotation = fGenRotation.Update();
+    float rotation = RemapTable::Snap(fGenRotation.Update(), 2.0f);
+    uint8_t range = (uint8_t)Mathematics::Map(ratio, 0.0f, 1.0f, 0.0f, (float)pixels);
+    float parameters[2] = { rotation, float(range) };
 
-    for (uint16_t i = 0; i < pixelCount; i++) {
-        uint16_t indexR, indexG, indexB;
-        bool validR, validG, validB;
-
-        uint8_t range = (uint8_t)Mathematics::Map(ratio, 0.0f, 1.0f, 0.0f, (float)pixels);
+    // Every pixel shifts by the same radial step, rebuild on a 2 degree rotation grid
+    if (tableR.Prepare(pixelGroup, parameters, 2)) {
+        tableG.Prepare(pixelGroup, parameters, 2);
+        tableB.Prepare(pixelGroup, parameters, 2);
 
-        validR = pixelGroup->GetRadialIndex(i, &indexR, range, rotation);
-        validG = pixelGroup->GetRadialIndex(i, &indexG, range, rotation + 120.0f);
-        validB = pixelGroup->GetRadialIndex(i, &indexB, range, rotation + 240.0f);
+        for (uint16_t i = 0; i < pixelCount; i++) {
+            uint16_t indexR, indexG, indexB;
+            bool validR, validG, validB;
 
-        if (validR) colorBuffer[i].R = pixelColors[indexR].R;
-        else colorBuffer[i].R = 0;
+            validR = pixelGroup->GetRadialIndex(i, &indexR, range, rotation);
+            validG = pixelGroup->GetRadialIndex(i, &indexG, range, rotation + 120.0f);
+            validB = pixelGroup->GetRadialIndex(i, &indexB, range, rotation + 240.0f);
 
-        if (validG) colorBuffer[i].G = pixelColors[indexG].G;
-        else colorBuffer[i].G = 0;
-
-        if (validB) colorBuffer[i].B = pixelColors[indexB].B;
-        else colorBuffer[i].B = 0;
+            tableR.SetSource(i, indexR, validR);
+            tableG.SetSource(i, indexG, validG);
+            tableB.SetSource(i, indexB, validB);
+        }
     }
 
+    tableR.Gather(pixelColors, colorBuffer, RemapTable::Red);
+    tableG.Gather(pixelColors, colorBuffer, RemapTable::Green);
+    tableB.Gather(pixelColors, colorBuffer, RemapTable::Blue);
+
     for (uint16_t i = 0; i < pixelCount; i++) {
         pixelColors[i].R = colorBuffer[i].R;
         pixelColors[i].G = colorBuffer[i].G;
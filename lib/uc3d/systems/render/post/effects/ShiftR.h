@@ -12,9 +12,9 @@
 
 #pragma once
 
-#include "Effect.h"
-#include "../../Utils/Signals/FunctionGenerator.h"
-#include "../../Utils/Math/Mathematics.h"
+#include "../effect.hpp"
+#include "../remaptable.hpp"
+#include "../../../../core/signal/functiongenerator.hpp"
 
 /**
  * @class ShiftR
@@ -36,6 +36,10 @@ private:
     /// Function generator for the overall rotation.
     FunctionGenerator fGenRotation = FunctionGenerator(FunctionGenerator::Sawtooth, 0.0f, 360.0f, 3.7f);
 
+    RemapTable tableR; ///< Cached source pixels of the red channel.
+    RemapTable tableG; ///< Cached source pixels of the green channel.
+    RemapTable tableB; ///< Cached source pixels of the blue channel.
+
 public:
     /**
      * @brief Constructs a `ShiftR` effect instance.
@@ -12,7 +12,8 @@
 
 #pragma once
 
-#include "Effect.h"
+#include "../effect.hpp"
+#include "../boxblur.hpp"
 
 /**
  * @class VerticalBlur
@@ -37,8 +38,9 @@ public:
     /**
      * @brief Applies the vertical blur effect to the given pixel group.
      *
-     * The effect calculates an average color value for each pixel by considering
-     * neighboring pixels within the specified vertical radius.
+     * Each pixel is replaced by the average of the pixels within the blur radius along its
+     * column. The columns are walked in the pixel group's precomputed column order with a running
+     * sum, so the cost per pixel does not depend on the blur radius.
      *
      * @param pixelGroup Pointer to the `IPixelGroup` to which the effect will be applied.
      */
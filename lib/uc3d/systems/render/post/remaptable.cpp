@@ -0,0 +1,162 @@
+#include "remaptable.hpp"
+
+RemapTable::RemapTable(Filter filter) : filter(filter) {}
+
+RemapTable::~RemapTable() {
+    for (uint8_t i = 0; i < kMaxGroups; i++) {
+        delete[] entries[i].sources;
+        delete[] entries[i].weights;
+    }
+}
+
+RemapTable::Entry* RemapTable::Select(IPixelGroup* pixelGroup) {
+    Entry* oldest = &entries[0];
+
+    for (uint8_t i = 0; i < kMaxGroups; i++) {
+        if (entries[i].pixelGroup == pixelGroup) return &entries[i];
+
+        // Unused entries were never prepared and count as the oldest
+        if (entries[i].lastUse < oldest->lastUse) oldest = &entries[i];
+    }
+
+    oldest->pixelGroup = pixelGroup;
+    oldest->valid = false;
+
+    return oldest;
+}
+
+bool RemapTable::Prepare(IPixelGroup* pixelGroup, const float* parameters, uint8_t count) {
+    count = count > kMaxParameters ? kMaxParameters : count;
+    current = Select(pixelGroup);
+    current->lastUse = ++useCounter;
+
+    Entry& entry = *current;
+    bool stale = !entry.valid || entry.parameterCount != count;
+
+    for (uint8_t i = 0; i < count && !stale; i++) {
+        stale = entry.parameters[i] != parameters[i];
+    }
+
+    if (!stale) return false;
+
+    if (entry.pixelCount != pixelGroup->GetPixelCount()) {
+        delete[] entry.sources;
+        delete[] entry.weights;
+
+        entry.pixelCount = pixelGroup->GetPixelCount();
+        entry.sources = new uint16_t[filter == Bilinear ? entry.pixelCount * 4 : entry.pixelCount];
+        entry.weights = filter == Bilinear ? new uint8_t[entry.pixelCount * 2] : nullptr;
+    }
+
+    entry.valid = true;
+    entry.parameterCount = count;
+
+    for (uint8_t i = 0; i < count; i++) {
+        entry.parameters[i] = parameters[i];
+    }
+
+    return true;
+}
+
+void RemapTable::Invalidate() {
+    for (uint8_t i = 0; i < kMaxGroups; i++) {
+        entries[i].valid = false;
+    }
+}
+
+void RemapTable::SetSource(uint16_t pixel, uint16_t source, bool valid) {
+    if (filter == Bilinear) {
+        current->sources[pixel * 4] = valid ? source : kInvalid;
+        current->sources[pixel * 4 + 1] = kInvalid;
+        current->sources[pixel * 4 + 2] = kInvalid;
+        current->sources[pixel * 4 + 3] = kInvalid;
+        current->weights[pixel * 2] = 0;
+        current->weights[pixel * 2 + 1] = 0;
+    }
+    else {
+        current->sources[pixel] = valid ? source : kInvalid;
+    }
+}
+
+void RemapTable::SetOffset(IPixelGroup* pixelGroup, uint16_t pixel, float offsetX, float offsetY) {
+    uint16_t index = 0;
+
+    if (filter == Nearest) {
+        bool valid = pixelGroup->GetOffsetXYIndex(pixel, &index, int(offsetX), int(offsetY));
+
+        SetSource(pixel, index, valid);
+
+        return;
+    }
+
+    float floorX = floorf(offsetX);
+    float floorY = floorf(offsetY);
+    uint16_t weightX = uint16_t((offsetX - floorX) * 256.0f);
+    uint16_t weightY = uint16_t((offsetY - floorY) * 256.0f);
+
+    // Offsets just below a whole pixel round to a full step, which belongs to the next pixel
+    if (weightX > 255) {
+        floorX += 1.0f;
+        weightX = 0;
+    }
+
+    if (weightY > 255) {
+        floorY += 1.0f;
+        weightY = 0;
+    }
+
+    uint16_t* taps = &current->sources[pixel * 4];
+
+    bool valid = pixelGroup->GetOffsetXYIndex(pixel, &index, int(floorX), int(floorY));
+
+    taps[0] = valid ? index : kInvalid;
+    taps[1] = valid && pixelGroup->GetRightIndex(taps[0], &index) ? index : kInvalid;
+    taps[2] = valid && pixelGroup->GetUpIndex(taps[0], &index) ? index : kInvalid;
+    taps[3] = taps[2] != kInvalid && pixelGroup->GetRightIndex(taps[2], &index) ? index : kInvalid;
+
+    current->weights[pixel * 2] = uint8_t(weightX);
+    current->weights[pixel * 2 + 1] = uint8_t(weightY);
+}
+
+void RemapTable::Gather(const RGBColor* source, RGBColor* destination, uint8_t channels) const {
+    static const RGBColor black;
+
+    if (!current) return;
+
+    if (filter == Nearest) {
+        for (uint16_t i = 0; i < current->pixelCount; i++) {
+            const RGBColor& color = current->sources[i] < kInvalid ? source[current->sources[i]] : black;
+
+            if (channels & Red) destination[i].R = color.R;
+            if (channels & Green) destination[i].G = color.G;
+            if (channels & Blue) destination[i].B = color.B;
+        }
+
+        return;
+    }
+
+    for (uint16_t i = 0; i < current->pixelCount; i++) {
+        const uint16_t* taps = &current->sources[i * 4];
+        const RGBColor& c00 = taps[0] < kInvalid ? source[taps[0]] : black;
+        const RGBColor& c10 = taps[1] < kInvalid ? source[taps[1]] : black;
+        const RGBColor& c01 = taps[2] < kInvalid ? source[taps[2]] : black;
+        const RGBColor& c11 = taps[3] < kInvalid ? source[taps[3]] : black;
+
+        uint32_t wx = current->weights[i * 2];
+        uint32_t wy = current->weights[i * 2 + 1];
+        uint32_t w00 = (256 - wx) * (256 - wy);
+        uint32_t w10 = wx * (256 - wy);
+        uint32_t w01 = (256 - wx) * wy;
+        uint32_t w11 = wx * wy;
+
+        if (channels & Red) destination[i].R = (c00.R * w00 + c10.R * w10 + c01.R * w01 + c11.R * w11) >> 16;
+        if (channels & Green) destination[i].G = (c00.G * w00 + c10.G * w10 + c01.G * w01 + c11.G * w11) >> 16;
+        if (channels & Blue) destination[i].B = (c00.B * w00 + c10.B * w10 + c01.B * w01 + c11.B * w11) >> 16;
+    }
+}
+
+float RemapTable::Snap(float value, float step) {
+    if (step <= 0.0f) return value;
+
+    return roundf(value / step) * step;
+}
@@ -0,0 +1,170 @@
+/**
+ * @file remaptable.hpp
+ * @brief Declares the `RemapTable` class for baking per-pixel displacement lookups.
+ *
+ * Warp effects displace each pixel by an offset that only depends on a handful of
+ * parameters. A `RemapTable` stores the resulting source indices (and optionally
+ * bilinear weights) so the table is rebuilt only when those parameters change, and
+ * applying the warp becomes a single gather pass. One table is kept per pixel group, so an
+ * effect shared by several cameras does not rebuild on every call.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include "../core/ipixelgroup.hpp"
+#include "../../../core/math/mathematics.hpp"
+
+/**
+ * @class RemapTable
+ * @brief Caches the source pixel of every destination pixel for a given parameter set.
+ *
+ * Typical usage inside an effect:
+ * @code
+ * float parameters[2] = { RemapTable::Snap(rotation, 2.0f), range };
+ *
+ * if (table.Prepare(pixelGroup, parameters, 2)) {
+ *     for (uint16_t i = 0; i < pixelGroup->GetPixelCount(); i++) {
+ *         table.SetOffset(pixelGroup, i, offsetX, offsetY);
+ *     }
+ * }
+ *
+ * table.Gather(pixelGroup->GetColors(), pixelGroup->GetColorBuffer());
+ * @endcode
+ *
+ * Up to kMaxGroups pixel groups keep their own table and parameter set, further groups
+ * replace the least recently prepared one. SetSource, SetOffset and Gather act on the table
+ * selected by the last call to Prepare.
+ */
+class RemapTable {
+public:
+    /**
+     * @enum Filter
+     * @brief Specifies how displaced samples are read back.
+     */
+    enum Filter {
+        Nearest, ///< A single source pixel per destination pixel.
+        Bilinear ///< Four source pixels blended by the fractional offset.
+    };
+
+    /**
+     * @enum Channel
+     * @brief Bit mask selecting which color channels a gather writes.
+     */
+    enum Channel : uint8_t {
+        Red = 1,   ///< Red channel.
+        Green = 2, ///< Green channel.
+        Blue = 4,  ///< Blue channel.
+        All = 7    ///< All color channels.
+    };
+
+    static constexpr uint8_t kMaxParameters = 4; ///< Maximum number of parameters used as the table key.
+    static constexpr uint8_t kMaxGroups = 4; ///< Number of pixel groups holding a table at the same time.
+    static constexpr uint16_t kInvalid = 65535; ///< Source index marking a sample outside the pixel group.
+
+private:
+    /**
+     * @struct Entry
+     * @brief The table of one pixel group and the parameter set it was built for.
+     */
+    struct Entry {
+        IPixelGroup* pixelGroup = nullptr; ///< Pixel group the table was built for.
+        uint16_t pixelCount = 0; ///< Number of destination pixels in the table.
+        uint16_t* sources = nullptr; ///< Source indices, one per pixel (four per pixel for bilinear).
+        uint8_t* weights = nullptr; ///< Fractional X and Y weights per pixel in 1/256 steps (bilinear only).
+        float parameters[kMaxParameters]; ///< Parameter set the table was built for.
+        uint8_t parameterCount = 0; ///< Number of valid entries in the parameter set.
+        bool valid = false; ///< False until the table was built, or after Invalidate.
+        uint32_t lastUse = 0; ///< Value of the use counter when the entry was last prepared.
+    };
+
+    Filter filter; ///< Sampling filter used when building and gathering.
+    Entry entries[kMaxGroups]; ///< Tables of the pixel groups seen most recently.
+    Entry* current = nullptr; ///< Entry selected by the last call to Prepare.
+    uint32_t useCounter = 0; ///< Incremented on every Prepare to find the least recently used entry.
+
+    /**
+     * @brief Finds the entry of a pixel group, or the entry to replace for a new group.
+     */
+    Entry* Select(IPixelGroup* pixelGroup);
+
+public:
+    /**
+     * @brief Constructs an empty `RemapTable`.
+     *
+     * @param filter Sampling filter used by the table (default: Nearest).
+     */
+    RemapTable(Filter filter = Nearest);
+
+    /**
+     * @brief Destroys the table and releases its storage.
+     */
+    ~RemapTable();
+
+    RemapTable(const RemapTable&) = delete;
+    RemapTable& operator=(const RemapTable&) = delete;
+
+    /**
+     * @brief Prepares the table for a pixel group and parameter set.
+     *
+     * Selects the table of the pixel group, allocates storage on first use and records the
+     * parameter set as the table key.
+     *
+     * @param pixelGroup Pixel group the table maps.
+     * @param parameters Array of parameters that fully determine the displacement.
+     * @param count Number of parameters, at most kMaxParameters.
+     * @return True if the table is stale and every pixel must be set again, otherwise false.
+     */
+    bool Prepare(IPixelGroup* pixelGroup, const float* parameters, uint8_t count);
+
+    /**
+     * @brief Forces the next call to Prepare to report a stale table, for every pixel group.
+     */
+    void Invalidate();
+
+    /**
+     * @brief Sets the source pixel of a destination pixel directly.
+     *
+     * @param pixel Destination pixel index.
+     * @param source Source pixel index.
+     * @param valid False if the sample falls outside the pixel group.
+     */
+    void SetSource(uint16_t pixel, uint16_t source, bool valid);
+
+    /**
+     * @brief Sets the source of a destination pixel from a displacement in pixel steps.
+     *
+     * Nearest tables truncate the offset toward zero, bilinear tables store the four
+     * surrounding pixels along with the fractional weights.
+     *
+     * @param pixelGroup Pixel group used to walk to the displaced pixel.
+     * @param pixel Destination pixel index.
+     * @param offsetX Displacement along the X-axis in pixels.
+     * @param offsetY Displacement along the Y-axis in pixels.
+     */
+    void SetOffset(IPixelGroup* pixelGroup, uint16_t pixel, float offsetX, float offsetY);
+
+    /**
+     * @brief Gathers displaced colors from a source array into a destination array.
+     *
+     * Samples outside the pixel group resolve to black. Channels not selected by the
+     * mask are left untouched in the destination.
+     *
+     * @param source Colors to sample from.
+     * @param destination Colors to write, must not alias source.
+     * @param channels Bit mask of channels to write (default: All).
+     */
+    void Gather(const RGBColor* source, RGBColor* destination, uint8_t channels = All) const;
+
+    /**
+     * @brief Snaps a parameter to a coarse grid so nearby values share a table.
+     *
+     * @param value The parameter value.
+     * @param step Grid spacing, values less than or equal to zero disable snapping.
+     * @return The value rounded to the nearest grid point.
+     */
+    static float Snap(float value, float step);
+};
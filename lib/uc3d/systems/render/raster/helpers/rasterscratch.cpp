@@ -0,0 +1,44 @@
+#include "rasterscratch.hpp"
+
+RasterScratch::~RasterScratch() {
+    delete[] meshes;
+    delete[] meshStarts;
+    delete[] sceneIndices;
+    delete[] visibleIndices;
+    delete[] sources;
+    delete[] entries;
+    delete[] records;
+    delete[] samples;
+}
+
+void RasterScratch::Reserve(uint8_t meshCount) {
+    if (meshCount <= capacity && meshStarts) return;
+
+    delete[] meshes;
+    delete[] meshStarts;
+    delete[] sceneIndices;
+    delete[] visibleIndices;
+    delete[] sources;
+    delete[] entries;
+    delete[] records;
+
+    capacity = meshCount;
+    meshes = new Mesh*[capacity];
+    meshStarts = new uint32_t[capacity + 1];
+    sceneIndices = new uint8_t[capacity];
+    visibleIndices = new uint8_t[capacity];
+    sources = new const RasterTriangle2D*[capacity];
+    entries = new FrameHistory::Entry[capacity];
+    records = new TriangleCache::Record[capacity];
+}
+
+RasterScratch::PixelSample* RasterScratch::GetSamples(uint16_t pixelCount) {
+    if (pixelCount > sampleCapacity || !samples) {
+        delete[] samples;
+
+        sampleCapacity = pixelCount;
+        samples = new PixelSample[sampleCapacity];
+    }
+
+    return samples;
+}
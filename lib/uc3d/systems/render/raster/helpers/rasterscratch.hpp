@@ -0,0 +1,77 @@
+/**
+ * @file rasterscratch.hpp
+ * @brief Per-frame working arrays of the rasterizer, kept between frames.
+ * @date  16/10/2026
+ * @author Coela Can't
+ */
+#pragma once
+
+#include <cstdint>
+#include "rastertriangle2d.hpp"
+#include "trianglecache.hpp"
+#include "../../core/framehistory.hpp"
+
+class Mesh;
+
+/**
+ * @class RasterScratch
+ * @brief Arrays the rasterizer fills every frame, grown only when the mesh or pixel count increases.
+ *
+ * Every camera owns one. Cameras rendered as a group use the arrays of the group's first
+ * camera, and a camera belongs to one group per frame, so groups rendered concurrently never
+ * share arrays. The contents only have meaning during one Rasterizer::Rasterize call.
+ */
+class RasterScratch {
+public:
+    /**
+     * @struct PixelSample
+     * @brief Closest hit of a pixel, kept between the passes of reduced-rate shading.
+     */
+    struct PixelSample {
+        const RasterTriangle2D* triangle; ///< Closest triangle, nullptr if none or outside the shaded region.
+        float u; ///< Barycentric weight of the first vertex.
+        float v; ///< Barycentric weight of the second vertex.
+        float w; ///< Barycentric weight of the third vertex.
+    };
+
+    Mesh** meshes = nullptr; ///< Visible meshes.
+    uint32_t* meshStarts = nullptr; ///< First triangle of each visible mesh, followed by the total.
+    uint8_t* sceneIndices = nullptr; ///< Scene index of each visible mesh.
+    uint8_t* visibleIndices = nullptr; ///< Visible index of each scene mesh.
+    const RasterTriangle2D** sources = nullptr; ///< Cached triangles of each visible mesh.
+    FrameHistory::Entry* entries = nullptr; ///< State of each visible mesh for the frame history.
+    TriangleCache::Record* records = nullptr; ///< Location of each visible mesh for the triangle cache.
+
+private:
+    uint8_t capacity = 0; ///< Allocated number of meshes.
+    PixelSample* samples = nullptr; ///< Visibility of each pixel of the camera.
+    uint16_t sampleCapacity = 0; ///< Allocated number of samples.
+
+public:
+    RasterScratch() = default;
+
+    /**
+     * @brief Releases the arrays.
+     */
+    ~RasterScratch();
+
+    RasterScratch(const RasterScratch&) = delete;
+    RasterScratch& operator=(const RasterScratch&) = delete;
+
+    /**
+     * @brief Grows the mesh arrays to hold a number of meshes, keeping them if they already do.
+     *
+     * @param meshCount Number of meshes in the scene.
+     */
+    void Reserve(uint8_t meshCount);
+
+    /**
+     * @brief Retrieves the samples of the camera's own pixels for reduced-rate shading.
+     *
+     * Unlike the mesh arrays, these belong to each camera of a group.
+     *
+     * @param pixelCount Number of pixels rendered by the camera.
+     * @return Array of at least pixelCount samples.
+     */
+    PixelSample* GetSamples(uint16_t pixelCount);
+};
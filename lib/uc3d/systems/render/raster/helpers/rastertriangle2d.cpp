@@ -2,18 +2,18 @@
 
 RasterTriangle2D::RasterTriangle2D()
     : Triangle2D(),
-      t3p1(nullptr), t3p2(nullptr), t3p3(nullptr), normal(nullptr),
+      t3p1(nullptr), t3p2(nullptr), t3p3(nullptr),
       material(nullptr), p1UV(nullptr), p2UV(nullptr), p3UV(nullptr),
-      hasUV(false), averageDepth(0.0f), denominator(0.0f), bounds(Rectangle2D(Vector2D(0.0f, 0.0f), Vector2D(1.0f, 1.0f))){}
+      hasUV(false), averageDepth(0.0f), depth1(0.0f), depth2(0.0f), depth3(0.0f), minimumDepth(0.0f), denominator(0.0f), bounds(Rectangle2D(Vector2D(0.0f, 0.0f), Vector2D(1.0f, 1.0f))){}
 
-RasterTriangle2D::RasterTriangle2D(const Transform& camTransform, const Quaternion& lookDirection,
-                                   const RasterTriangle3D& sourceTriangle, Material* mat) : bounds(Rectangle2D(Vector2D(0.0f, 0.0f), Vector2D(1.0f, 1.0f))) {
+RasterTriangle2D::RasterTriangle2D(const CameraProjection& projection,
+                                   const RasterTriangle3D& sourceTriangle, IMaterial* mat) : bounds(Rectangle2D(Vector2D(0.0f, 0.0f), Vector2D(1.0f, 1.0f))) {
     // --- Assign pointers to original 3D data ---
     this->material = mat;
     this->t3p1 = sourceTriangle.p1;
     this->t3p2 = sourceTriangle.p2;
     this->t3p3 = sourceTriangle.p3;
-    this->normal = &sourceTriangle.normal;
+    this->normal = sourceTriangle.normal;
 
     // --- Copy UV data if available ---
     this->hasUV = sourceTriangle.hasUV;
@@ -24,10 +24,9 @@ RasterTriangle2D::RasterTriangle2D(const Transform& camTransform, const Quaterni
     }
 
     // --- Project 3D vertices to 2D screen space ---
-    Quaternion inverseCamRotation = camTransform.GetRotation().Multiply(lookDirection).Conjugate();
-    Vector3D projectedP1 = inverseCamRotation.RotateVector(*t3p1 - camTransform.GetPosition()) / camTransform.GetScale();
-    Vector3D projectedP2 = inverseCamRotation.RotateVector(*t3p2 - camTransform.GetPosition()) / camTransform.GetScale();
-    Vector3D projectedP3 = inverseCamRotation.RotateVector(*t3p3 - camTransform.GetPosition()) / camTransform.GetScale();
+    Vector3D projectedP1 = projection.Project(*t3p1);
+    Vector3D projectedP2 = projection.Project(*t3p2);
+    Vector3D projectedP3 = projection.Project(*t3p3);
 
     // --- Set the 2D vertices in the base class ---
     this->p1 = Vector2D(projectedP1.X, projectedP1.Y);
@@ -36,6 +35,10 @@ RasterTriangle2D::RasterTriangle2D(const Transform& camTransform, const Quaterni
 
     // --- Calculate rendering data ---
     this->averageDepth = (projectedP1.Z + projectedP2.Z + projectedP3.Z) / 3.0f;
+    this->depth1 = projectedP1.Z;
+    this->depth2 = projectedP2.Z;
+    this->depth3 = projectedP3.Z;
+    this->minimumDepth = Mathematics::Min(projectedP1.Z, projectedP2.Z, projectedP3.Z);
 
     // --- Pre-calculate bounds and denominator for efficiency ---
     CalculateBoundsAndDenominator();
@@ -62,12 +65,37 @@ void RasterTriangle2D::CalculateBoundsAndDenominator() {
     float minY = Mathematics::Min(p1.Y, p2.Y, p3.Y);
     float maxX = Mathematics::Max(p1.X, p2.X, p3.X);
     float maxY = Mathematics::Max(p1.Y, p2.Y, p3.Y);
-    this->bounds = Rectangle2D(Vector2D(minX, minY), Vector2D(maxX, maxY));
+    this->bounds = Rectangle2D(Rectangle2D::Bounds{ Vector2D(minX, minY), Vector2D(maxX, maxY) });
+
+#if defined(UC3D_FIXED_RASTER)
+    // Vertices and the extent of the bounds must fit the storage type, so every edge and every
+    // pixel delta that passes the range check below does too. Larger triangles use the float path.
+    const float limit = float(std::numeric_limits<Fixed::StorageType>::max()) / float(Fixed::kOne);
+
+    fixedInRange = minX > -limit && minY > -limit && maxX < limit && maxY < limit &&
+                   maxX - minX < limit && maxY - minY < limit;
+
+    fixedX1 = Fixed(p1.X).GetRaw();
+    fixedY1 = Fixed(p1.Y).GetRaw();
+    fixedV0X = Fixed(v0.X).GetRaw();
+    fixedV0Y = Fixed(v0.Y).GetRaw();
+    fixedV1X = Fixed(v1.X).GetRaw();
+    fixedV1Y = Fixed(v1.Y).GetRaw();
+
+    Fixed::WideType area = Fixed::WideType(fixedV0X) * fixedV1Y - Fixed::WideType(fixedV1X) * fixedV0Y;
+
+    fixedFlipped = area < 0;
+    fixedArea = fixedFlipped ? -area : area;
+
+    // Weights are divided by the area at the fixed-point resolution, slivers below it are skipped
+    if ((fixedArea >> Fixed::kFractionBits) == 0) fixedArea = 0;
+#endif
 }
 
 bool RasterTriangle2D::GetBarycentricCoords(float x, float y, float& u, float& v, float& w) const {
-    // If triangle is degenerate, no point is inside.
-    if (Mathematics::FAbs(denominator) < Mathematics::EPSILON) return false;
+    // If triangle is degenerate, no point is inside. The stored value is the reciprocal, so
+    // large triangles have a tiny one and only the explicit zero marks a degenerate triangle.
+    if (denominator == 0.0f) return false;
 
     // Vector from the point to the triangle's first vertex
     Vector2D v2 = Vector2D(x, y) - p1;
@@ -81,12 +109,96 @@ bool RasterTriangle2D::GetBarycentricCoords(float x, float y, float& u, float& v
     return (v >= 0.0f) && (w >= 0.0f) && (u >= 0.0f);
 }
 
+RasterTriangle2D::Point RasterTriangle2D::PreparePoint(const Vector2D& pixel) {
+#if defined(UC3D_FIXED_RASTER)
+    return Point{ pixel.X, pixel.Y, Fixed(pixel.X).GetRaw(), Fixed(pixel.Y).GetRaw() };
+#else
+    return Point{ pixel.X, pixel.Y };
+#endif
+}
+
+#if defined(UC3D_FIXED_RASTER)
+bool RasterTriangle2D::GetEdgeFunctions(const Point& point, Fixed::WideType& edgeV, Fixed::WideType& edgeW) const {
+    Fixed::WideType wideDX = Fixed::WideType(point.fixedX) - fixedX1;
+    Fixed::WideType wideDY = Fixed::WideType(point.fixedY) - fixedY1;
+
+    // A delta beyond the storage type is further from the first vertex than the triangle is wide
+    if (wideDX < kFixedMin || wideDX > kFixedMax || wideDY < kFixedMin || wideDY > kFixedMax) return false;
+
+    Fixed::StorageType dx = Fixed::StorageType(wideDX);
+    Fixed::StorageType dy = Fixed::StorageType(wideDY);
+
+    // Only storage by storage products, which stay within the wide type
+    edgeV = Fixed::WideType(dx) * fixedV1Y - Fixed::WideType(fixedV1X) * dy;
+    edgeW = Fixed::WideType(fixedV0X) * dy - Fixed::WideType(dx) * fixedV0Y;
+
+    if (fixedFlipped) {
+        edgeV = -edgeV;
+        edgeW = -edgeW;
+    }
+
+    // The edge function of the first vertex is what remains of the area, compared without a sum that could wrap
+    return edgeV >= 0 && edgeW >= 0 && edgeV <= fixedArea - edgeW;
+}
+
+bool RasterTriangle2D::Contains(const Point& point) const {
+    if (!fixedInRange) {
+        float u, v, w;
+
+        return GetBarycentricCoords(point.x, point.y, u, v, w);
+    }
+
+    if (fixedArea == 0) return false;
+
+    Fixed::WideType edgeV, edgeW;
+
+    return GetEdgeFunctions(point, edgeV, edgeW);
+}
+
+bool RasterTriangle2D::GetBarycentricCoords(const Point& point, float& u, float& v, float& w) const {
+    if (!fixedInRange) return GetBarycentricCoords(point.x, point.y, u, v, w);
+
+    if (fixedArea == 0) return false;
+
+    Fixed::WideType edgeV, edgeW;
+
+    if (!GetEdgeFunctions(point, edgeV, edgeW)) return false;
+
+    // Both edge functions carry twice the fraction bits, dividing by the area at one leaves the weights in the fixed format
+    Fixed::WideType area = fixedArea >> Fixed::kFractionBits;
+    Fixed fixedV = Fixed::FromRaw(Fixed::StorageType(edgeV / area));
+    Fixed fixedW = Fixed::FromRaw(Fixed::StorageType(edgeW / area));
+    Fixed fixedU = Fixed::FromRaw(Fixed::kOne) - fixedV - fixedW;
+
+    // Shaders take float inputs, the weights are converted once per shaded pixel
+    u = fixedU.ToFloat();
+    v = fixedV.ToFloat();
+    w = fixedW.ToFloat();
+
+    return true;
+}
+#else
+bool RasterTriangle2D::Contains(const Point& point) const {
+    float u, v, w;
+
+    return GetBarycentricCoords(point.x, point.y, u, v, w);
+}
+
+bool RasterTriangle2D::GetBarycentricCoords(const Point& point, float& u, float& v, float& w) const {
+    return GetBarycentricCoords(point.x, point.y, u, v, w);
+}
+#endif
+
 bool RasterTriangle2D::Overlaps(const Rectangle2D& otherBounds) const {
     // Simple AABB intersection test, suitable for a QuadTree.
     return this->bounds.Overlaps(otherBounds);
 }
 
-Material* RasterTriangle2D::GetMaterial() const {
+bool RasterTriangle2D::IsWithin(const Rectangle2D& otherBounds) const {
+    return otherBounds.Contains(bounds.GetMinimum()) && otherBounds.Contains(bounds.GetMaximum());
+}
+
+IMaterial* RasterTriangle2D::GetMaterial() const {
     return material;
 }
 
@@ -12,6 +12,9 @@
 #include "../../../render/material/imaterial.hpp"
 #include "../../../../core/geometry/2d/rectangle.hpp"
 #include "rastertriangle3d.hpp"
+#include "../../core/cameraprojection.hpp"
+#include "../../../../core/math/fixedpoint.hpp"
+#include <limits>
 
 /**
  * @class RasterTriangle2D
@@ -20,14 +23,46 @@
  * This class inherits the basic geometry from Triangle2D and adds all the
  * properties required to render it, including pointers to the original 3D data,
  * material information, and pre-calculated values for efficient intersection tests.
+ *
+ * Targets without an FPU define UC3D_FIXED_RASTER to test pixels with integer edge functions
+ * in Q16.16, or in Q8.8 if UC3D_FIXED_RASTER_Q8_8 is also defined. Projection stays in float
+ * since it runs once per vertex, the vertices are converted once per triangle and each pixel
+ * once, so the per-candidate inside test and the barycentric weights use no float math.
+ *
+ * Differences between coordinates are kept in the storage type, so each edge function is a
+ * product of two storage values in the wide type. In Q8.8 that is a 16x16 to 32 bit multiply,
+ * which 8-bit targets such as AVR provide without 64-bit arithmetic, the uno environment uses
+ * it for that reason. A triangle takes the fixed path only if its vertices and the width and
+ * height of its bounds fit the storage type, under 32768 units in Q16.16 and 128 units in Q8.8.
+ * Larger triangles are tested with the float path instead of saturating or wrapping.
  */
 class RasterTriangle2D : public Triangle2D {
 public:
+#if defined(UC3D_FIXED_RASTER_Q8_8)
+    using Fixed = Q8_8; ///< Fixed-point format of the raster math.
+#else
+    using Fixed = Q16_16; ///< Fixed-point format of the raster math.
+#endif
+
+    /**
+     * @struct Point
+     * @brief Pixel coordinate converted once for testing against many triangles.
+     */
+    struct Point {
+        float x; ///< X coordinate of the pixel.
+        float y; ///< Y coordinate of the pixel.
+#if defined(UC3D_FIXED_RASTER)
+        Fixed::StorageType fixedX; ///< Raw fixed-point X coordinate.
+        Fixed::StorageType fixedY; ///< Raw fixed-point Y coordinate.
+#endif
+    };
+
+
     // --- Rendering & 3D Link Data ---
     const Vector3D* t3p1;   ///< Pointer to the original first vertex in 3D space.
     const Vector3D* t3p2;   ///< Pointer to the original second vertex in 3D space.
     const Vector3D* t3p3;   ///< Pointer to the original third vertex in 3D space.
-    const Vector3D* normal; ///< Pointer to the original normal vector of the 3D triangle.
+    Vector3D normal;        ///< Normal vector of the 3D triangle, copied since raster 3D triangles are often temporaries.
     IMaterial* material;     ///< Material assigned to the triangle for shading.
 
     // --- UV Mapping Data ---
@@ -38,28 +73,40 @@ public:
 
     // --- Pre-calculated values for efficiency ---
     float averageDepth;     ///< Average depth of the triangle's vertices for z-buffering.
+    float depth1;           ///< Depth of the first projected vertex.
+    float depth2;           ///< Depth of the second projected vertex.
+    float depth3;           ///< Depth of the third projected vertex.
+    float minimumDepth;     ///< Nearest depth of any point of the triangle, for early rejection.
     float denominator;      ///< Precomputed denominator for barycentric coordinate calculations.
     Vector2D v0, v1;        ///< Edge vectors for barycentric calculations.
     Rectangle2D bounds;     ///< Axis-aligned bounding box for fast spatial queries (e.g., QuadTree).
 
+#if defined(UC3D_FIXED_RASTER)
+    Fixed::StorageType fixedX1, fixedY1;   ///< Raw fixed-point first vertex.
+    Fixed::StorageType fixedV0X, fixedV0Y; ///< Raw fixed-point edge from the first to the second vertex.
+    Fixed::StorageType fixedV1X, fixedV1Y; ///< Raw fixed-point edge from the first to the third vertex.
+    Fixed::WideType fixedArea;             ///< Absolute cross product of the edges, 0 if degenerate.
+    bool fixedFlipped;                     ///< Set if the vertices wind clockwise, negating the edge functions.
+    bool fixedInRange;                     ///< Set if the triangle fits the fixed format, otherwise the float path is used.
+#endif
+
     /**
      * @brief Default constructor. Initializes all pointers to nullptr.
      */
     RasterTriangle2D();
 
     /**
-     * @brief Projects a 3D triangle to a 2D raster triangle using a camera transform.
+     * @brief Projects a 3D triangle to a 2D raster triangle using a camera projection.
      *
      * This is the primary constructor for creating a renderable 2D triangle from 3D scene data.
      * It handles the projection, calculates depth, copies material/UV data, and pre-computes
      * values for efficient rasterization.
      *
-     * @param camTransform The transform of the camera.
-     * @param lookDirection The look direction of the camera.
+     * @param projection The cached projection constants of the camera.
      * @param sourceTriangle The source 3D triangle.
      * @param mat The material to assign.
      */
-    RasterTriangle2D(const Transform& camTransform, const Quaternion& lookDirection,
+    RasterTriangle2D(const CameraProjection& projection,
                      const RasterTriangle3D& sourceTriangle, IMaterial* mat);
 
     /**
@@ -74,6 +121,47 @@ public:
      */
     bool GetBarycentricCoords(float x, float y, float& u, float& v, float& w) const;
 
+    /**
+     * @brief Converts a pixel coordinate for the tests below.
+     *
+     * @param pixel The pixel coordinate.
+     * @return The prepared point.
+     */
+    static Point PreparePoint(const Vector2D& pixel);
+
+    /**
+     * @brief Checks if a prepared point is inside the triangle without computing its weights.
+     *
+     * @param point The prepared pixel coordinate.
+     * @return true if the point is inside the triangle, false otherwise.
+     */
+    bool Contains(const Point& point) const;
+
+    /**
+     * @brief Checks for intersection with a prepared point and computes its barycentric coordinates.
+     *
+     * @param point The prepared pixel coordinate.
+     * @param u [out] The first barycentric coordinate.
+     * @param v [out] The second barycentric coordinate.
+     * @param w [out] The third barycentric coordinate.
+     * @return true if the point is inside the triangle, false otherwise.
+     */
+    bool GetBarycentricCoords(const Point& point, float& u, float& v, float& w) const;
+
+    /**
+     * @brief Interpolates the depth at a point from its barycentric coordinates.
+     *
+     * Camera projections are orthographic, so depth is linear across the projected triangle.
+     *
+     * @param u The first barycentric coordinate.
+     * @param v The second barycentric coordinate.
+     * @param w The third barycentric coordinate.
+     * @return The depth of the triangle at the point.
+     */
+    float GetDepth(float u, float v, float w) const {
+        return depth1 * u + depth2 * v + depth3 * w;
+    }
+
     /**
      * @brief Checks if the triangle's bounding box overlaps with another rectangle.
      * @param otherBounds The rectangle to test against.
@@ -81,6 +169,13 @@ public:
      */
     bool Overlaps(const Rectangle2D& otherBounds) const;
 
+    /**
+     * @brief Checks if the triangle's bounding box lies entirely inside a rectangle.
+     * @param otherBounds The rectangle to test against.
+     * @return true if both corners of the bounds are inside the rectangle.
+     */
+    bool IsWithin(const Rectangle2D& otherBounds) const;
+
     /**
      * @brief Gets the assigned material.
      */
@@ -96,4 +191,22 @@ private:
      * @brief Private helper to calculate the bounding box and barycentric denominator.
      */
     void CalculateBoundsAndDenominator();
+
+#if defined(UC3D_FIXED_RASTER)
+    /**
+     * @brief Computes the edge functions of the second and third vertex at a prepared point.
+     *
+     * Both are scaled by twice the fraction bits and oriented so points inside are non-negative.
+     * Only valid for triangles in range of the fixed format.
+     *
+     * @param point The prepared pixel coordinate.
+     * @param edgeV [out] Edge function of the second vertex.
+     * @param edgeW [out] Edge function of the third vertex.
+     * @return true if the point is inside the triangle, the edge functions are unset if it is too far away.
+     */
+    bool GetEdgeFunctions(const Point& point, Fixed::WideType& edgeV, Fixed::WideType& edgeW) const;
+
+    static constexpr Fixed::WideType kFixedMin = std::numeric_limits<Fixed::StorageType>::min(); ///< Smallest delta the edge functions take.
+    static constexpr Fixed::WideType kFixedMax = std::numeric_limits<Fixed::StorageType>::max(); ///< Largest delta the edge functions take.
+#endif
 };
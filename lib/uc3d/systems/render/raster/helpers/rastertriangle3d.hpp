@@ -8,6 +8,7 @@
 
 #include "../../../../core/math/vector3d.hpp"
 #include "../../../../core/math/vector2d.hpp"
+#include "../../ray/raypacket.hpp"
 
 /**
  * @class RasterTriangle3D
@@ -65,6 +66,47 @@ public:
     bool IntersectsRay(const Vector3D& rayOrigin, const Vector3D& rayDir,
                        float& out_t, float& out_u, float& out_v) const;
 
+    /**
+     * @brief Performs the ray-triangle intersection test for every ray of a packet.
+     *
+     * Rays that hit the triangle closer than their current hit record the new distance,
+     * barycentric coordinates and triangle index. All rays are tested at once with
+     * vector operations where the compiler supports them.
+     *
+     * @param index Index recorded as the hit triangle.
+     * @param packet [in,out] Rays to test and their closest hits.
+     */
+    template<uint8_t width>
+    void IntersectsPacket(uint32_t index, RayPacket<width>& packet) const;
+
+    /**
+     * @brief Performs the packet intersection test on triangle data held outside a RasterTriangle3D.
+     *
+     * @param vertex First vertex of the triangle.
+     * @param edge1 Edge from the first to the second vertex.
+     * @param edge2 Edge from the first to the third vertex.
+     * @param index Index recorded as the hit triangle.
+     * @param packet [in,out] Rays to test and their closest hits.
+     */
+    template<uint8_t width>
+    static void IntersectsPacket(const Vector3D& vertex, const Vector3D& edge1, const Vector3D& edge2,
+                                 uint32_t index, RayPacket<width>& packet);
+
     /** @brief Returns a pointer to the pre-calculated normal vector. */
     const Vector3D& GetNormal() const;
+
+private:
+    /** @brief Packet intersection over plain arrays, one ray at a time. */
+    template<uint8_t width>
+    static void IntersectsPacket(const Vector3D& vertex, const Vector3D& edge1, const Vector3D& edge2,
+                                 uint32_t index, RayPacket<width>& packet, RayLanesTag<false>);
+
+#if defined(__GNUC__)
+    /** @brief Packet intersection on every ray at once with vector extension types. */
+    template<uint8_t width>
+    static void IntersectsPacket(const Vector3D& vertex, const Vector3D& edge1, const Vector3D& edge2,
+                                 uint32_t index, RayPacket<width>& packet, RayLanesTag<true>);
+#endif
 };
+
+#include "rastertriangle3d.tpp" // Include the template implementation.
@@ -0,0 +1,96 @@
+#pragma once
+
+template<uint8_t width>
+void RasterTriangle3D::IntersectsPacket(uint32_t index, RayPacket<width>& packet) const {
+    IntersectsPacket(*p1, edge1, edge2, index, packet);
+}
+
+template<uint8_t width>
+void RasterTriangle3D::IntersectsPacket(const Vector3D& vertex, const Vector3D& edge1, const Vector3D& edge2,
+                                        uint32_t index, RayPacket<width>& packet) {
+    IntersectsPacket(vertex, edge1, edge2, index, packet, typename RayLanes<width>::Tag());
+}
+
+template<uint8_t width>
+void RasterTriangle3D::IntersectsPacket(const Vector3D& vertex, const Vector3D& edge1, const Vector3D& edge2,
+                                        uint32_t index, RayPacket<width>& packet, RayLanesTag<false>) {
+    // Copy the triangle into locals, the compiler cannot prove references do not alias the packet
+    const float vX = vertex.X, vY = vertex.Y, vZ = vertex.Z;
+    const float e1X = edge1.X, e1Y = edge1.Y, e1Z = edge1.Z;
+    const float e2X = edge2.X, e2Y = edge2.Y, e2Z = edge2.Z;
+
+    // Same Moller-Trumbore steps as IntersectsRay, one ray at a time
+    for (uint8_t i = 0; i < width; ++i) {
+        float pX = packet.directionY[i] * e2Z - packet.directionZ[i] * e2Y;
+        float pY = packet.directionZ[i] * e2X - packet.directionX[i] * e2Z;
+        float pZ = packet.directionX[i] * e2Y - packet.directionY[i] * e2X;
+        float det = e1X * pX + e1Y * pY + e1Z * pZ;
+
+        if (Mathematics::FAbs(det) < Mathematics::EPSILON) continue;
+
+        float invDet = 1.0f / det;
+        float tX = packet.originX[i] - vX;
+        float tY = packet.originY[i] - vY;
+        float tZ = packet.originZ[i] - vZ;
+        float u = (tX * pX + tY * pY + tZ * pZ) * invDet;
+
+        if (u < 0.0f || u > 1.0f) continue;
+
+        float qX = tY * e1Z - tZ * e1Y;
+        float qY = tZ * e1X - tX * e1Z;
+        float qZ = tX * e1Y - tY * e1X;
+        float v = (packet.directionX[i] * qX + packet.directionY[i] * qY + packet.directionZ[i] * qZ) * invDet;
+
+        if (v < 0.0f || u + v > 1.0f) continue;
+
+        float t = (e2X * qX + e2Y * qY + e2Z * qZ) * invDet;
+
+        if (t > Mathematics::EPSILON && t < packet.t[i]) {
+            packet.t[i] = t;
+            packet.u[i] = u;
+            packet.v[i] = v;
+            packet.triangle[i] = index;
+        }
+    }
+}
+
+#if defined(__GNUC__)
+template<uint8_t width>
+void RasterTriangle3D::IntersectsPacket(const Vector3D& vertex, const Vector3D& edge1, const Vector3D& edge2,
+                                        uint32_t index, RayPacket<width>& packet, RayLanesTag<true>) {
+    typedef typename RayLanes<width>::Float Float;
+    typedef typename RayLanes<width>::Mask Mask;
+    typedef typename RayLanes<width>::Index Index;
+
+    const float epsilon = Mathematics::EPSILON;
+
+    // Same Moller-Trumbore steps as IntersectsRay on every ray at once, rejections are folded into one mask
+    Float pX = packet.directionY * edge2.Z - packet.directionZ * edge2.Y;
+    Float pY = packet.directionZ * edge2.X - packet.directionX * edge2.Z;
+    Float pZ = packet.directionX * edge2.Y - packet.directionY * edge2.X;
+    Float det = edge1.X * pX + edge1.Y * pY + edge1.Z * pZ;
+
+    // A zero determinant yields infinities that fail the tests below, no branch is needed
+    Mask valid = (det > epsilon) | (det < -epsilon);
+    Float invDet = 1.0f / det;
+
+    Float tX = packet.originX - vertex.X;
+    Float tY = packet.originY - vertex.Y;
+    Float tZ = packet.originZ - vertex.Z;
+    Float u = (tX * pX + tY * pY + tZ * pZ) * invDet;
+
+    Float qX = tY * edge1.Z - tZ * edge1.Y;
+    Float qY = tZ * edge1.X - tX * edge1.Z;
+    Float qZ = tX * edge1.Y - tY * edge1.X;
+    Float v = (packet.directionX * qX + packet.directionY * qY + packet.directionZ * qZ) * invDet;
+    Float t = (edge2.X * qX + edge2.Y * qY + edge2.Z * qZ) * invDet;
+
+    valid &= (u >= 0.0f) & (v >= 0.0f) & (u + v <= 1.0f);
+    valid &= (t > epsilon) & (t < packet.t);
+
+    packet.t = valid ? t : packet.t;
+    packet.u = valid ? u : packet.u;
+    packet.v = valid ? v : packet.v;
+    packet.triangle = valid ? Index{} + index : packet.triangle;
+}
+#endif
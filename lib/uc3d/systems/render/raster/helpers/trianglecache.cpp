@@ -0,0 +1,76 @@
+#include "trianglecache.hpp"
+
+TriangleCache::~TriangleCache() {
+    delete[] triangles;
+    delete[] spare;
+    delete[] records;
+}
+
+void TriangleCache::SetEnabled(bool enabled) {
+    this->enabled = enabled;
+
+    if (!enabled) Invalidate();
+}
+
+bool TriangleCache::IsEnabled() const {
+    return enabled;
+}
+
+void TriangleCache::Invalidate() {
+    delete[] triangles;
+
+    triangles = nullptr;
+    triangleCapacity = 0;
+    recordCount = 0;
+    valid = false;
+}
+
+const RasterTriangle2D* TriangleCache::Find(const CameraProjection& projection, const Mesh* mesh, uint32_t version, uint32_t count) const {
+    if (!valid || !projection.Matches(this->projection)) return nullptr;
+
+    for (uint8_t i = 0; i < recordCount; ++i) {
+        const Record& record = records[i];
+
+        if (record.mesh == mesh) {
+            return record.version == version && record.count == count ? &triangles[record.start] : nullptr;
+        }
+    }
+
+    return nullptr;
+}
+
+RasterTriangle2D* TriangleCache::Reserve(uint32_t count) {
+    if (count > spareCapacity) {
+        delete[] spare;
+
+        spareCapacity = count;
+        spare = new RasterTriangle2D[spareCapacity];
+    }
+
+    return spare;
+}
+
+void TriangleCache::Store(const CameraProjection& projection, const Record* records, uint8_t count) {
+    RasterTriangle2D* previous = triangles;
+    uint32_t previousCapacity = triangleCapacity;
+
+    triangles = spare;
+    triangleCapacity = spareCapacity;
+    spare = previous;
+    spareCapacity = previousCapacity;
+
+    if (count > capacity) {
+        delete[] this->records;
+
+        capacity = count;
+        this->records = new Record[capacity];
+    }
+
+    for (uint8_t i = 0; i < count; ++i) {
+        this->records[i] = records[i];
+    }
+
+    recordCount = count;
+    this->projection = projection;
+    valid = true;
+}
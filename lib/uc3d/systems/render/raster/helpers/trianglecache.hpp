@@ -0,0 +1,118 @@
+/**
+ * @file trianglecache.hpp
+ * @brief Keeps the projected triangles of a frame so static meshes are not projected again.
+ * @date  16/10/2026
+ * @author Coela Can't
+ */
+#pragma once
+
+#include <cstdint>
+#include "rastertriangle2d.hpp"
+#include "../../core/cameraprojection.hpp"
+
+class Mesh;
+
+/**
+ * @class TriangleCache
+ * @brief Projected triangles of the previous frame, grouped by mesh.
+ *
+ * Projecting a triangle repeats the same rotation, division and bounds computation every
+ * frame even if neither the mesh nor the camera moved. The cache keeps the triangles of the
+ * last frame together with the version of each mesh, see Mesh::GetVersion, and hands them
+ * back while the version and the projection still match. Triangles point into the
+ * vertex and UV arrays of their mesh, which stay in place for the lifetime of the mesh.
+ *
+ * The cache also owns the array the rasterizer projects the next frame into, see Reserve.
+ * Storing a frame swaps the two arrays instead of copying, so enabling the cache keeps one
+ * frame of triangles alive in addition to the one being built. It is disabled by default on
+ * Arduino targets for that reason.
+ */
+class TriangleCache {
+public:
+    /**
+     * @struct Record
+     * @brief Location of the triangles of one mesh in the cached array.
+     */
+    struct Record {
+        const Mesh* mesh; ///< The mesh the triangles were projected from.
+        uint32_t version; ///< Version of the mesh when it was projected.
+        uint32_t start; ///< First triangle of the mesh in the cached array.
+        uint32_t count; ///< Number of triangles of the mesh.
+    };
+
+private:
+    RasterTriangle2D* triangles = nullptr; ///< Triangles of the previous frame.
+    uint32_t triangleCapacity = 0; ///< Allocated size of the cached triangle array.
+    RasterTriangle2D* spare = nullptr; ///< Array the next frame is projected into.
+    uint32_t spareCapacity = 0; ///< Allocated size of the spare array.
+    Record* records = nullptr; ///< Meshes of the previous frame.
+    uint8_t recordCount = 0; ///< Number of records in use.
+    uint8_t capacity = 0; ///< Allocated number of records.
+    CameraProjection projection; ///< Projection the triangles were made with.
+    bool valid = false; ///< Set once a frame has been stored.
+#if defined(ARDUINO)
+    bool enabled = false; ///< Set if frames are kept.
+#else
+    bool enabled = true; ///< Set if frames are kept.
+#endif
+
+public:
+    TriangleCache() = default;
+
+    /**
+     * @brief Releases both triangle arrays.
+     */
+    ~TriangleCache();
+
+    TriangleCache(const TriangleCache&) = delete;
+    TriangleCache& operator=(const TriangleCache&) = delete;
+
+    /**
+     * @brief Enables or disables the cache, disabling releases the cached triangles.
+     *
+     * @param enabled True to keep the triangles of every frame.
+     */
+    void SetEnabled(bool enabled);
+
+    /**
+     * @brief Checks if the cache is enabled.
+     */
+    bool IsEnabled() const;
+
+    /**
+     * @brief Releases the cached triangles so the next frame projects everything.
+     */
+    void Invalidate();
+
+    /**
+     * @brief Finds the triangles of a mesh that can be reused.
+     *
+     * @param projection Projection of the current frame.
+     * @param mesh The mesh.
+     * @param version Current version of the mesh.
+     * @param count Current number of triangles of the mesh.
+     * @return The first cached triangle of the mesh, nullptr if it must be projected.
+     */
+    const RasterTriangle2D* Find(const CameraProjection& projection, const Mesh* mesh, uint32_t version, uint32_t count) const;
+
+    /**
+     * @brief Retrieves the array to project a frame into, grown only when the count increases.
+     *
+     * The array is separate from the cached triangles, so cached meshes can be copied into it.
+     *
+     * @param count Number of triangles of the frame.
+     * @return Array of at least count triangles.
+     */
+    RasterTriangle2D* Reserve(uint32_t count);
+
+    /**
+     * @brief Replaces the cached frame with the triangles written to the array from Reserve.
+     *
+     * The previously cached array becomes the array returned by the next Reserve.
+     *
+     * @param projection Projection the triangles were made with.
+     * @param records Location of each mesh in the triangle array.
+     * @param count Number of records.
+     */
+    void Store(const CameraProjection& projection, const Record* records, uint8_t count);
+};
@@ -1,122 +1,504 @@
 #include "rasterizer.hpp"
 
+Rasterizer::DepthMode Rasterizer::depthMode = Rasterizer::DepthMode::Average;
+bool Rasterizer::frontToBack = false;
 
-RGBColor Rasterizer::RasterizePixel(RasterTriangle2D** candidate_triangles, unsigned short count, const Vector2D& pixel_coord) {
+
+void Rasterizer::SetDepthMode(DepthMode mode, bool sortFrontToBack) {
+    depthMode = mode;
+    frontToBack = sortFrontToBack;
+}
+
+
+bool Rasterizer::GetDepthAt(const RasterTriangle2D* triangle, const RasterTriangle2D::Point& point, DepthMode mode, float& depth) {
+    if (mode == DepthMode::Average) {
+        // One depth per triangle, the weights are only needed for the final hit
+        if (!triangle->Contains(point)) return false;
+
+        depth = triangle->averageDepth;
+        return true;
+    }
+
+    float u, v, w;
+
+    if (!triangle->GetBarycentricCoords(point, u, v, w)) return false;
+
+    depth = triangle->GetDepth(u, v, w);
+    return true;
+}
+
+
+void Rasterizer::FindClosest(const QuadTree<RasterTriangle2D>::Node* root, const Vector2D& pixel_coord, PixelSample& sample, DepthMode mode, bool sorted) {
+    RasterTriangle2D::Point point = RasterTriangle2D::PreparePoint(pixel_coord);
     float closest_z = std::numeric_limits<float>::max();
-    const RasterTriangle2D* hit_triangle = nullptr;
-    float hit_u = 0.0f, hit_v = 0.0f, hit_w = 0.0f;
-
-    // Find the closest triangle that intersects the pixel
-    for (unsigned short i = 0; i < count; ++i) {
-        RasterTriangle2D* tri_ptr = candidate_triangles[i];
-        // Z-buffer check
-        if (tri_ptr->averageDepth < closest_z) {
-            float u, v, w;
-            if (tri_ptr->GetBarycentricCoords(pixel_coord.X, pixel_coord.Y, u, v, w)) {
+    const RasterTriangle2D* hit_triangle = sample.triangle;
+
+    // Seed the depth with last frame's triangle, it usually still covers the pixel
+    if (!hit_triangle || !GetDepthAt(hit_triangle, point, mode, closest_z)) {
+        hit_triangle = nullptr;
+    }
+
+    // Find the closest triangle that intersects the pixel, walking down to the leaf containing it
+    for (const QuadTree<RasterTriangle2D>::Node* node = root; node; node = node->FindChild(pixel_coord)) {
+        RasterTriangle2D** candidate_triangles = node->GetItems();
+
+        for (unsigned short i = 0; i < node->GetItemCount(); ++i) {
+            RasterTriangle2D* tri_ptr = candidate_triangles[i];
+
+            // Z-buffer check, no point of the triangle can be closer than its rejection depth
+            if (GetRejectionDepth(tri_ptr, mode) >= closest_z) {
+                // Sorted nodes only hold farther candidates from here on
+                if (sorted) break;
+
+                continue;
+            }
+
+            float depth;
+
+            if (GetDepthAt(tri_ptr, point, mode, depth) && depth < closest_z) {
                 // Intersection found, update the hit data
-                closest_z = tri_ptr->averageDepth;
+                closest_z = depth;
                 hit_triangle = tri_ptr;
-                hit_u = u;
-                hit_v = v;
-                hit_w = w;
             }
         }
     }
 
+    sample = PixelSample{ hit_triangle, 0.0f, 0.0f, 0.0f };
+
+    if (hit_triangle) hit_triangle->GetBarycentricCoords(point, sample.u, sample.v, sample.w);
+}
+
+
+RGBColor Rasterizer::Shade(const PixelSample& sample) {
+    const RasterTriangle2D* hit_triangle = sample.triangle;
+
     // If a triangle was hit, calculate its color
     if (hit_triangle) {
-        Vector3D intersect_pos = (*hit_triangle->t3p1 * hit_u) + (*hit_triangle->t3p2 * hit_v) + (*hit_triangle->t3p3 * hit_w);
+        Vector3D intersect_pos = (*hit_triangle->t3p1 * sample.u) + (*hit_triangle->t3p2 * sample.v) + (*hit_triangle->t3p3 * sample.w);
         Vector2D uv_coords;
 
         if (hit_triangle->hasUV) {
-            uv_coords = (*hit_triangle->p1UV * hit_u) + (*hit_triangle->p2UV * hit_v) + (*hit_triangle->p3UV * hit_w);
+            uv_coords = (*hit_triangle->p1UV * sample.u) + (*hit_triangle->p2UV * sample.v) + (*hit_triangle->p3UV * sample.w);
         }
 
-        return hit_triangle->material->GetRGB(intersect_pos, hit_triangle->normal, Vector3D(uv_coords.X, uv_coords.Y, 0.0f));
+        IMaterial* material = hit_triangle->material;
+
+        if (!material || !material->GetShader()) {
+            return RGBColor(0, 0, 0);
+        }
+
+        SurfaceProperties surface{ intersect_pos, hit_triangle->normal, Vector3D(uv_coords.X, uv_coords.Y, 0.0f) };
+
+        return material->GetShader()->Shade(surface, *material);
     }
 
     return RGBColor(0, 0, 0); // No intersection, return black
 }
 
 
-void Rasterizer::Rasterize(Scene* scene, CameraBase* camera) {
-    if (!scene || !camera || camera->Is2D()) {
+uint8_t Rasterizer::GetShadingRate(const PixelJob& job, const RasterTriangle2D* triangle) {
+    uint8_t rate = triangle && triangle->material ? triangle->material->GetShadingRate() : 0;
+
+    return rate > 0 ? rate : job.shadingRate;
+}
+
+
+bool Rasterizer::IsAnchor(const PixelJob& job, uint32_t index, const RasterTriangle2D* triangle) {
+    if (!triangle) return true;
+
+    uint32_t rate = GetShadingRate(job, triangle);
+    uint32_t rowCount = job.coordinates.GetRowCount();
+    uint32_t column = index % rowCount;
+    uint32_t row = index / rowCount;
+    uint32_t lastRow = (uint32_t(job.coordinates.GetPixelCount()) - 1) / rowCount;
+
+    return (column % rate == 0 || column == rowCount - 1) && (row % rate == 0 || row == lastRow);
+}
+
+
+const RasterTriangle2D* Rasterizer::FindTriangle(const PixelJob& job, uint32_t hit) {
+    uint32_t scene = hit >> FrameHistory::kTriangleBits;
+    uint32_t triangle = hit & ((uint32_t(1) << FrameHistory::kTriangleBits) - 1);
+
+    if (hit == FrameHistory::kNoHit || scene >= job.sceneMeshCount) return nullptr;
+
+    uint8_t visible = job.visibleIndices[scene];
+
+    if (visible == kNotVisible || job.meshStarts[visible] + triangle >= job.meshStarts[visible + 1]) return nullptr;
+
+    return &job.triangles[job.meshStarts[visible] + triangle];
+}
+
+
+uint32_t Rasterizer::GetHit(const PixelJob& job, const RasterTriangle2D* triangle) {
+    if (!triangle) return FrameHistory::kNoHit;
+
+    uint32_t index = uint32_t(triangle - job.triangles);
+    uint8_t low = 0;
+    uint8_t high = job.meshCount - 1;
+
+    // The last visible mesh starting at or before the triangle holds it, empty meshes are skipped
+    while (low < high) {
+        uint8_t middle = uint8_t((low + high + 1) / 2);
+
+        if (job.meshStarts[middle] <= index) {
+            low = middle;
+        } else {
+            high = middle - 1;
+        }
+    }
+
+    uint32_t local = index - job.meshStarts[low];
+
+    if (local >> FrameHistory::kTriangleBits) return FrameHistory::kNoHit;
+
+    return FrameHistory::MakeHit(job.sceneIndices[low], local);
+}
+
+
+void Rasterizer::ForEach(ThreadPool* pool, uint32_t count, ThreadPool::Function function, void* context) {
+    if (pool) {
+        pool->ParallelFor(count, function, context);
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; ++i) {
+        function(i, context);
+    }
+}
+
+
+void Rasterizer::ProjectTriangles(uint32_t index, void* context) {
+    const ProjectionJob* job = static_cast<const ProjectionJob*>(context);
+    uint32_t first = index * kTrianglesPerJob;
+    uint32_t last = Mathematics::Min(first + kTrianglesPerJob, job->meshStarts[job->meshCount]);
+    uint8_t m = 0;
+
+    // Chunks may span several meshes, find the mesh holding the first triangle
+    while (job->meshStarts[m + 1] <= first) ++m;
+
+    for (uint32_t t = first; t < last; ++t) {
+        while (job->meshStarts[m + 1] <= t) ++m;
+
+        Mesh* mesh = job->meshes[m];
+        uint32_t j = t - job->meshStarts[m];
+
+        // Meshes that did not change since the cached frame keep their projected triangles
+        if (job->sources[m]) {
+            job->triangles[t] = job->sources[m][j];
+            continue;
+        }
+
+        // Triangle3D holds copies of the original vertices, deformers and transforms write the vertex array
+        const Vector3D* vertices = mesh->GetTriangleGroup()->GetVertices();
+        const IndexGroup& face = mesh->GetTriangleGroup()->GetIndexGroup()[j];
+
+        const RasterTriangle3D rasterTri = mesh->HasUV() ? 
+            RasterTriangle3D(&vertices[face.A], &vertices[face.B], &vertices[face.C], 
+                &mesh->GetUVVertices()[mesh->GetUVIndexGroup()[j].A], 
+                &mesh->GetUVVertices()[mesh->GetUVIndexGroup()[j].B], 
+                &mesh->GetUVVertices()[mesh->GetUVIndexGroup()[j].C]) :
+            RasterTriangle3D(&vertices[face.A], &vertices[face.B], &vertices[face.C]);
+
+        // Every triangle has its own slot in the shared array, so chunks never overlap
+        job->triangles[t] = RasterTriangle2D(*job->projection, rasterTri, mesh->GetMaterial());
+    }
+}
+
+
+void Rasterizer::RasterizePixels(uint32_t index, void* context) {
+    const PixelJob* job = static_cast<const PixelJob*>(context);
+    uint32_t first = index * kPixelsPerJob;
+    uint32_t last = Mathematics::Min(first + kPixelsPerJob, uint32_t(job->coordinates.GetPixelCount()));
+
+    for (uint32_t i = first; i < last; ++i) {
+        Vector2D pixel = job->coordinates[uint16_t(i)];
+
+        if (!job->region.Contains(pixel)) continue;
+
+        PixelSample sample{ job->hits ? FindTriangle(*job, job->hits[i]) : nullptr, 0.0f, 0.0f, 0.0f };
+
+        FindClosest(job->root, pixel, sample, job->depthMode, job->sorted);
+
+        job->colors[i] = Shade(sample);
+
+        // Each range owns its pixels' cache slots, like their colors
+        if (job->hits) job->hits[i] = GetHit(*job, sample.triangle);
+    }
+}
+
+
+void Rasterizer::ShadeAnchors(uint32_t index, void* context) {
+    const PixelJob* job = static_cast<const PixelJob*>(context);
+    uint32_t first = index * kPixelsPerJob;
+    uint32_t last = Mathematics::Min(first + kPixelsPerJob, uint32_t(job->coordinates.GetPixelCount()));
+
+    for (uint32_t i = first; i < last; ++i) {
+        Vector2D pixel = job->coordinates[uint16_t(i)];
+        PixelSample& sample = job->samples[i];
+
+        sample = PixelSample{ nullptr, 0.0f, 0.0f, 0.0f };
+
+        if (!job->region.Contains(pixel)) continue;
+
+        if (job->hits) sample.triangle = FindTriangle(*job, job->hits[i]);
+
+        FindClosest(job->root, pixel, sample, job->depthMode, job->sorted);
+
+        if (IsAnchor(*job, i, sample.triangle)) job->colors[i] = Shade(sample);
+
+        if (job->hits) job->hits[i] = GetHit(*job, sample.triangle);
+    }
+}
+
+
+void Rasterizer::ShadeBetweenAnchors(uint32_t index, void* context) {
+    const PixelJob* job = static_cast<const PixelJob*>(context);
+    uint32_t pixelCount = job->coordinates.GetPixelCount();
+    uint32_t rowCount = job->coordinates.GetRowCount();
+    uint32_t lastRow = (pixelCount - 1) / rowCount;
+    uint32_t first = index * kPixelsPerJob;
+    uint32_t last = Mathematics::Min(first + kPixelsPerJob, pixelCount);
+
+    for (uint32_t i = first; i < last; ++i) {
+        const PixelSample& sample = job->samples[i];
+
+        // Anchors were shaded by the first pass, pixels outside the region have no triangle
+        if (IsAnchor(*job, i, sample.triangle)) continue;
+
+        uint32_t rate = GetShadingRate(*job, sample.triangle);
+        uint32_t column = i % rowCount;
+        uint32_t row = i / rowCount;
+        uint32_t left = column - column % rate;
+        uint32_t right = Mathematics::Min(left + rate, rowCount - 1);
+        uint32_t top = row - row % rate;
+        uint32_t bottom = Mathematics::Min(top + rate, lastRow);
+        uint32_t corners[4] = { top * rowCount + left, top * rowCount + right, bottom * rowCount + left, bottom * rowCount + right };
+        bool inside = corners[3] < pixelCount;
+
+        // Anchors on another triangle mark an edge, anchors outside the region were not resolved
+        for (uint8_t c = 0; inside && c < 4; ++c) {
+            inside = job->samples[corners[c]].triangle == sample.triangle;
+        }
+
+        if (!inside) {
+            job->colors[i] = Shade(sample);
+            continue;
+        }
+
+        float ratioX = right > left ? float(column - left) / float(right - left) : 0.0f;
+        float ratioY = bottom > top ? float(row - top) / float(bottom - top) : 0.0f;
+        float weights[4] = { (1.0f - ratioX) * (1.0f - ratioY), ratioX * (1.0f - ratioY), (1.0f - ratioX) * ratioY, ratioX * ratioY };
+        float red = 0.5f, green = 0.5f, blue = 0.5f;
+
+        // Rounded rather than truncated, so equal anchors interpolate to their own color
+        for (uint8_t c = 0; c < 4; ++c) {
+            const RGBColor& anchor = job->colors[corners[c]];
+
+            red += float(anchor.R) * weights[c];
+            green += float(anchor.G) * weights[c];
+            blue += float(anchor.B) * weights[c];
+        }
+
+        job->colors[i] = RGBColor(uint8_t(red), uint8_t(green), uint8_t(blue));
+    }
+}
+
+
+void Rasterizer::UpscalePixels(uint32_t index, void* context) {
+    const UpscaleJob* job = static_cast<const UpscaleJob*>(context);
+    uint32_t first = index * kPixelsPerJob;
+    uint32_t last = Mathematics::Min(first + kPixelsPerJob, uint32_t(job->physical.GetPixelCount()));
+
+    job->scaler->Upscale(job->physical, job->colors, uint16_t(first), uint16_t(last));
+}
+
+
+void Rasterizer::Rasterize(Scene* scene, CameraBase* camera, ThreadPool* pool) {
+    Rasterize(scene, &camera, 1, pool);
+}
+
+
+void Rasterizer::Rasterize(Scene* scene, CameraBase** cameras, uint8_t count, ThreadPool* pool) {
+    if (!scene || !cameras || count == 0) {
         return;
     }
 
+    for (uint8_t i = 0; i < count; ++i) {
+        if (!cameras[i] || cameras[i]->Is2D()) {
+            return;
+        }
+    }
+
     // --- Setup ---
-    camera->GetTransform()->SetBaseRotation(camera->GetCameraLayout()->GetRotation());
-    Quaternion lookDirection = camera->GetTransform()->GetRotation().Multiply(camera->GetLookOffset());
+    uint32_t start = uc3d::Time::Micros();
+    const CameraProjection& projection = cameras[0]->GetProjection();
+
+    // The tree covers every camera of the group so each one can query the same index
+    Vector2D minCoord = cameras[0]->GetCameraMinCoordinate();
+    Vector2D maxCoord = cameras[0]->GetCameraMaxCoordinate();
+
+    for (uint8_t i = 1; i < count; ++i) {
+        minCoord = Vector2D::Minimum(minCoord, cameras[i]->GetCameraMinCoordinate());
+        maxCoord = Vector2D::Maximum(maxCoord, cameras[i]->GetCameraMaxCoordinate());
+    }
 
-    Vector2D minCoord = camera->GetCameraMinCoordinate();
-    Vector2D maxCoord = camera->GetCameraMaxCoordinate();
-    QuadTree<RasterTriangle2D> tree(Rectangle2D(minCoord, maxCoord));
+    QuadTree<RasterTriangle2D> tree(Rectangle2D(Rectangle2D::Bounds{ minCoord, maxCoord }));
 
-    // 1. Calculate total number of triangles to allocate memory on the heap
+    // 1. Collect the visible meshes and the offset of each one in the shared triangle array
+    // The arrays of the first camera persist between frames, they only grow with the scene
+    uint8_t sceneMeshCount = scene->GetMeshCount();
+    RasterScratch* scratch = cameras[0]->GetRasterScratch();
+
+    scratch->Reserve(sceneMeshCount);
+
+    Mesh** meshes = scratch->meshes;
+    uint32_t* meshStarts = scratch->meshStarts;
+    uint8_t* sceneIndices = scratch->sceneIndices;
+    uint8_t* visibleIndices = scratch->visibleIndices;
+    uint8_t meshCount = 0;
     uint32_t totalTriangles = 0;
-    for (uint8_t i = 0; i < scene->GetMeshCount(); ++i) {
+
+    for (uint8_t i = 0; i < sceneMeshCount; ++i) {
         Mesh* mesh = scene->GetMeshes()[i];
+        visibleIndices[i] = kNotVisible;
+
         if (mesh && mesh->IsEnabled() && mesh->GetTriangleGroup()) {
+            visibleIndices[i] = meshCount;
+            sceneIndices[meshCount] = i;
+            meshes[meshCount] = mesh;
+            meshStarts[meshCount++] = totalTriangles;
             totalTriangles += mesh->GetTriangleGroup()->GetTriangleCount();
         }
     }
 
+    meshStarts[meshCount] = totalTriangles;
+
     if (totalTriangles == 0) {
+        // Nothing is drawn, so the recorded meshes no longer describe the pixels
+        for (uint8_t c = 0; c < count; ++c) {
+            cameras[c]->GetFrameHistory()->Invalidate();
+        }
+
         return; // No triangles to render
     }
-    
-    RasterTriangle2D* projectedTriangles = new RasterTriangle2D[totalTriangles];
-    uint32_t tri_idx = 0; // Keep a running index for our heap array
 
-    // 2. Project all visible triangles from 3D to 2D
-    for (uint8_t i = 0; i < scene->GetMeshCount(); ++i) {
-        Mesh* mesh = scene->GetMeshes()[i];
-        if (mesh && mesh->IsEnabled()) {
-            ITriangleGroup* triangleGroup = mesh->GetTriangleGroup();
-            if(!triangleGroup) continue;
+    // 2. Unchanged meshes reuse last frame's triangles, the cache also holds the array this frame is projected into
+    TriangleCache* cache = cameras[0]->GetFrameHistory()->GetTriangleCache();
+    RasterTriangle2D* projectedTriangles = cache->Reserve(totalTriangles);
+    bool tracked = false;
 
-            if (mesh->HasUV()){
-
-            }
-
-            for (uint16_t j = 0; j < triangleGroup->GetTriangleCount(); ++j) {
-                const Triangle3D& sourceTri = triangleGroup->GetTriangles()[j];
+    for (uint8_t c = 0; c < count; ++c) {
+        tracked = tracked || cameras[c]->GetFrameHistory()->IsEnabled();
+    }
 
-                const RasterTriangle3D rasterTri = mesh->HasUV() ? 
-                    RasterTriangle3D(&sourceTri.p1, &sourceTri.p2, &sourceTri.p3, 
-                        &mesh->GetUVVertices()[mesh->GetUVIndexGroup()[j].A], 
-                        &mesh->GetUVVertices()[mesh->GetUVIndexGroup()[j].B], 
-                        &mesh->GetUVVertices()[mesh->GetUVIndexGroup()[j].C]) :
-                    RasterTriangle3D(&sourceTri.p1, &sourceTri.p2, &sourceTri.p3);
+    const RasterTriangle2D** sources = scratch->sources;
 
-                // Construct the projected triangle directly in our heap-allocated array
-                projectedTriangles[tri_idx] = RasterTriangle2D(*camera->GetTransform(), lookDirection, rasterTri, mesh->GetMaterial());
-                tri_idx++;
-            }
-        }
+    for (uint8_t m = 0; m < meshCount; ++m) {
+        sources[m] = cache->IsEnabled() ? cache->Find(projection, meshes[m], meshes[m]->GetVersion(), meshStarts[m + 1] - meshStarts[m]) : nullptr;
     }
 
-    // 3. Insert pointers to all projected 2D triangles into the QuadTree
+    // 3. Project all other triangles from 3D to 2D, in fixed-size chunks of the shared array
+    ProjectionJob projectionJob{ &projection, meshes, meshStarts, meshCount, sources, projectedTriangles };
+    ForEach(pool, (totalTriangles + kTrianglesPerJob - 1) / kTrianglesPerJob, ProjectTriangles, &projectionJob);
+
+    // 4. Insert pointers to all projected 2D triangles into the QuadTree
     for (uint32_t i = 0; i < totalTriangles; ++i) {
         tree.Insert(&projectedTriangles[i]);
     }
+
+    // The settings are read once so every camera of the frame resolves depth the same way
+    DepthMode mode = depthMode;
+    bool sorted = frontToBack;
+
+    if (sorted) {
+        tree.GetRoot()->SortItems([mode](const RasterTriangle2D* a, const RasterTriangle2D* b) {
+            return GetRejectionDepth(a, mode) < GetRejectionDepth(b, mode);
+        });
+    }
     
-    // 4. Rasterize each pixel
-    IPixelGroup* pixelGroup = camera->GetPixelGroup();
-    for (uint16_t i = 0; i < pixelGroup->GetPixelCount(); ++i) {
-        Vector2D pixel_coord = pixelGroup->GetCoordinate(i);
-        QuadTree<RasterTriangle2D>::Node* leafNode = tree.GetRoot()->FindLeaf(pixel_coord);
+    // 5. Measure the projected bounds of every mesh if any camera renders incrementally
+    FrameHistory::Entry* entries = tracked ? scratch->entries : nullptr;
+
+    for (uint8_t m = 0; entries && m < meshCount; ++m) {
+        FrameHistory::Entry& entry = entries[m];
+
+        entry.mesh = meshes[m];
+        entry.version = meshes[m]->GetVersion();
+        entry.materialVersion = meshes[m]->GetMaterial() ? meshes[m]->GetMaterial()->GetVersion() : 0;
+        entry.minimum = Vector2D(Mathematics::FLTMAX, Mathematics::FLTMAX);
+        entry.maximum = Vector2D(-Mathematics::FLTMAX, -Mathematics::FLTMAX);
 
-        RGBColor final_color(0,0,0);
+        for (uint32_t t = meshStarts[m]; t < meshStarts[m + 1]; ++t) {
+            entry.minimum = Vector2D::Minimum(entry.minimum, projectedTriangles[t].bounds.GetMinimum());
+            entry.maximum = Vector2D::Maximum(entry.maximum, projectedTriangles[t].bounds.GetMaximum());
+        }
+    }
+
+    // Materials may reduce their shading rate even on cameras shading every pixel
+    bool coarseMaterials = false;
+
+    for (uint8_t m = 0; m < meshCount; ++m) {
+        IMaterial* material = meshes[m]->GetMaterial();
+
+        coarseMaterials = coarseMaterials || (material && material->GetShadingRate() > 1);
+    }
 
-        if (leafNode && leafNode->GetItemCount() > 0) {
-            // Directly pass the raw array and count from the node to the rasterizer function
-            final_color = RasterizePixel(leafNode->GetItems(), leafNode->GetItemCount(), pixel_coord);
+    // 6. Rasterize each pixel of every camera in the group, the tree is only read from here on
+    uint32_t sharedTime = uc3d::Time::Micros() - start;
+
+    for (uint8_t c = 0; c < count; ++c) {
+        uint32_t cameraStart = uc3d::Time::Micros();
+        IPixelGroup* pixelGroup = cameras[c]->GetPixelGroup();
+        FrameHistory* history = cameras[c]->GetFrameHistory();
+        ResolutionScaler* scaler = cameras[c]->GetResolutionScaler();
+        PixelCoordinates physical = pixelGroup->GetCoordinates();
+
+        // A resized internal grid holds no previous frame to build on
+        if (scaler->Prepare(cameras[c]->GetCameraMinCoordinate(), cameras[c]->GetCameraMaxCoordinate(), physical)) {
+            history->Invalidate();
         }
 
-        *pixelGroup->GetColor(i) = final_color;
+        bool scaled = scaler->IsActive();
+        PixelCoordinates coordinates = scaled ? scaler->GetCoordinates() : physical;
+        FrameHistory::Region region = history->Update(projection, entries, meshCount);
+        PixelJob pixelJob{
+            tree.GetRoot(), coordinates, scaled ? scaler->GetColors() : pixelGroup->GetColors(), region,
+            history->GetHits(coordinates.GetPixelCount()), projectedTriangles, meshStarts, meshCount,
+            sceneIndices, visibleIndices, sceneMeshCount, mode, sorted, nullptr, cameras[c]->GetShadingRate()
+        };
+        uint32_t ranges = (uint32_t(coordinates.GetPixelCount()) + kPixelsPerJob - 1) / kPixelsPerJob;
+
+        if (region.IsEmpty() || ranges == 0) continue;
+
+        if (!coordinates.IsGrid() || (pixelJob.shadingRate <= 1 && !coarseMaterials)) {
+            ForEach(pool, ranges, RasterizePixels, &pixelJob);
+        } else {
+            // Reduced rates need the whole lattice, the anchors' colors must be complete before any pixel between them reads them
+            pixelJob.samples = cameras[c]->GetRasterScratch()->GetSamples(coordinates.GetPixelCount());
+
+            ForEach(pool, ranges, ShadeAnchors, &pixelJob);
+            ForEach(pool, ranges, ShadeBetweenAnchors, &pixelJob);
+        }
+
+        if (scaled) {
+            UpscaleJob upscaleJob{ scaler, physical, pixelGroup->GetColors() };
+
+            ForEach(pool, (uint32_t(physical.GetPixelCount()) + kPixelsPerJob - 1) / kPixelsPerJob, UpscalePixels, &upscaleJob);
+        }
+
+        // Cameras with dynamic resolution pick the scale of their next frame, skipped frames say nothing about the cost
+        scaler->ReportRenderTime(float(sharedTime + uc3d::Time::Micros() - cameraStart) / 1000000.0f);
     }
 
-    // 5. IMPORTANT: Clean up the memory allocated on the heap
-    delete[] projectedTriangles;
-}
\ No newline at end of file
+    // 7. Keep the triangles for the next frame, the array is reused either way
+    if (cache->IsEnabled()) {
+        TriangleCache::Record* records = scratch->records;
+
+        for (uint8_t m = 0; m < meshCount; ++m) {
+            records[m] = TriangleCache::Record{ meshes[m], meshes[m]->GetVersion(), meshStarts[m], meshStarts[m + 1] - meshStarts[m] };
+        }
+
+        cache->Store(projection, records, meshCount);
+    }
+}
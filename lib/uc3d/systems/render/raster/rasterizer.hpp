@@ -17,28 +17,239 @@
 #include "../core/camerabase.hpp"
 #include "../../../core/color/rgbcolor.hpp"
 #include "helpers/rastertriangle2d.hpp"
+#include "helpers/trianglecache.hpp"
+#include "helpers/rasterscratch.hpp"
+#include "../../../core/platform/threadpool.hpp"
+#include "../../../core/platform/time.hpp"
 
 /**
  * @class Rasterizer
  * @brief Provides static methods for rasterizing 3D scenes into 2D camera views.
+ *
+ * With a thread pool, triangles are projected in fixed-size chunks of one shared array and
+ * pixels are shaded in fixed-size ranges. Each chunk and range writes only its own slots and
+ * the quadtree is built between the two stages, so no locking is needed. Shaders must only
+ * read their material, which IShader::Shade being const requires.
+ *
+ * Cameras with an enabled FrameHistory only shade the pixels inside the region that changed
+ * since their previous frame. Every triangle is still projected, so pixels in that region
+ * are shaded against the full scene and occlusion stays correct.
+ *
+ * Meshes whose version matches the TriangleCache of the group's first camera, under an
+ * unchanged projection, copy their triangles from the previous frame instead of projecting
+ * them again. The quadtree is rebuilt every frame, its pointers refer to the new array.
+ *
+ * By default triangles are ordered by their average depth, which is cheap but wrong where
+ * triangles intersect or overlap partially. The interpolated depth mode compares the depth of
+ * each triangle at the pixel instead. Candidates whose nearest depth is behind the closest hit
+ * so far are rejected before any barycentric math, and with front-to-back ordering every node
+ * is sorted by that depth so the remaining candidates of a node are skipped at once.
+ *
+ * Grid cameras may shade at a reduced rate, see CameraBase::SetShadingRate. Visibility is
+ * still resolved for every pixel, then only the anchors on the rate's lattice are shaded.
+ * A pixel between anchors is interpolated bilinearly if it and its four enclosing anchors
+ * hit the same triangle, otherwise it lies on a triangle or material edge and is shaded.
+ *
+ * Cameras with an active ResolutionScaler render its internal grid instead of their pixels,
+ * the frame history and shading rate then apply to the internal grid, and the pixels are
+ * sampled from it bilinearly afterwards. Each rendered camera reports its own time to its
+ * scaler, the projection shared by its group plus shading its pixels, so one dense camera
+ * does not lower the resolution of the others.
  */
 class Rasterizer {
+public:
+    /**
+     * @enum DepthMode
+     * @brief How the depth of a triangle at a pixel is determined.
+     */
+    enum class DepthMode : uint8_t {
+        Average,     ///< One depth per triangle, the average of its vertices.
+        Interpolated ///< Depth interpolated from the vertices at each pixel.
+    };
+
 private:
+    static DepthMode depthMode; ///< Depth mode of the next Rasterize calls.
+    static bool frontToBack; ///< Set if quadtree nodes are sorted by rejection depth.
+
+    static constexpr uint32_t kTrianglesPerJob = 128; ///< Triangles projected per pool iteration.
+    static constexpr uint32_t kPixelsPerJob = 64; ///< Pixels shaded per pool iteration.
+
+    /**
+     * @struct ProjectionJob
+     * @brief Inputs and output of the projection stage, shared by every chunk.
+     */
+    struct ProjectionJob {
+        const CameraProjection* projection; ///< Projection of the camera group.
+        Mesh** meshes; ///< Visible meshes.
+        const uint32_t* meshStarts; ///< First triangle of each mesh in the shared array, followed by the total.
+        uint8_t meshCount; ///< Number of visible meshes.
+        const RasterTriangle2D* const* sources; ///< Cached triangles of each mesh, nullptr to project it.
+        RasterTriangle2D* triangles; ///< Shared array of projected triangles.
+    };
+
+    using PixelSample = RasterScratch::PixelSample; ///< Closest hit of a pixel.
+
     /**
-     * @brief Finds the correct color for a single pixel by testing against a list of triangles.
+     * @struct PixelJob
+     * @brief Inputs and output of the pixel stage for one camera.
+     */
+    struct PixelJob {
+        const QuadTree<RasterTriangle2D>::Node* root; ///< Root of the triangle quadtree.
+        PixelCoordinates coordinates; ///< Coordinates of the camera's pixels.
+        RGBColor* colors; ///< Colors of the camera's pixels.
+        FrameHistory::Region region; ///< Pixels to shade, the others keep their previous colors.
+        uint32_t* hits; ///< Triangle hit by each pixel in the previous frame, nullptr without a cache.
+        const RasterTriangle2D* triangles; ///< Shared array of projected triangles.
+        const uint32_t* meshStarts; ///< First triangle of each visible mesh, followed by the total.
+        uint8_t meshCount; ///< Number of visible meshes.
+        const uint8_t* sceneIndices; ///< Scene index of each visible mesh.
+        const uint8_t* visibleIndices; ///< Visible index of each scene mesh, kNotVisible if hidden.
+        uint8_t sceneMeshCount; ///< Number of meshes in the scene.
+        DepthMode depthMode; ///< Depth mode of this frame.
+        bool sorted; ///< Set if node items are ordered by rejection depth.
+        PixelSample* samples; ///< Visibility of each pixel for reduced-rate shading, nullptr to shade every pixel.
+        uint8_t shadingRate; ///< Shading rate of the camera, used by materials without their own.
+    };
+
+    /**
+     * @struct UpscaleJob
+     * @brief Inputs and output of upscaling the internal grid of one camera.
+     */
+    struct UpscaleJob {
+        const ResolutionScaler* scaler; ///< Scaler holding the rendered internal grid.
+        PixelCoordinates physical; ///< Coordinates of the camera's pixels.
+        RGBColor* colors; ///< Colors of the camera's pixels.
+    };
+
+    static constexpr uint8_t kNotVisible = 0xFF; ///< Visible index of meshes that are not rendered.
+
+    /**
+     * @brief Resolves a cached hit to the projected triangle it identifies this frame.
+     * @return The triangle, nullptr if the hit is empty or its mesh is not rendered.
+     */
+    static const RasterTriangle2D* FindTriangle(const PixelJob& job, uint32_t hit);
+
+    /**
+     * @brief Builds the cache entry identifying a projected triangle.
+     * @return The hit, FrameHistory::kNoHit for nullptr.
+     */
+    static uint32_t GetHit(const PixelJob& job, const RasterTriangle2D* triangle);
+
+    /**
+     * @brief Runs a loop on a thread pool, or on the caller if there is none.
+     */
+    static void ForEach(ThreadPool* pool, uint32_t count, ThreadPool::Function function, void* context);
+
+    /**
+     * @brief Projects one chunk of kTrianglesPerJob triangles of a ProjectionJob.
+     */
+    static void ProjectTriangles(uint32_t index, void* context);
+
+    /**
+     * @brief Shades one range of kPixelsPerJob pixels of a PixelJob.
+     */
+    static void RasterizePixels(uint32_t index, void* context);
+
+    /**
+     * @brief Upscales one range of kPixelsPerJob pixels of an UpscaleJob.
+     */
+    static void UpscalePixels(uint32_t index, void* context);
+
+    /**
+     * @brief Resolves the visibility of one range of a reduced-rate PixelJob and shades its anchors.
+     */
+    static void ShadeAnchors(uint32_t index, void* context);
+
+    /**
+     * @brief Interpolates or shades the pixels between the anchors of one range of a PixelJob.
+     */
+    static void ShadeBetweenAnchors(uint32_t index, void* context);
+
+    /**
+     * @brief Retrieves the spacing at which the material of a triangle is shaded in a job.
+     */
+    static uint8_t GetShadingRate(const PixelJob& job, const RasterTriangle2D* triangle);
+
+    /**
+     * @brief Checks if a pixel is shaded directly, misses and pixels on the rate's lattice are.
+     *
+     * The last column and row are always on the lattice so every pixel has enclosing anchors.
+     */
+    static bool IsAnchor(const PixelJob& job, uint32_t index, const RasterTriangle2D* triangle);
+
+    /**
+     * @brief Retrieves the depth of a triangle at a pixel if it covers the pixel.
+     *
+     * @param triangle The candidate triangle.
+     * @param point The prepared pixel coordinate.
+     * @param mode How the depth at the pixel is determined.
+     * @param depth [out] The depth of the triangle at the pixel.
+     * @return True if the triangle covers the pixel.
+     */
+    static bool GetDepthAt(const RasterTriangle2D* triangle, const RasterTriangle2D::Point& point, DepthMode mode, float& depth);
+
+    /**
+     * @brief Finds the closest triangle covering a pixel by testing against the triangles of a quadtree.
      *
-     * @param candidate_triangles A C-style array of pointers to candidate 2D raster triangles.
-     * @param count The number of triangles in the candidates array.
+     * Triangles straddling a split stay in the parent node, so every node on the path from
+     * the root to the leaf containing the pixel is tested. A triangle hit by the pixel in the
+     * previous frame is tested first, its depth then rejects most other candidates before
+     * their barycentric test. With average depth candidates are only tested for coverage and
+     * the weights are computed once for the closest hit.
+     *
+     * @param root The root node of the quadtree holding the projected triangles.
      * @param pixel_coord The 2D coordinate of the pixel being rendered.
+     * @param sample [in,out] Triangle to test first or nullptr, receives the closest hit and its weights.
+     * @param mode How the depth of a candidate at the pixel is determined.
+     * @param sorted True if node items are ordered by their rejection depth.
+     */
+    static void FindClosest(const QuadTree<RasterTriangle2D>::Node* root, const Vector2D& pixel_coord, PixelSample& sample, DepthMode mode, bool sorted);
+
+    /**
+     * @brief Shades the hit of a pixel with the material of its triangle.
+     *
+     * @param sample The closest hit of the pixel.
      * @return The calculated RGBColor for the pixel. Returns black if no intersection.
      */
-    static RGBColor RasterizePixel(RasterTriangle2D** candidate_triangles, unsigned short count, const Vector2D& pixel_coord);
+    static RGBColor Shade(const PixelSample& sample);
+
+    /**
+     * @brief Retrieves the depth below which a triangle may cover a pixel in a depth mode.
+     */
+    static float GetRejectionDepth(const RasterTriangle2D* triangle, DepthMode mode) {
+        return mode == DepthMode::Interpolated ? triangle->minimumDepth : triangle->averageDepth;
+    }
 
 public:
+    /**
+     * @brief Selects how depth is resolved by the next Rasterize calls.
+     *
+     * Must not be called while a frame is being rasterized.
+     *
+     * @param mode How the depth of a triangle at a pixel is determined.
+     * @param sortFrontToBack True to order every quadtree node by rejection depth once per frame.
+     */
+    static void SetDepthMode(DepthMode mode, bool sortFrontToBack = false);
+
     /**
      * @brief Renders an entire scene from the perspective of a given camera.
      * @param scene The scene containing meshes and materials.
      * @param camera The camera defining the viewpoint and projection.
+     * @param pool Optional pool splitting projection and shading across threads.
+     */
+    static void Rasterize(Scene* scene, CameraBase* camera, ThreadPool* pool = nullptr);
+
+    /**
+     * @brief Renders a scene for a group of cameras that share one viewpoint.
+     *
+     * Triangles are projected and indexed once with the projection of the first camera,
+     * over the union of the cameras' coordinate bounds, and every camera then only samples
+     * its own pixels. The cameras must have matching projections, see CameraProjection::Matches.
+     *
+     * @param scene The scene containing meshes and materials.
+     * @param cameras Array of 3D cameras sharing a viewpoint.
+     * @param count The number of cameras in the array.
+     * @param pool Optional pool splitting projection and shading across threads.
      */
-    static void Rasterize(Scene* scene, CameraBase* camera);
+    static void Rasterize(Scene* scene, CameraBase** cameras, uint8_t count, ThreadPool* pool = nullptr);
 };
\ No newline at end of file
@@ -0,0 +1,331 @@
+#include "bvh.hpp"
+
+BVH::BVH()
+    : triangles(nullptr), triangleCount(0), indices(nullptr),
+      nodes(nullptr), nodeCount(0), capacity(0), centroids(nullptr),
+      buildCost(0.0f), cost(0.0f), soa(nullptr) {}
+
+BVH::~BVH() {
+    delete[] indices;
+    delete[] nodes;
+    delete[] centroids;
+    delete[] soa;
+}
+
+float BVH::GetAxis(const Vector3D& vector, uint8_t axis) {
+    return axis == 0 ? vector.X : (axis == 1 ? vector.Y : vector.Z);
+}
+
+float BVH::GetHalfArea(const Vector3D& minimum, const Vector3D& maximum) {
+    float x = maximum.X - minimum.X;
+    float y = maximum.Y - minimum.Y;
+    float z = maximum.Z - minimum.Z;
+
+    return x * y + y * z + z * x;
+}
+
+void BVH::ExpandBounds(const RasterTriangle3D& triangle, Vector3D& minimum, Vector3D& maximum) {
+    const Vector3D* vertices[3] = { triangle.p1, triangle.p2, triangle.p3 };
+
+    for (uint8_t i = 0; i < 3; ++i) {
+        const Vector3D& p = *vertices[i];
+
+        if (p.X < minimum.X) minimum.X = p.X;
+        if (p.Y < minimum.Y) minimum.Y = p.Y;
+        if (p.Z < minimum.Z) minimum.Z = p.Z;
+        if (p.X > maximum.X) maximum.X = p.X;
+        if (p.Y > maximum.Y) maximum.Y = p.Y;
+        if (p.Z > maximum.Z) maximum.Z = p.Z;
+    }
+}
+
+void BVH::Build(const RasterTriangle3D* triangles, uint32_t count) {
+    this->triangles = triangles;
+    triangleCount = count;
+    nodeCount = 0;
+
+    if (count == 0) return;
+
+    // A binary tree with single-triangle leaves has at most 2n - 1 nodes
+    if (count > capacity) {
+        delete[] indices;
+        delete[] nodes;
+        delete[] soa;
+
+        capacity = count;
+        indices = new uint32_t[capacity];
+        nodes = new Node[2 * capacity - 1];
+        soa = new float[kSoAArrays * capacity];
+    }
+
+    centroids = new Vector3D[count];
+
+    for (uint32_t i = 0; i < count; ++i) {
+        const RasterTriangle3D& triangle = triangles[i];
+
+        indices[i] = i;
+        centroids[i] = Vector3D(
+            (triangle.p1->X + triangle.p2->X + triangle.p3->X) / 3.0f,
+            (triangle.p1->Y + triangle.p2->Y + triangle.p3->Y) / 3.0f,
+            (triangle.p1->Z + triangle.p2->Z + triangle.p3->Z) / 3.0f
+        );
+    }
+
+    BuildNode(0, count, 0);
+
+    // Centroids are only needed for partitioning, release them until the next build
+    delete[] centroids;
+    centroids = nullptr;
+
+    UpdateNodes(false);
+    UpdateSoA();
+    buildCost = cost;
+}
+
+void BVH::Refit() {
+    UpdateNodes(true);
+    UpdateSoA();
+}
+
+void BVH::UpdateSoA() {
+    for (uint32_t i = 0; i < triangleCount; ++i) {
+        const RasterTriangle3D& triangle = triangles[indices[i]];
+
+        soa[i] = triangle.p1->X;
+        soa[capacity + i] = triangle.p1->Y;
+        soa[2 * capacity + i] = triangle.p1->Z;
+        soa[3 * capacity + i] = triangle.edge1.X;
+        soa[4 * capacity + i] = triangle.edge1.Y;
+        soa[5 * capacity + i] = triangle.edge1.Z;
+        soa[6 * capacity + i] = triangle.edge2.X;
+        soa[7 * capacity + i] = triangle.edge2.Y;
+        soa[8 * capacity + i] = triangle.edge2.Z;
+    }
+}
+
+float BVH::GetDegradation() const {
+    return buildCost > 0.0f ? cost / buildCost : 1.0f;
+}
+
+void BVH::UpdateNodes(bool updateBounds) {
+    float total = 0.0f;
+
+    for (uint32_t index = nodeCount; index-- > 0; ) {
+        Node& node = nodes[index];
+
+        if (updateBounds) {
+            if (node.IsLeaf()) {
+                node.minimum = Vector3D(Mathematics::FLTMAX, Mathematics::FLTMAX, Mathematics::FLTMAX);
+                node.maximum = Vector3D(-Mathematics::FLTMAX, -Mathematics::FLTMAX, -Mathematics::FLTMAX);
+
+                for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+                    ExpandBounds(triangles[indices[i]], node.minimum, node.maximum);
+                }
+            }
+            else {
+                const Node& left = nodes[index + 1];
+                const Node& right = nodes[node.offset];
+
+                node.minimum = Vector3D::Min(left.minimum, right.minimum);
+                node.maximum = Vector3D::Max(left.maximum, right.maximum);
+            }
+        }
+
+        total += GetHalfArea(node.minimum, node.maximum) * (node.IsLeaf() ? float(node.count) : kTraversalCost);
+    }
+
+    float rootArea = nodeCount > 0 ? GetHalfArea(nodes[0].minimum, nodes[0].maximum) : 0.0f;
+
+    cost = rootArea > 0.0f ? total / rootArea : 0.0f;
+}
+
+float BVH::FindSplit(uint32_t start, uint32_t count, const Vector3D& centroidMin, const Vector3D& centroidMax, uint8_t& axis, uint8_t& bin) const {
+    float bestCost = Mathematics::FLTMAX;
+
+    for (uint8_t a = 0; a < 3; ++a) {
+        float low = GetAxis(centroidMin, a);
+        float extent = GetAxis(centroidMax, a) - low;
+
+        if (extent <= 0.0f) continue;
+
+        Vector3D binMin[kBinCount];
+        Vector3D binMax[kBinCount];
+        uint32_t binCount[kBinCount] = {0};
+        float scale = float(kBinCount) / extent;
+
+        for (uint8_t b = 0; b < kBinCount; ++b) {
+            binMin[b] = Vector3D(Mathematics::FLTMAX, Mathematics::FLTMAX, Mathematics::FLTMAX);
+            binMax[b] = Vector3D(-Mathematics::FLTMAX, -Mathematics::FLTMAX, -Mathematics::FLTMAX);
+        }
+
+        for (uint32_t i = start; i < start + count; ++i) {
+            uint8_t b = uint8_t(Mathematics::Min<float>((GetAxis(centroids[indices[i]], a) - low) * scale, kBinCount - 1));
+
+            binCount[b]++;
+            ExpandBounds(triangles[indices[i]], binMin[b], binMax[b]);
+        }
+
+        // Sweep from the right to collect the cost of every right side, then from the left to combine
+        float rightArea[kBinCount - 1];
+        uint32_t rightCount[kBinCount - 1];
+        Vector3D sweepMin(Mathematics::FLTMAX, Mathematics::FLTMAX, Mathematics::FLTMAX);
+        Vector3D sweepMax(-Mathematics::FLTMAX, -Mathematics::FLTMAX, -Mathematics::FLTMAX);
+        uint32_t sweepCount = 0;
+
+        for (uint8_t b = kBinCount - 1; b > 0; --b) {
+            sweepMin = Vector3D::Min(sweepMin, binMin[b]);
+            sweepMax = Vector3D::Max(sweepMax, binMax[b]);
+            sweepCount += binCount[b];
+            rightArea[b - 1] = sweepCount ? GetHalfArea(sweepMin, sweepMax) : 0.0f;
+            rightCount[b - 1] = sweepCount;
+        }
+
+        sweepMin = Vector3D(Mathematics::FLTMAX, Mathematics::FLTMAX, Mathematics::FLTMAX);
+        sweepMax = Vector3D(-Mathematics::FLTMAX, -Mathematics::FLTMAX, -Mathematics::FLTMAX);
+        sweepCount = 0;
+
+        for (uint8_t b = 0; b < kBinCount - 1; ++b) {
+            sweepMin = Vector3D::Min(sweepMin, binMin[b]);
+            sweepMax = Vector3D::Max(sweepMax, binMax[b]);
+            sweepCount += binCount[b];
+
+            if (sweepCount == 0 || rightCount[b] == 0) continue;
+
+            float cost = GetHalfArea(sweepMin, sweepMax) * sweepCount + rightArea[b] * rightCount[b];
+
+            if (cost < bestCost) {
+                bestCost = cost;
+                axis = a;
+                bin = b;
+            }
+        }
+    }
+
+    return bestCost;
+}
+
+uint32_t BVH::BuildNode(uint32_t start, uint32_t count, uint8_t depth) {
+    uint32_t index = nodeCount++;
+    Node& node = nodes[index];
+
+    node.minimum = Vector3D(Mathematics::FLTMAX, Mathematics::FLTMAX, Mathematics::FLTMAX);
+    node.maximum = Vector3D(-Mathematics::FLTMAX, -Mathematics::FLTMAX, -Mathematics::FLTMAX);
+
+    Vector3D centroidMin = node.minimum;
+    Vector3D centroidMax = node.maximum;
+
+    for (uint32_t i = start; i < start + count; ++i) {
+        ExpandBounds(triangles[indices[i]], node.minimum, node.maximum);
+        centroidMin = Vector3D::Min(centroidMin, centroids[indices[i]]);
+        centroidMax = Vector3D::Max(centroidMax, centroids[indices[i]]);
+    }
+
+    node.offset = start;
+    node.count = count;
+    node.axis = 0;
+
+    if (count <= kMaxLeafSize || depth >= kMaxDepth - 1) return index;
+
+    uint8_t axis = 0;
+    uint8_t bin = 0;
+    float splitCost = FindSplit(start, count, centroidMin, centroidMax, axis, bin);
+    float parentArea = GetHalfArea(node.minimum, node.maximum);
+
+    // Keep the leaf when splitting is not expected to save triangle tests
+    if (splitCost == Mathematics::FLTMAX) return index;
+    if (parentArea > 0.0f && kTraversalCost + splitCost / parentArea >= float(count)) return index;
+
+    float low = GetAxis(centroidMin, axis);
+    float scale = float(kBinCount) / (GetAxis(centroidMax, axis) - low);
+    uint32_t middle = start;
+
+    for (uint32_t i = start; i < start + count; ++i) {
+        uint8_t b = uint8_t(Mathematics::Min<float>((GetAxis(centroids[indices[i]], axis) - low) * scale, kBinCount - 1));
+
+        if (b <= bin) {
+            uint32_t temp = indices[i];
+            indices[i] = indices[middle];
+            indices[middle] = temp;
+            middle++;
+        }
+    }
+
+    node.count = 0;
+    node.axis = axis;
+
+    // The left subtree is laid out directly after this node, only the right child needs an index
+    BuildNode(start, middle - start, depth + 1);
+
+    node.offset = BuildNode(middle, start + count - middle, depth + 1);
+
+    return index;
+}
+
+bool BVH::IntersectsBounds(const Node& node, const Vector3D& origin, const Vector3D& inverseDirection, float maxT) {
+    float t1 = (node.minimum.X - origin.X) * inverseDirection.X;
+    float t2 = (node.maximum.X - origin.X) * inverseDirection.X;
+    float tMin = Mathematics::Min(t1, t2);
+    float tMax = Mathematics::Max(t1, t2);
+
+    t1 = (node.minimum.Y - origin.Y) * inverseDirection.Y;
+    t2 = (node.maximum.Y - origin.Y) * inverseDirection.Y;
+    tMin = Mathematics::Max(tMin, Mathematics::Min(t1, t2));
+    tMax = Mathematics::Min(tMax, Mathematics::Max(t1, t2));
+
+    t1 = (node.minimum.Z - origin.Z) * inverseDirection.Z;
+    t2 = (node.maximum.Z - origin.Z) * inverseDirection.Z;
+    tMin = Mathematics::Max(tMin, Mathematics::Min(t1, t2));
+    tMax = Mathematics::Min(tMax, Mathematics::Max(t1, t2));
+
+    return tMax >= Mathematics::Max(tMin, 0.0f) && tMin < maxT;
+}
+
+bool BVH::Intersect(const Vector3D& origin, const Vector3D& direction, Hit& hit) const {
+    if (nodeCount == 0) return false;
+
+    // Axis-parallel rays divide by zero, a huge reciprocal keeps the slab test well defined
+    Vector3D inverseDirection(
+        direction.X != 0.0f ? 1.0f / direction.X : Mathematics::FLTMAX,
+        direction.Y != 0.0f ? 1.0f / direction.Y : Mathematics::FLTMAX,
+        direction.Z != 0.0f ? 1.0f / direction.Z : Mathematics::FLTMAX
+    );
+
+    uint32_t stack[kMaxDepth + 1];
+    uint8_t stackSize = 0;
+    bool found = false;
+
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0) {
+        uint32_t index = stack[--stackSize];
+        const Node& node = nodes[index];
+
+        if (!IntersectsBounds(node, origin, inverseDirection, hit.t)) continue;
+
+        if (node.IsLeaf()) {
+            for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+                float t, u, v;
+
+                if (triangles[indices[i]].IntersectsRay(origin, direction, t, u, v) && t < hit.t) {
+                    hit.triangle = indices[i];
+                    hit.t = t;
+                    hit.u = u;
+                    hit.v = v;
+                    found = true;
+                }
+            }
+
+            continue;
+        }
+
+        // Push the far child first so the near child is visited first and tightens hit.t early
+        bool negative = GetAxis(direction, node.axis) < 0.0f;
+        uint32_t left = index + 1;
+        uint32_t right = node.offset;
+
+        stack[stackSize++] = negative ? left : right;
+        stack[stackSize++] = negative ? right : left;
+    }
+
+    return found;
+}
@@ -0,0 +1,201 @@
+/**
+ * @file bvh.hpp
+ * @brief A bounding volume hierarchy over raster triangles for ray queries.
+ * @date  16/10/2026
+ * @author Coela Can't
+ */
+#pragma once
+
+#include <cstdint>
+#include "../../../core/math/vector3d.hpp"
+#include "raypacket.hpp"
+#include "../raster/helpers/rastertriangle3d.hpp"
+
+/**
+ * @class BVH
+ * @brief Binary tree of axis-aligned boxes used to find the closest triangle along a ray.
+ *
+ * The tree is built top-down with a binned surface area heuristic and stored as a
+ * flat, depth-first array: the left child of an interior node immediately follows it
+ * and the right child is referenced by index. Triangles are not copied, the tree only
+ * stores a permutation of their indices, so the triangle array must outlive the tree.
+ *
+ * This implementation is memory-conscious, using raw dynamically-sized arrays
+ * instead of std::vector, and traverses with a fixed-size stack.
+ *
+ * When triangles move but keep their order, Refit updates the node bounds in O(n)
+ * instead of rebuilding. Refitted trees stay correct but lose quality as triangles
+ * drift from their original groupings, GetDegradation reports how far the estimated
+ * traversal cost has grown so callers can schedule a full rebuild.
+ *
+ * Coherent rays can be traced together with IntersectPacket. Packet queries read a
+ * copy of the triangle vertices and edges kept in leaf order with one array per
+ * component, so the triangles of a leaf are adjacent in memory.
+ */
+class BVH {
+public:
+    /**
+     * @struct Node
+     * @brief A node of the hierarchy, either a leaf holding triangles or an interior split.
+     */
+    struct Node {
+        Vector3D minimum; ///< Minimum corner of the node bounds.
+        Vector3D maximum; ///< Maximum corner of the node bounds.
+        uint32_t offset;  ///< First entry in the index array for leaves, right child for interior nodes.
+        uint32_t count;   ///< Number of triangles for leaves, zero for interior nodes.
+        uint8_t axis;     ///< Split axis of interior nodes, used to visit the nearer child first.
+
+        /** @brief Checks if this node is a leaf. */
+        bool IsLeaf() const { return count > 0; }
+    };
+
+    /**
+     * @struct Hit
+     * @brief Result of a ray query.
+     */
+    struct Hit {
+        uint32_t triangle; ///< Index of the closest triangle that was hit.
+        float t;           ///< Distance along the ray, set to the maximum distance before a query.
+        float u;           ///< Barycentric weight of the second vertex.
+        float v;           ///< Barycentric weight of the third vertex.
+    };
+
+private:
+    /* --- Compile-time constants --- */
+    static constexpr uint8_t kBinCount = 12;    ///< Number of centroid bins evaluated per axis.
+    static constexpr uint8_t kMaxLeafSize = 4;  ///< Leaves with at most this many triangles are never split.
+    static constexpr uint8_t kMaxDepth = 48;    ///< Maximum depth of the tree, bounds the traversal stack.
+    static constexpr float kTraversalCost = 1.0f; ///< Cost of visiting a node relative to one triangle test.
+    static constexpr uint8_t kSoAArrays = 9;    ///< Component arrays per triangle: vertex, first edge, second edge.
+
+    /* --- Tree state --- */
+    const RasterTriangle3D* triangles; ///< Triangles referenced by the tree, not owned.
+    uint32_t triangleCount;            ///< Number of triangles in the tree.
+    uint32_t* indices;                 ///< Triangle indices ordered so every leaf covers a contiguous range.
+    Node* nodes;                       ///< Flat, depth-first node array.
+    uint32_t nodeCount;                ///< Number of nodes in use.
+    uint32_t capacity;                 ///< Allocated size of the node and index arrays, in triangles.
+    Vector3D* centroids;               ///< Triangle centroids, only allocated during a build.
+    float buildCost;                   ///< Estimated traversal cost right after the last build.
+    float cost;                        ///< Estimated traversal cost of the current bounds.
+    float* soa;                        ///< Leaf-ordered triangle data, kSoAArrays arrays of capacity floats.
+
+    /** @brief Retrieves a component of a vector by axis index. */
+    static float GetAxis(const Vector3D& vector, uint8_t axis);
+
+    /** @brief Computes the surface area of a box, scaled by one half. */
+    static float GetHalfArea(const Vector3D& minimum, const Vector3D& maximum);
+
+    /** @brief Grows a box to contain every vertex of a triangle. */
+    static void ExpandBounds(const RasterTriangle3D& triangle, Vector3D& minimum, Vector3D& maximum);
+
+    /**
+     * @brief Finds the cheapest split of a range of triangles with binned SAH.
+     *
+     * @param start First entry of the range in the index array.
+     * @param count Number of triangles in the range.
+     * @param centroidMin Minimum corner of the centroid bounds.
+     * @param centroidMax Maximum corner of the centroid bounds.
+     * @param axis [out] Axis of the best split.
+     * @param bin [out] Last bin on the left side of the best split.
+     * @return The estimated cost of the split, or the maximum float value if no split exists.
+     */
+    float FindSplit(uint32_t start, uint32_t count, const Vector3D& centroidMin, const Vector3D& centroidMax, uint8_t& axis, uint8_t& bin) const;
+
+    /**
+     * @brief Recursively builds the subtree for a range of triangles.
+     *
+     * @param start First entry of the range in the index array.
+     * @param count Number of triangles in the range.
+     * @param depth Depth of the new node.
+     * @return Index of the new node.
+     */
+    uint32_t BuildNode(uint32_t start, uint32_t count, uint8_t depth);
+
+    /**
+     * @brief Tests a ray against the bounds of a node with the slab method.
+     *
+     * @param node Node to test.
+     * @param origin Origin of the ray.
+     * @param inverseDirection Reciprocal of each component of the ray direction.
+     * @param maxT Distance of the closest hit so far.
+     * @return true if the ray enters the node before maxT.
+     */
+    static bool IntersectsBounds(const Node& node, const Vector3D& origin, const Vector3D& inverseDirection, float maxT);
+
+    /**
+     * @brief Recomputes the bounds of nodes bottom-up and the estimated traversal cost.
+     *
+     * Children always follow their parent in the node array, so a reverse sweep visits
+     * every child before its parent.
+     *
+     * @param updateBounds False to only recompute the cost from the current bounds.
+     */
+    void UpdateNodes(bool updateBounds);
+
+    /**
+     * @brief Copies the vertex and edges of every triangle into the leaf-ordered component arrays.
+     */
+    void UpdateSoA();
+
+public:
+    /** @brief Constructs an empty tree. */
+    BVH();
+
+    /** @brief Destroys the tree and frees its storage. */
+    ~BVH();
+
+    /**
+     * @brief Builds the tree over an array of triangles, reusing storage when possible.
+     *
+     * @param triangles Triangles to index, must outlive the tree or the next build.
+     * @param count Number of triangles.
+     */
+    void Build(const RasterTriangle3D* triangles, uint32_t count);
+
+    /**
+     * @brief Finds the closest triangle along a ray.
+     *
+     * @param origin Origin of the ray.
+     * @param direction Direction of the ray.
+     * @param hit [in,out] hit.t limits the search distance, filled with the closest hit on success.
+     * @return true if a triangle closer than the initial hit.t was found.
+     */
+    bool Intersect(const Vector3D& origin, const Vector3D& direction, Hit& hit) const;
+
+    /**
+     * @brief Finds the closest triangle along every ray of a packet.
+     *
+     * A node is visited when any ray of the packet enters it, children are ordered by the
+     * direction of the first ray. Hits match Intersect run on each ray separately.
+     *
+     * @param packet [in,out] Rays to trace, packet.t limits the search distance of each ray.
+     */
+    template<uint8_t width>
+    void IntersectPacket(RayPacket<width>& packet) const;
+
+    /**
+     * @brief Updates the node bounds after triangle vertices moved, keeping the tree structure.
+     *
+     * The triangle array passed to the last build must still hold the same triangles in the
+     * same order, with their edges recomputed.
+     */
+    void Refit();
+
+    /**
+     * @brief Retrieves how much the estimated traversal cost grew since the last build.
+     *
+     * The cost is the surface area heuristic of the whole tree. A value of 1.5 means rays
+     * are expected to visit about 50% more nodes and triangles than with a fresh build.
+     *
+     * @return Ratio of the current cost to the cost after the last build, 1 for a fresh build.
+     */
+    float GetDegradation() const;
+
+    /* --- Getters for tree properties --- */
+    const Node* GetNodes() const { return nodes; }
+    uint32_t GetNodeCount() const { return nodeCount; }
+    uint32_t GetTriangleCount() const { return triangleCount; }
+};
+
+#include "bvh.tpp" // Include the template implementation.
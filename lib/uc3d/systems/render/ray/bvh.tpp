@@ -0,0 +1,50 @@
+#pragma once
+
+template<uint8_t width>
+void BVH::IntersectPacket(RayPacket<width>& packet) const {
+    if (nodeCount == 0) return;
+
+    const float* vertexX = soa;
+    const float* vertexY = soa + capacity;
+    const float* vertexZ = soa + 2 * capacity;
+    const float* edge1X = soa + 3 * capacity;
+    const float* edge1Y = soa + 4 * capacity;
+    const float* edge1Z = soa + 5 * capacity;
+    const float* edge2X = soa + 6 * capacity;
+    const float* edge2Y = soa + 7 * capacity;
+    const float* edge2Z = soa + 8 * capacity;
+
+    float direction[3] = { packet.directionX[0], packet.directionY[0], packet.directionZ[0] };
+    uint32_t stack[kMaxDepth + 1];
+    uint8_t stackSize = 0;
+
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0) {
+        uint32_t index = stack[--stackSize];
+        const Node& node = nodes[index];
+
+        if (!packet.IntersectsBounds(node.minimum, node.maximum)) continue;
+
+        if (node.IsLeaf()) {
+            for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+                RasterTriangle3D::IntersectsPacket(
+                    Vector3D(vertexX[i], vertexY[i], vertexZ[i]),
+                    Vector3D(edge1X[i], edge1Y[i], edge1Z[i]),
+                    Vector3D(edge2X[i], edge2Y[i], edge2Z[i]),
+                    indices[i], packet
+                );
+            }
+
+            continue;
+        }
+
+        // Coherent rays share their direction signs, the first ray picks the near child for all of them
+        bool negative = direction[node.axis] < 0.0f;
+        uint32_t left = index + 1;
+        uint32_t right = node.offset;
+
+        stack[stackSize++] = negative ? left : right;
+        stack[stackSize++] = negative ? right : left;
+    }
+}
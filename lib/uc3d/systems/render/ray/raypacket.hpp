@@ -0,0 +1,201 @@
+/**
+ * @file raypacket.hpp
+ * @brief A fixed-width bundle of rays stored as structure-of-arrays for packet traversal.
+ * @date  16/10/2026
+ * @author Coela Can't
+ */
+#pragma once
+
+#include <cstdint>
+#include "../../../core/math/mathematics.hpp"
+#include "../../../core/math/vector3d.hpp"
+
+/**
+ * @struct RayLanesTag
+ * @brief Selects the scalar or the vector implementation of a packet operation at compile time.
+ */
+template<bool vector>
+struct RayLanesTag {};
+
+/**
+ * @struct RayLanes
+ * @brief Selects the storage of one value per ray for a packet width.
+ *
+ * On GCC-compatible compilers 4- and 8-wide packets use vector extension types, so
+ * arithmetic on a whole packet compiles to SIMD instructions where the target has them
+ * and to element-wise code elsewhere. Other compilers and widths use plain arrays.
+ *
+ * @tparam width Number of rays in the packet.
+ */
+template<uint8_t width>
+struct RayLanes {
+    typedef RayLanesTag<false> Tag; ///< Scalar implementation.
+    typedef float Float[width];     ///< One float per ray.
+    typedef uint32_t Index[width];  ///< One triangle index per ray.
+};
+
+#if defined(__GNUC__)
+template<>
+struct RayLanes<4> {
+    typedef RayLanesTag<true> Tag;
+    typedef float Float __attribute__((vector_size(16)));
+    typedef int32_t Mask __attribute__((vector_size(16))); ///< Comparison result per ray, all bits set if true.
+    typedef uint32_t Index __attribute__((vector_size(16)));
+};
+
+template<>
+struct RayLanes<8> {
+    typedef RayLanesTag<true> Tag;
+    typedef float Float __attribute__((vector_size(32)));
+    typedef int32_t Mask __attribute__((vector_size(32))); ///< Comparison result per ray, all bits set if true.
+    typedef uint32_t Index __attribute__((vector_size(32)));
+};
+#endif
+
+/**
+ * @class RayPacket
+ * @brief Holds the origins, directions and closest hits of a group of rays, one array per component.
+ *
+ * Primary rays of neighboring pixels are nearly parallel and hit the same nodes and triangles,
+ * so testing them together shares every node fetch and triangle setup across the packet, and
+ * the per-ray math runs on all rays at once through RayLanes. Components are read and written
+ * per ray with the subscript operator in either storage. Lanes that are not in use keep their
+ * maximum distance at zero and never record a hit.
+ *
+ * @tparam width Number of rays in the packet, 4 and 8 match common vector register widths.
+ */
+template<uint8_t width>
+class RayPacket {
+public:
+    typedef typename RayLanes<width>::Float Float; ///< One float per ray.
+    typedef typename RayLanes<width>::Index Index; ///< One triangle index per ray.
+
+    static constexpr uint32_t kNoHit = 0xFFFFFFFF; ///< Triangle index of rays that did not hit anything.
+
+    alignas(32) Float originX;    ///< X component of each ray origin.
+    alignas(32) Float originY;    ///< Y component of each ray origin.
+    alignas(32) Float originZ;    ///< Z component of each ray origin.
+    alignas(32) Float directionX; ///< X component of each ray direction.
+    alignas(32) Float directionY; ///< Y component of each ray direction.
+    alignas(32) Float directionZ; ///< Z component of each ray direction.
+    alignas(32) Float inverseX;   ///< Reciprocal of each X direction, used by the slab test.
+    alignas(32) Float inverseY;   ///< Reciprocal of each Y direction, used by the slab test.
+    alignas(32) Float inverseZ;   ///< Reciprocal of each Z direction, used by the slab test.
+    alignas(32) Float t;          ///< Distance to the closest hit, limits the search before a query.
+    alignas(32) Float u;          ///< Barycentric weight of the second vertex of the closest hit.
+    alignas(32) Float v;          ///< Barycentric weight of the third vertex of the closest hit.
+    alignas(32) Index triangle;   ///< Index of the closest triangle, kNoHit if nothing was hit.
+
+    /**
+     * @brief Sets one ray of the packet and resets its hit.
+     *
+     * @param lane Index of the ray within the packet.
+     * @param origin Origin of the ray.
+     * @param direction Direction of the ray.
+     * @param maxT Maximum distance searched along the ray.
+     */
+    void SetRay(uint8_t lane, const Vector3D& origin, const Vector3D& direction, float maxT = Mathematics::FLTMAX) {
+        originX[lane] = origin.X;
+        originY[lane] = origin.Y;
+        originZ[lane] = origin.Z;
+        directionX[lane] = direction.X;
+        directionY[lane] = direction.Y;
+        directionZ[lane] = direction.Z;
+
+        // Axis-parallel rays divide by zero, a huge reciprocal keeps the slab test well defined
+        inverseX[lane] = direction.X != 0.0f ? 1.0f / direction.X : Mathematics::FLTMAX;
+        inverseY[lane] = direction.Y != 0.0f ? 1.0f / direction.Y : Mathematics::FLTMAX;
+        inverseZ[lane] = direction.Z != 0.0f ? 1.0f / direction.Z : Mathematics::FLTMAX;
+
+        t[lane] = maxT;
+        u[lane] = 0.0f;
+        v[lane] = 0.0f;
+        triangle[lane] = kNoHit;
+    }
+
+    /**
+     * @brief Disables a lane so it is ignored by every test.
+     *
+     * @param lane Index of the ray within the packet.
+     */
+    void ClearRay(uint8_t lane) {
+        SetRay(lane, Vector3D(), Vector3D(0.0f, 0.0f, 1.0f), 0.0f);
+    }
+
+    /**
+     * @brief Tests whether any ray of the packet enters a box before its closest hit.
+     *
+     * @param minimum Minimum corner of the box.
+     * @param maximum Maximum corner of the box.
+     * @return true if at least one ray enters the box.
+     */
+    bool IntersectsBounds(const Vector3D& minimum, const Vector3D& maximum) const {
+        return IntersectsBounds(minimum, maximum, typename RayLanes<width>::Tag());
+    }
+
+private:
+    /** @brief Slab test over plain arrays, one ray at a time. */
+    bool IntersectsBounds(const Vector3D& minimum, const Vector3D& maximum, RayLanesTag<false>) const {
+        const float minX = minimum.X, minY = minimum.Y, minZ = minimum.Z;
+        const float maxX = maximum.X, maxY = maximum.Y, maxZ = maximum.Z;
+        uint8_t any = 0;
+
+        for (uint8_t i = 0; i < width; ++i) {
+            float t1 = (minX - originX[i]) * inverseX[i];
+            float t2 = (maxX - originX[i]) * inverseX[i];
+            float tMin = Mathematics::Min(t1, t2);
+            float tMax = Mathematics::Max(t1, t2);
+
+            t1 = (minY - originY[i]) * inverseY[i];
+            t2 = (maxY - originY[i]) * inverseY[i];
+            tMin = Mathematics::Max(tMin, Mathematics::Min(t1, t2));
+            tMax = Mathematics::Min(tMax, Mathematics::Max(t1, t2));
+
+            t1 = (minZ - originZ[i]) * inverseZ[i];
+            t2 = (maxZ - originZ[i]) * inverseZ[i];
+            tMin = Mathematics::Max(tMin, Mathematics::Min(t1, t2));
+            tMax = Mathematics::Min(tMax, Mathematics::Max(t1, t2));
+
+            tMin = Mathematics::Max(tMin, 0.0f);
+
+            any |= uint8_t(tMax >= tMin) & uint8_t(tMin < t[i]);
+        }
+
+        return any != 0;
+    }
+
+#if defined(__GNUC__)
+    /** @brief Slab test on every ray at once with vector extension types. */
+    bool IntersectsBounds(const Vector3D& minimum, const Vector3D& maximum, RayLanesTag<true>) const {
+        typedef typename RayLanes<width>::Mask Mask;
+
+        Float t1 = (minimum.X - originX) * inverseX;
+        Float t2 = (maximum.X - originX) * inverseX;
+        Float tMin = t1 < t2 ? t1 : t2;
+        Float tMax = t1 < t2 ? t2 : t1;
+
+        t1 = (minimum.Y - originY) * inverseY;
+        t2 = (maximum.Y - originY) * inverseY;
+        Float near = t1 < t2 ? t1 : t2;
+        Float far = t1 < t2 ? t2 : t1;
+        tMin = near > tMin ? near : tMin;
+        tMax = far < tMax ? far : tMax;
+
+        t1 = (minimum.Z - originZ) * inverseZ;
+        t2 = (maximum.Z - originZ) * inverseZ;
+        near = t1 < t2 ? t1 : t2;
+        far = t1 < t2 ? t2 : t1;
+        tMin = near > tMin ? near : tMin;
+        tMax = far < tMax ? far : tMax;
+
+        tMin = tMin > 0.0f ? tMin : Float{};
+
+        Mask hit = (tMax >= tMin) & (tMin < t);
+        int32_t any = 0;
+
+        for (uint8_t i = 0; i < width; ++i) any |= hit[i];
+
+        return any != 0;
+    }
+#endif
+};
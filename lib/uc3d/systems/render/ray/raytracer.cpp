@@ -1,15 +1,165 @@
 #include "raytracer.hpp"
 
-RGBColor RayTracer::RayTracePixel(Triangle2D** triangles, int numTriangles, Vector2D pixelRay) {
-    /*
-    a
-    */
+BVH RayTracer::bvh;
+RasterTriangle3D* RayTracer::triangles = nullptr;
+IMaterial** RayTracer::materials = nullptr;
+uint32_t RayTracer::triangleCount = 0;
+uint32_t RayTracer::capacity = 0;
+Scene* RayTracer::preparedScene = nullptr;
+float RayTracer::rebuildThreshold = 1.5f;
 
-    return RGBColor();
+RGBColor RayTracer::ShadeHit(const RasterTriangle3D& triangle, IMaterial* material, const Vector3D& position, float u, float v) {
+    if (!material || !material->GetShader()) {
+        return RGBColor(0, 0, 0);
+    }
+
+    // Intersection tests report the weights of the second and third vertex
+    float w = 1.0f - u - v;
+    Vector3D uvw(w, u, v);
+
+    if (triangle.hasUV) {
+        Vector2D uv = (*triangle.uv1 * w) + (*triangle.uv2 * u) + (*triangle.uv3 * v);
+
+        uvw = Vector3D(uv.X, uv.Y, 0.0f);
+    }
+
+    SurfaceProperties surface{ position, triangle.normal, uvw };
+
+    return material->GetShader()->Shade(surface, *material);
+}
+
+void RayTracer::Prepare(Scene* scene) {
+    if (!scene) {
+        return;
+    }
+
+    // 1. Calculate total number of triangles, growing the persistent arrays if needed
+    uint32_t totalTriangles = scene->GetTotalTriangleCount();
+    bool rebuild = scene != preparedScene || totalTriangles != triangleCount;
+
+    if (totalTriangles > capacity) {
+        delete[] triangles;
+        delete[] materials;
+
+        capacity = totalTriangles;
+        triangles = new RasterTriangle3D[capacity];
+        materials = new IMaterial*[capacity];
+        rebuild = true;
+    }
+
+    uint32_t tri_idx = 0;
+
+    // 2. Gather all visible triangles with their materials, recomputing edges and normals
+    for (uint8_t i = 0; i < scene->GetMeshCount(); ++i) {
+        Mesh* mesh = scene->GetMeshes()[i];
+        if (!mesh || !mesh->IsEnabled()) continue;
+
+        ITriangleGroup* triangleGroup = mesh->GetTriangleGroup();
+        if (!triangleGroup) continue;
+
+        for (uint16_t j = 0; j < triangleGroup->GetTriangleCount() && tri_idx < totalTriangles; ++j) {
+            // Triangle3D holds copies of the original vertices, deformers and transforms write the vertex array
+            const Vector3D* vertices = triangleGroup->GetVertices();
+            const IndexGroup& face = triangleGroup->GetIndexGroup()[j];
+
+            // Same vertex storage in the same order means the tree structure is still valid
+            if (triangles[tri_idx].p1 != &vertices[face.A]) rebuild = true;
+
+            triangles[tri_idx] = mesh->HasUV() ?
+                RasterTriangle3D(&vertices[face.A], &vertices[face.B], &vertices[face.C],
+                    &mesh->GetUVVertices()[mesh->GetUVIndexGroup()[j].A],
+                    &mesh->GetUVVertices()[mesh->GetUVIndexGroup()[j].B],
+                    &mesh->GetUVVertices()[mesh->GetUVIndexGroup()[j].C]) :
+                RasterTriangle3D(&vertices[face.A], &vertices[face.B], &vertices[face.C]);
+            materials[tri_idx] = mesh->GetMaterial();
+            tri_idx++;
+        }
+    }
+
+    triangleCount = tri_idx;
+    preparedScene = scene;
+
+    // 3. Index the triangles, refitting while the tree quality holds up
+    if (!rebuild) {
+        bvh.Refit();
+
+        rebuild = bvh.GetDegradation() > rebuildThreshold;
+    }
+
+    if (rebuild) {
+        bvh.Build(triangles, triangleCount);
+    }
+}
+
+void RayTracer::SetRebuildThreshold(float threshold) {
+    rebuildThreshold = threshold;
 }
 
 void RayTracer::RayTrace(Scene* scene, CameraBase* camera) {
-    /*
-    a
-    */
+    if (!scene || !camera || camera->Is2D()) {
+        return;
+    }
+
+    if (scene != preparedScene) {
+        Prepare(scene);
+    }
+
+    if (triangleCount == 0) {
+        return; // No triangles to render
+    }
+
+    // --- Setup, sharing the cached projection with the rasterizer ---
+    const CameraProjection& projection = camera->GetProjection();
+    Vector3D direction = projection.GetDirection();
+
+    // Start rays behind all geometry so surfaces behind the camera plane are still seen, like the rasterizer
+    Vector3D backOffset;
+
+    if (bvh.GetNodeCount() > 0) {
+        const BVH::Node& root = bvh.GetNodes()[0];
+        Vector3D center = (root.minimum + root.maximum) / 2.0f;
+        float reach = projection.GetPosition().CalculateEuclideanDistance(center) + root.minimum.CalculateEuclideanDistance(root.maximum) / 2.0f;
+
+        backOffset = direction * -(reach + 1.0f);
+    }
+
+    // 2. Trace consecutive pixels as packets, their rays visit the same nodes and triangles
+    IPixelGroup* pixelGroup = camera->GetPixelGroup();
+    PixelCoordinates coordinates = pixelGroup->GetCoordinates();
+    RGBColor* colors = pixelGroup->GetColors();
+    RayPacket<kPacketWidth> packet;
+
+    for (uint16_t start = 0; start < coordinates.GetPixelCount(); start += kPacketWidth) {
+        uint8_t count = uint8_t(Mathematics::Min<uint16_t>(kPacketWidth, coordinates.GetPixelCount() - start));
+
+        for (uint8_t lane = 0; lane < kPacketWidth; ++lane) {
+            if (lane < count) {
+                Vector2D pixel_coord = coordinates[start + lane];
+
+                packet.SetRay(lane, projection.GetRayOrigin(pixel_coord) + backOffset, direction);
+            }
+            else {
+                packet.ClearRay(lane);
+            }
+        }
+
+        bvh.IntersectPacket(packet);
+
+        for (uint8_t lane = 0; lane < count; ++lane) {
+            uint32_t hit = packet.triangle[lane];
+
+            if (hit == RayPacket<kPacketWidth>::kNoHit) {
+                colors[start + lane] = RGBColor(0, 0, 0); // No intersection, return black
+                continue;
+            }
+
+            Vector3D position(
+                packet.originX[lane] + packet.directionX[lane] * packet.t[lane],
+                packet.originY[lane] + packet.directionY[lane] * packet.t[lane],
+                packet.originZ[lane] + packet.directionZ[lane] * packet.t[lane]
+            );
+
+            colors[start + lane] = ShadeHit(triangles[hit], materials[hit], position, packet.u[lane], packet.v[lane]);
+        }
+    }
 }
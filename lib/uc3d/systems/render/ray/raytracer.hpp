@@ -2,7 +2,9 @@
  * @file RayTracer.h
  * @brief Provides functionality for ray tracing 3D scenes into 2D camera views.
  *
- * The RayTracer class handles rendering a 3D scene by ...
+ * The RayTracer class handles rendering a 3D scene by casting one ray per pixel along
+ * the camera's view direction and shading the closest triangle it hits. Triangles are
+ * indexed by a bounding volume hierarchy so each ray only tests nearby triangles.
  *
  * @date 22/12/2024
  * @version 1.0
@@ -13,31 +15,77 @@
 
 #include "../../../core/math/transform.hpp"
 #include "../../../core/math/quaternion.hpp"
-#include "../core/camera.hpp"
+#include "../core/camerabase.hpp"
 #include "../../scene/scene.hpp"
-#include "../../../core/geometry/2d/triangle.hpp"
-#include "../../../core/geometry/spatial/quadtree.hpp"
+#include "../raster/helpers/rastertriangle3d.hpp"
+#include "bvh.hpp"
 
 /**
  * @class RayTracer
  * @brief Provides static methods for ray tracing 3D scenes into 2D camera views.
+ *
+ * Rays use the same projection as the Rasterizer: pixel coordinates lie in the camera
+ * plane, scaled and rotated by the camera transform, and every ray travels along the
+ * camera's depth axis. The camera basis comes from the camera's cached projection, so
+ * building the ray of a pixel costs two multiply-adds. Rays of consecutive pixels are traced together
+ * as a packet, 8 wide when AVX is available and 4 wide otherwise.
+ *
+ * The gathered triangles and their hierarchy persist between frames. Prepare should be
+ * called once per frame before tracing: when the scene still holds the same triangles,
+ * only vertex positions are refreshed and the hierarchy is refitted, and a full rebuild
+ * happens when the refitted tree degrades past the rebuild threshold.
  */
 class RayTracer {
 private:
-    static Quaternion rayDirection; ///< Direction of the ray cast for ray tracation.
+#if defined(__AVX__)
+    static constexpr uint8_t kPacketWidth = 8; ///< Rays traced together, matching 8-wide vector registers.
+#else
+    static constexpr uint8_t kPacketWidth = 4; ///< Rays traced together, matching 4-wide vector registers.
+#endif
+
+    static BVH bvh; ///< Hierarchy over the prepared triangles.
+    static RasterTriangle3D* triangles; ///< Triangles gathered from the prepared scene.
+    static IMaterial** materials; ///< Material of each gathered triangle.
+    static uint32_t triangleCount; ///< Number of gathered triangles.
+    static uint32_t capacity; ///< Allocated size of the triangle and material arrays.
+    static Scene* preparedScene; ///< Scene the triangles were gathered from.
+    static float rebuildThreshold; ///< Degradation of a refitted hierarchy that triggers a rebuild.
 
     /**
-     * @brief Determines the color of a pixel by checking which triangle it intersects.
-     * @param triangles Array of 2D triangles to check against.
-     * @param numTriangles Number of triangles in the array.
-     * @param pixelRay The 2D pixel ray to test.
-     * @return The color of the intersected triangle, or a default color if no intersection.
+     * @brief Shades the surface point where a ray hit a triangle.
+     * @param triangle Triangle that was hit.
+     * @param material Material of the triangle.
+     * @param position Position of the hit.
+     * @param u Barycentric weight of the second vertex.
+     * @param v Barycentric weight of the third vertex.
+     * @return The shaded color, or black if the triangle has no shader.
      */
-    static RGBColor RayTracePixel(Triangle2D** triangles, int numTriangles, Vector2D pixelRay);
+    static RGBColor ShadeHit(const RasterTriangle3D& triangle, IMaterial* material, const Vector3D& position, float u, float v);
 
 public:
+    /**
+     * @brief Gathers the scene triangles and builds or refits the hierarchy over them.
+     *
+     * Refits when every triangle still points at the same vertices as the previous call,
+     * which holds for blendshapes and deformers that move vertices in place. Rebuilds when
+     * meshes are added, removed, enabled or disabled, or the refit degraded the hierarchy.
+     *
+     * @param scene Pointer to the 3D scene to prepare.
+     */
+    static void Prepare(Scene* scene);
+
+    /**
+     * @brief Sets the degradation at which a refitted hierarchy is rebuilt.
+     *
+     * @param threshold Ratio of the refitted to the freshly built traversal cost (default: 1.5).
+     */
+    static void SetRebuildThreshold(float threshold);
+
     /**
      * @brief Ray traces a 3D scene onto a 2D camera view.
+     *
+     * Prepares the scene first if it is not the scene of the last Prepare call.
+     *
      * @param scene Pointer to the 3D scene to render.
      * @param camera Pointer to the camera used for projection.
      */
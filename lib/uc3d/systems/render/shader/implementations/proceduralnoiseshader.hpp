@@ -21,7 +21,12 @@ struct ProceduralNoiseParams {
 };
 
 // Shader  ---------------------------------------------------------------------
+// Shade only reads the material and the shared noise tables, so one shader can
+// shade pixels on several threads at once.
 class ProceduralNoiseShader final : public IShader{
+    // Permutation tables are built once with the shader singleton rather than per sample
+    SimplexNoise noise{/*seed*/4};
+
 public:
     RGBColor Shade(const SurfaceProperties& sp,
                    const IMaterial&         m) const override {
@@ -36,14 +41,16 @@ public:
         for (std::size_t i = 0; i < ProceduralNoiseParams::kColors; ++i)
             shifted[i] = mat.spectrum[i].HueShift(mat.hueShiftAngleDeg);
 
-        GradientColor<ProceduralNoiseParams::kColors> gradient(*shifted, mat.gradientPeriod, false);
+        GradientColor<ProceduralNoiseParams::kColors> gradient(shifted, false);
 
         // --- simplex noise ---------------------------------------------------
-        SimplexNoise noise{/*octaves*/4};
-        noise.SetScale(mat.noiseScale);
-        noise.SetZPosition(mat.simplexDepth);
+        float n = noise.Noise(sp.position.X * mat.noiseScale.X,
+                              sp.position.Y * mat.noiseScale.Y,
+                              mat.simplexDepth);  // -1‥1
+
+        float ratio = (n + 1.0f) * 0.5f / mat.gradientPeriod;
+        ratio -= Mathematics::FFloor(ratio);          // repeat the ramp
 
-        float n = noise.Get(sp.position);             // 0‥1
-        return gradient.Evaluate(n);                  // sample ramp
+        return gradient.GetColorAt(ratio);            // sample ramp
     }
 };
@@ -91,6 +91,8 @@ void MeshAlign::NormalizeObjectPlane(Mesh** objs, uint8_t numObjects, Vector3D c
 
             objs[i]->GetTriangleGroup()->GetVertices()[j] = modifiedVector;
         }
+
+        objs[i]->GetTriangleGroup()->MarkChanged();
     }
 }
 
@@ -103,6 +105,8 @@ void MeshAlign::NormalizeObjectCenter(Mesh** objs, uint8_t numObjects, Vector3D
 
             objs[i]->GetTriangleGroup()->GetVertices()[j] = modifiedVector;
         }
+
+        objs[i]->GetTriangleGroup()->MarkChanged();
     }
 }
 
@@ -390,6 +394,8 @@ void MeshAlign::AlignObjectsNoScale(Mesh** objs, uint8_t numObjects) {
             modifiedVector = modifiedVector + cameraTarget;
             objs[i]->GetTriangleGroup()->GetVertices()[j] = modifiedVector;
         }
+
+        objs[i]->GetTriangleGroup()->MarkChanged();
     }
 }
 
@@ -484,5 +490,7 @@ void MeshAlign::AlignObjects(Mesh** objs, uint8_t numObjects) {
 
             objs[i]->GetTriangleGroup()->GetVertices()[j] = modifiedVector;
         }
+
+        objs[i]->GetTriangleGroup()->MarkChanged();
     }
 }
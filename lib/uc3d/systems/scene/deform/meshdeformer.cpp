@@ -57,6 +57,8 @@ void MeshDeformer::PerspectiveDeform(float scaleRatio, Vector3D center, Axis axi
                     break;
             }
         }
+
+        objects[i]->GetTriangleGroup()->MarkChanged();
     }
 }
 
@@ -79,6 +81,8 @@ void MeshDeformer::SinusoidalDeform(float magnitude, float timeRatio, float peri
                     break;
             }
         }
+
+        objects[i]->GetTriangleGroup()->MarkChanged();
     }
 }
 
@@ -101,6 +105,8 @@ void MeshDeformer::DropwaveDeform(float magnitude, float timeRatio, float period
                     break;
             }
         }
+
+        objects[i]->GetTriangleGroup()->MarkChanged();
     }
 }
 
@@ -123,6 +129,8 @@ void MeshDeformer::SineWaveSurfaceDeform(Vector3D offset, float magnitude, float
                     break;
             }
         }
+
+        objects[i]->GetTriangleGroup()->MarkChanged();
     }
 }
 
@@ -183,6 +191,8 @@ void MeshDeformer::CosineInterpolationDeformer(float* pointMultiplier, int point
                 break;
             }
         }
+
+        objects[i]->GetTriangleGroup()->MarkChanged();
     }
 }
 
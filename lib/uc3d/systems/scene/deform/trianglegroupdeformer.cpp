@@ -50,6 +50,8 @@ void TriangleGroupDeformer::SinusoidalDeform(float magnitude, float timeRatio, f
                     break;
             }
         }
+
+        objects[i]->MarkChanged();
     }
 }
 
@@ -72,6 +74,8 @@ void TriangleGroupDeformer::DropwaveDeform(float magnitude, float timeRatio, flo
                     break;
             }
         }
+
+        objects[i]->MarkChanged();
     }
 }
 
@@ -94,6 +98,8 @@ void TriangleGroupDeformer::SineWaveSurfaceDeform(Vector3D offset, float magnitu
                     break;
             }
         }
+
+        objects[i]->MarkChanged();
     }
 }
 
@@ -150,6 +156,8 @@ void TriangleGroupDeformer::CosineInterpolationDeformer(float* pointMultiplier,
                     break;
             }
         }
+
+        objects[i]->MarkChanged();
     }
 }
 
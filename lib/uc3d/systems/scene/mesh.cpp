@@ -68,9 +68,16 @@ void Mesh::ResetVertices() {
     for (int i = 0; i < modifiedTriangles->GetVertexCount(); i++) {
         modifiedTriangles->GetVertices()[i] = originalTriangles->GetVertices()[i];
     }
+
+    modifiedTriangles->MarkChanged();
+    resetVersion = modifiedTriangles->GetVersion();
 }
 
 void Mesh::UpdateTransform() {
+    // Starting from the original vertices with the transform of the last update ends on the same vertices
+    bool original = modifiedTriangles->GetVersion() == resetVersion;
+    bool repeated = original && transformedOriginal && transformVersion == transform.GetVersion();
+
     for (int i = 0; i < modifiedTriangles->GetVertexCount(); i++) {
         Vector3D modifiedVector = modifiedTriangles->GetVertices()[i];
 
@@ -80,6 +87,12 @@ void Mesh::UpdateTransform() {
 
         modifiedTriangles->GetVertices()[i] = modifiedVector;
     }
+
+    modifiedTriangles->MarkChanged();
+    UpdateVersion(!repeated);
+
+    transformedOriginal = original;
+    transformVersion = transform.GetVersion();
 }
 
 ITriangleGroup* Mesh::GetTriangleGroup() {
@@ -91,5 +104,21 @@ IMaterial* Mesh::GetMaterial() {
 }
 
 void Mesh::SetMaterial(IMaterial* material) {
+    if (material != this->material) UpdateVersion(true);
+
     this->material = material;
 }
+
+uint32_t Mesh::GetVersion() const {
+    // Writes since the last UpdateTransform, by deformers or directly, count as changes of their own
+    return version + (modifiedTriangles->GetVersion() - groupVersion);
+}
+
+void Mesh::UpdateVersion(bool changed) {
+    issuedVersion = Mathematics::Max(issuedVersion, GetVersion());
+
+    // A new state takes a version never reported before, an unchanged one keeps its old version
+    if (changed) version = ++issuedVersion;
+
+    groupVersion = modifiedTriangles->GetVersion();
+}
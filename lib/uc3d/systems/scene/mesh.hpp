@@ -32,6 +32,19 @@ private:
     ITriangleGroup* modifiedTriangles;       ///< Pointer to the modifiable representation of the object's geometry.
     IMaterial* material;                      ///< Pointer to the material assigned to the object.
     bool enabled = true;                     ///< Indicates whether the object is currently enabled.
+    uint32_t version = 0;                    ///< Version reported while the vertices are as UpdateTransform left them.
+    uint32_t issuedVersion = 0;              ///< Highest version GetVersion may have reported.
+    uint32_t groupVersion = 0;               ///< Triangle group version after the last update of the mesh version.
+    uint32_t resetVersion = 0;               ///< Triangle group version right after the last ResetVertices.
+    uint32_t transformVersion = 0;           ///< Transform version applied by the last UpdateTransform.
+    bool transformedOriginal = false;        ///< Set if the last UpdateTransform started from the original vertices.
+
+    /**
+     * @brief Folds the writes to the triangle group since the last call into the mesh version.
+     *
+     * @param changed True if the vertices or the material differ from the last reported state.
+     */
+    void UpdateVersion(bool changed);
 
 public:
     /**
@@ -143,4 +156,18 @@ public:
      * @param material Pointer to the new `Material` to be assigned.
      */
     void SetMaterial(IMaterial* material);
+
+    /**
+     * @brief Retrieves a version that changes whenever the triangles of the mesh may differ.
+     *
+     * The vertices are tracked through the version of the triangle group, which deformers
+     * bump with ITriangleGroup::MarkChanged, and changing the material pointer counts as well.
+     * Resetting the vertices and applying the same transform as the last frame reproduces the
+     * same vertices, so that keeps the version. Code writing vertices directly must call
+     * MarkChanged on the triangle group. The state of the material is versioned on its own,
+     * see IMaterial::GetVersion.
+     *
+     * @return The current version.
+     */
+    uint32_t GetVersion() const;
 };
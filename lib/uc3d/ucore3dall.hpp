@@ -6,6 +6,7 @@
 
 #include "app/app.hpp"
 #include "app/project/project.hpp"
+#include "app/project/qualitycontroller.hpp"
 #include "assets/font/characters.hpp"
 #include "assets/image/image.hpp"
 #include "assets/image/imagesequence.hpp"
@@ -39,16 +40,20 @@
 #include "core/math/eulerangles.hpp"
 #include "core/math/eulerconstants.hpp"
 #include "core/math/eulerorder.hpp"
+#include "core/math/fixedpoint.hpp"
 #include "core/math/mathematics.hpp"
 #include "core/math/quaternion.hpp"
 #include "core/math/rotation.hpp"
 #include "core/math/rotationmatrix.hpp"
+#include "core/math/scalarmath.hpp"
 #include "core/math/transform.hpp"
 #include "core/math/vector2d.hpp"
 #include "core/math/vector3d.hpp"
 #include "core/math/yawpitchroll.hpp"
 #include "core/platform/console.hpp"
+#include "core/platform/flash.hpp"
 #include "core/platform/random.hpp"
+#include "core/platform/threadpool.hpp"
 #include "core/platform/time.hpp"
 #include "core/platform/ustring.hpp"
 #include "core/signal/fft.hpp"
@@ -69,6 +74,8 @@
 #include "core/time/timestep.hpp"
 #include "core/time/wait.hpp"
 #include "core/utils/casthelper.hpp"
+#include "systems/output/idisplaydriver.hpp"
+#include "systems/output/sharedmemorydisplay.hpp"
 #include "systems/physics/boundarymotionsimulator.hpp"
 #include "systems/physics/physicssimulator.hpp"
 #include "systems/physics/vectorfield2d.hpp"
@@ -76,9 +83,15 @@
 #include "systems/render/core/camerabase.hpp"
 #include "systems/render/core/cameralayout.hpp"
 #include "systems/render/core/cameramanager.hpp"
+#include "systems/render/core/cameraprojection.hpp"
+#include "systems/render/core/framehistory.hpp"
 #include "systems/render/core/ipixelgroup.hpp"
 #include "systems/render/core/pixel.hpp"
+#include "systems/render/core/pixelcoordinates.hpp"
+#include "systems/render/core/layoutpixelgroup.hpp"
 #include "systems/render/core/pixelgroup.hpp"
+#include "systems/render/core/pixellayout.hpp"
+#include "systems/render/core/resolutionscaler.hpp"
 #include "systems/render/engine/renderer.hpp"
 #include "systems/render/material/animatedmaterial.hpp"
 #include "systems/render/material/combinematerial.hpp"
@@ -90,11 +103,17 @@
 #include "systems/render/material/materialanimator.hpp"
 #include "systems/render/material/materialmask.hpp"
 #include "systems/render/material/materialt.hpp"
+#include "systems/render/post/boxblur.hpp"
 #include "systems/render/post/compositor.hpp"
 #include "systems/render/post/effect.hpp"
+#include "systems/render/post/remaptable.hpp"
 #include "systems/render/raster/helpers/rastertriangle2d.hpp"
 #include "systems/render/raster/helpers/rastertriangle3d.hpp"
+#include "systems/render/raster/helpers/trianglecache.hpp"
+#include "systems/render/raster/helpers/rasterscratch.hpp"
 #include "systems/render/raster/rasterizer.hpp"
+#include "systems/render/ray/bvh.hpp"
+#include "systems/render/ray/raypacket.hpp"
 #include "systems/render/ray/raytracer.hpp"
 #include "systems/render/shader/implementations/gradientshader.hpp"
 #include "systems/render/shader/implementations/normalshader.hpp"
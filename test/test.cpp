@@ -1,8 +1,21 @@
 #include <unity.h>
+#include "testblur.hpp"
+#include "testbvh.hpp"
+#include "testcameraprojection.hpp"
+#include "testfixedpoint.hpp"
+#include "testfixedraster.hpp"
 #include "testmathematics.hpp"
+#include "testpixelgroup.hpp"
+#include "testqualitycontroller.hpp"
 #include "testquaternion.hpp"
+#include "testrasterizer.hpp"
+#include "testremaptable.hpp"
+#include "testresolutionscaler.hpp"
 #include "testrotation.hpp"
 #include "testrotationmatrix.hpp"
+#include "testscalarmath.hpp"
+#include "testsharedmemorydisplay.hpp"
+#include "testthreadpool.hpp"
 #include "testvector2d.hpp"
 #include "testvector3d.hpp"
 
@@ -13,10 +26,23 @@ void tearDown() {}
 int main(int argc, char **argv) {
     UNITY_BEGIN();
 
+    TestBlur::RunAllTests();
+    TestBVH::RunAllTests();
+    TestCameraProjection::RunAllTests();
+    TestFixedPoint::RunAllTests();
+    TestFixedRaster::RunAllTests();
     TestMathematics::RunAllTests();
+    TestPixelGroup::RunAllTests();
+    TestQualityController::RunAllTests();
     TestQuaternion::RunAllTests();
+    TestRasterizer::RunAllTests();
+    TestRemapTable::RunAllTests();
+    TestResolutionScaler::RunAllTests();
     TestRotation::RunAllTests();
     TestRotationMatrix::RunAllTests();
+    TestScalarMath::RunAllTests();
+    TestSharedMemoryDisplay::RunAllTests();
+    TestThreadPool::RunAllTests();
     TestVector2D::RunAllTests();
     TestVector3D::RunAllTests();
 
@@ -0,0 +1,35 @@
+#include "testblur.hpp"
+
+void TestBlur::TestHorizontalRows() {
+    // Four pixels per row and three rows, so row ends do not line up with column ends
+    static PixelGroup<12> pixelGroup(Vector2D(4.0f, 3.0f), Vector2D(0.0f, 0.0f), 4);
+    HorizontalBlur blur(4);
+    RGBColor* colors = pixelGroup.GetColors();
+
+    for (uint16_t i = 0; i < 12; i++) colors[i] = i < 4 ? RGBColor(255, 255, 255) : RGBColor(0, 0, 0);
+
+    blur.ApplyEffect(&pixelGroup);
+
+    for (uint16_t i = 0; i < 12; i++) {
+        TEST_ASSERT_EQUAL(i < 4 ? 255 : 0, colors[i].R);
+    }
+}
+
+void TestBlur::TestVerticalColumns() {
+    static PixelGroup<12> pixelGroup(Vector2D(4.0f, 3.0f), Vector2D(0.0f, 0.0f), 4);
+    VerticalBlur blur(4);
+    RGBColor* colors = pixelGroup.GetColors();
+
+    for (uint16_t i = 0; i < 12; i++) colors[i] = i % 4 == 0 ? RGBColor(255, 255, 255) : RGBColor(0, 0, 0);
+
+    blur.ApplyEffect(&pixelGroup);
+
+    for (uint16_t i = 0; i < 12; i++) {
+        TEST_ASSERT_EQUAL(i % 4 == 0 ? 255 : 0, colors[i].G);
+    }
+}
+
+void TestBlur::RunAllTests() {
+    RUN_TEST(TestHorizontalRows);
+    RUN_TEST(TestVerticalColumns);
+}
@@ -0,0 +1,33 @@
+/**
+ * @file TestBlur.h
+ * @brief Provides unit tests for the HorizontalBlur and VerticalBlur effects.
+ *
+ * The `TestBlur` class contains static methods checking that the running-sum blurs stay
+ * within the rows and columns of rectangular pixel groups.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <unity.h>
+#include "../lib/uc3d/systems/render/core/pixelgroup.hpp"
+#include "../lib/uc3d/systems/render/post/effects/HorizontalBlur.h"
+#include "../lib/uc3d/systems/render/post/effects/VerticalBlur.h"
+
+/**
+ * @class TestBlur
+ * @brief Contains static test methods for the blur effects.
+ */
+class TestBlur {
+public:
+    static void TestHorizontalRows(); ///< Tests that a lit row does not bleed into the next row.
+    static void TestVerticalColumns(); ///< Tests that a lit column does not bleed into the next column.
+
+    /**
+     * @brief Runs all the test methods in the class.
+     */
+    static void RunAllTests();
+};
@@ -0,0 +1,306 @@
+#include "testbvh.hpp"
+
+float TestBVH::Hash(float seed) {
+    float value = sinf(seed * 12.9898f) * 43758.5453f;
+
+    return (value - floorf(value)) * 2.0f - 1.0f;
+}
+
+RasterTriangle3D* TestBVH::GenerateTriangles() {
+    static Vector3D vertices[600];
+    static RasterTriangle3D triangles[200];
+
+    for (uint16_t i = 0; i < 200; i++) {
+        Vector3D center(Hash(i) * 50.0f, Hash(i + 0.31f) * 50.0f, Hash(i + 0.57f) * 50.0f);
+
+        for (uint8_t k = 0; k < 3; k++) {
+            float seed = float(i * 3 + k) + 0.11f;
+
+            vertices[i * 3 + k] = center + Vector3D(Hash(seed) * 6.0f, Hash(seed + 0.7f) * 6.0f, Hash(seed + 0.9f) * 6.0f);
+        }
+
+        triangles[i] = RasterTriangle3D(&vertices[i * 3], &vertices[i * 3 + 1], &vertices[i * 3 + 2]);
+    }
+
+    return triangles;
+}
+
+void TestBVH::TestEmpty() {
+    BVH bvh;
+    BVH::Hit hit;
+    hit.t = Mathematics::FLTMAX;
+
+    bvh.Build(nullptr, 0);
+
+    TEST_ASSERT_EQUAL(0, bvh.GetNodeCount());
+    TEST_ASSERT_FALSE(bvh.Intersect(Vector3D(0, 0, -10), Vector3D(0, 0, 1), hit));
+}
+
+void TestBVH::TestMatchesBruteForce() {
+    RasterTriangle3D* triangles = GenerateTriangles();
+
+    BVH bvh;
+    bvh.Build(triangles, 200);
+
+    TEST_ASSERT_TRUE(bvh.GetNodeCount() > 1);
+
+    uint16_t hits = 0;
+
+    for (uint16_t r = 0; r < 500; r++) {
+        Vector3D origin(Hash(r + 0.23f) * 40.0f, Hash(r + 0.41f) * 40.0f, -100.0f);
+        Vector3D direction = Vector3D(Hash(r + 0.61f) * 0.3f, Hash(r + 0.83f) * 0.3f, 1.0f).UnitSphere();
+
+        float closest = Mathematics::FLTMAX;
+        int32_t closestIndex = -1;
+
+        for (uint16_t i = 0; i < 200; i++) {
+            float t, u, v;
+
+            if (triangles[i].IntersectsRay(origin, direction, t, u, v) && t < closest) {
+                closest = t;
+                closestIndex = i;
+            }
+        }
+
+        BVH::Hit hit;
+        hit.t = Mathematics::FLTMAX;
+
+        bool found = bvh.Intersect(origin, direction, hit);
+
+        TEST_ASSERT_EQUAL(closestIndex >= 0, found);
+
+        if (found) {
+            TEST_ASSERT_EQUAL(closestIndex, hit.triangle);
+            TEST_ASSERT_EQUAL_FLOAT(closest, hit.t);
+            hits++;
+        }
+    }
+
+    TEST_ASSERT_TRUE(hits > 50);
+}
+
+void TestBVH::TestStackedTriangles() {
+    static Vector3D vertices[30];
+    static RasterTriangle3D triangles[10];
+
+    // Identical triangles at decreasing depth, the last one is the closest
+    for (uint8_t i = 0; i < 10; i++) {
+        float z = 10.0f - float(i);
+
+        vertices[i * 3] = Vector3D(-5, -5, z);
+        vertices[i * 3 + 1] = Vector3D(5, -5, z);
+        vertices[i * 3 + 2] = Vector3D(0, 5, z);
+        triangles[i] = RasterTriangle3D(&vertices[i * 3], &vertices[i * 3 + 1], &vertices[i * 3 + 2]);
+    }
+
+    BVH bvh;
+    BVH::Hit hit;
+    hit.t = Mathematics::FLTMAX;
+
+    bvh.Build(triangles, 10);
+
+    TEST_ASSERT_TRUE(bvh.Intersect(Vector3D(0, 0, -10), Vector3D(0, 0, 1), hit));
+    TEST_ASSERT_EQUAL(9, hit.triangle);
+    TEST_ASSERT_EQUAL_FLOAT(11.0f, hit.t);
+}
+
+void TestBVH::TestMaxDistance() {
+    Vector3D vertices[3] = { Vector3D(-1, -1, 5), Vector3D(1, -1, 5), Vector3D(0, 1, 5) };
+    RasterTriangle3D triangle(&vertices[0], &vertices[1], &vertices[2]);
+
+    BVH bvh;
+    BVH::Hit hit;
+    hit.t = 4.0f;
+
+    bvh.Build(&triangle, 1);
+
+    TEST_ASSERT_FALSE(bvh.Intersect(Vector3D(0, 0, 0), Vector3D(0, 0, 1), hit));
+
+    hit.t = 6.0f;
+
+    TEST_ASSERT_TRUE(bvh.Intersect(Vector3D(0, 0, 0), Vector3D(0, 0, 1), hit));
+    TEST_ASSERT_EQUAL_FLOAT(5.0f, hit.t);
+}
+
+void TestBVH::TestRefit() {
+    static Vector3D vertices[300];
+    static RasterTriangle3D triangles[100];
+
+    for (uint16_t i = 0; i < 100; i++) {
+        Vector3D center(Hash(i) * 20.0f, Hash(i + 0.31f) * 20.0f, 0.0f);
+
+        vertices[i * 3] = center + Vector3D(-1, -1, 0);
+        vertices[i * 3 + 1] = center + Vector3D(1, -1, 0);
+        vertices[i * 3 + 2] = center + Vector3D(0, 1, 0);
+        triangles[i] = RasterTriangle3D(&vertices[i * 3], &vertices[i * 3 + 1], &vertices[i * 3 + 2]);
+    }
+
+    BVH bvh;
+    bvh.Build(triangles, 100);
+
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, bvh.GetDegradation());
+
+    // Deform in place: every triangle drifts by its own offset, scattering the original groupings
+    for (uint16_t i = 0; i < 100; i++) {
+        Vector3D offset(Hash(i + 0.13f) * 15.0f, Hash(i + 0.47f) * 15.0f, Hash(i + 0.71f) * 5.0f);
+
+        for (uint8_t k = 0; k < 3; k++) vertices[i * 3 + k] = vertices[i * 3 + k] + offset;
+
+        triangles[i] = RasterTriangle3D(&vertices[i * 3], &vertices[i * 3 + 1], &vertices[i * 3 + 2]);
+    }
+
+    bvh.Refit();
+
+    TEST_ASSERT_TRUE(bvh.GetDegradation() > 1.0f);
+
+    for (uint16_t i = 0; i < 100; i++) {
+        Vector3D center = (vertices[i * 3] + vertices[i * 3 + 1] + vertices[i * 3 + 2]) / 3.0f;
+        Vector3D origin(center.X, center.Y, -100.0f);
+
+        BVH::Hit hit;
+        hit.t = Mathematics::FLTMAX;
+
+        TEST_ASSERT_TRUE(bvh.Intersect(origin, Vector3D(0, 0, 1), hit));
+        TEST_ASSERT_TRUE(hit.t <= center.Z + 100.0f + 0.001f);
+    }
+}
+
+template<uint8_t width>
+void TestBVH::TestPacketWidth() {
+    RasterTriangle3D* triangles = GenerateTriangles();
+
+    BVH bvh;
+    bvh.Build(triangles, 200);
+
+    RayPacket<width> packet;
+    uint16_t hits = 0;
+
+    // A grid of parallel rays like a camera, the last packet is left partially filled
+    for (uint16_t start = 0; start < 250; start += width) {
+        for (uint8_t lane = 0; lane < width; lane++) {
+            uint16_t r = start + lane;
+
+            if (r < 250) packet.SetRay(lane, Vector3D(float(r % 25) * 3.2f - 40.0f, float(r / 25) * 8.0f - 40.0f, -100.0f), Vector3D(0, 0, 1));
+            else packet.ClearRay(lane);
+        }
+
+        bvh.IntersectPacket(packet);
+
+        for (uint8_t lane = 0; lane < width && start + lane < 250; lane++) {
+            BVH::Hit hit;
+            hit.t = Mathematics::FLTMAX;
+
+            Vector3D origin(packet.originX[lane], packet.originY[lane], packet.originZ[lane]);
+            bool found = bvh.Intersect(origin, Vector3D(0, 0, 1), hit);
+
+            TEST_ASSERT_EQUAL(found, packet.triangle[lane] != RayPacket<width>::kNoHit);
+
+            if (found) {
+                TEST_ASSERT_EQUAL(hit.triangle, packet.triangle[lane]);
+                TEST_ASSERT_EQUAL_FLOAT(hit.t, packet.t[lane]);
+                TEST_ASSERT_FLOAT_WITHIN(0.0001f, hit.u, packet.u[lane]);
+                TEST_ASSERT_FLOAT_WITHIN(0.0001f, hit.v, packet.v[lane]);
+                hits++;
+            }
+        }
+
+        // Cleared lanes never record a hit
+        for (uint8_t lane = 0; lane < width; lane++) {
+            if (start + lane >= 250) TEST_ASSERT_EQUAL(RayPacket<width>::kNoHit, packet.triangle[lane]);
+        }
+    }
+
+    TEST_ASSERT_TRUE(hits > 25);
+}
+
+void TestBVH::TestPacketMatchesSingle() {
+    TestPacketWidth<4>();
+    TestPacketWidth<8>();
+}
+
+void TestBVH::BenchmarkPackets() {
+    RasterTriangle3D* triangles = GenerateTriangles();
+
+    BVH bvh;
+    bvh.Build(triangles, 200);
+
+    // Coherent primary rays of a 128x64 matrix, traced a few times to smooth out timer resolution
+    const uint16_t columns = 128, rows = 64, repeats = 8;
+    uint32_t checksum[3] = {0, 0, 0};
+    uint32_t elapsed[3] = {0, 0, 0};
+
+    uint32_t start = uc3d::Time::Micros();
+
+    for (uint16_t n = 0; n < repeats; n++) {
+        for (uint32_t r = 0; r < uint32_t(columns) * rows; r++) {
+            BVH::Hit hit;
+            hit.t = Mathematics::FLTMAX;
+
+            Vector3D origin(float(r % columns) * 0.8f - 50.0f, float(r / columns) * 1.6f - 50.0f, -100.0f);
+
+            if (bvh.Intersect(origin, Vector3D(0, 0, 1), hit)) checksum[0] += hit.triangle;
+        }
+    }
+
+    elapsed[0] = uc3d::Time::Micros() - start;
+    start = uc3d::Time::Micros();
+
+    for (uint16_t n = 0; n < repeats; n++) {
+        RayPacket<4> packet;
+
+        for (uint32_t r = 0; r < uint32_t(columns) * rows; r += 4) {
+            for (uint8_t lane = 0; lane < 4; lane++) {
+                uint32_t p = r + lane;
+
+                packet.SetRay(lane, Vector3D(float(p % columns) * 0.8f - 50.0f, float(p / columns) * 1.6f - 50.0f, -100.0f), Vector3D(0, 0, 1));
+            }
+
+            bvh.IntersectPacket(packet);
+
+            for (uint8_t lane = 0; lane < 4; lane++) {
+                if (packet.triangle[lane] != RayPacket<4>::kNoHit) checksum[1] += packet.triangle[lane];
+            }
+        }
+    }
+
+    elapsed[1] = uc3d::Time::Micros() - start;
+    start = uc3d::Time::Micros();
+
+    for (uint16_t n = 0; n < repeats; n++) {
+        RayPacket<8> packet;
+
+        for (uint32_t r = 0; r < uint32_t(columns) * rows; r += 8) {
+            for (uint8_t lane = 0; lane < 8; lane++) {
+                uint32_t p = r + lane;
+
+                packet.SetRay(lane, Vector3D(float(p % columns) * 0.8f - 50.0f, float(p / columns) * 1.6f - 50.0f, -100.0f), Vector3D(0, 0, 1));
+            }
+
+            bvh.IntersectPacket(packet);
+
+            for (uint8_t lane = 0; lane < 8; lane++) {
+                if (packet.triangle[lane] != RayPacket<8>::kNoHit) checksum[2] += packet.triangle[lane];
+            }
+        }
+    }
+
+    elapsed[2] = uc3d::Time::Micros() - start;
+
+    char message[96];
+    snprintf(message, sizeof(message), "Rays %u: single %.3f ms, 4-wide %.3f ms, 8-wide %.3f ms",
+        unsigned(columns * rows * repeats), elapsed[0] / 1000.0f, elapsed[1] / 1000.0f, elapsed[2] / 1000.0f);
+    TEST_MESSAGE(message);
+
+    TEST_ASSERT_EQUAL(checksum[0], checksum[1]);
+    TEST_ASSERT_EQUAL(checksum[0], checksum[2]);
+}
+
+void TestBVH::RunAllTests() {
+    RUN_TEST(TestEmpty);
+    RUN_TEST(TestMatchesBruteForce);
+    RUN_TEST(TestStackedTriangles);
+    RUN_TEST(TestMaxDistance);
+    RUN_TEST(TestRefit);
+    RUN_TEST(TestPacketMatchesSingle);
+    RUN_TEST(BenchmarkPackets);
+}
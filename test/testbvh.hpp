@@ -0,0 +1,63 @@
+/**
+ * @file TestBVH.h
+ * @brief Provides unit tests for the BVH class.
+ *
+ * The `TestBVH` class contains static methods for testing that ray queries through the
+ * bounding volume hierarchy return the same closest hits as testing every triangle.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <unity.h>
+#include "../lib/uc3d/core/platform/time.hpp"
+#include "../lib/uc3d/systems/render/ray/bvh.hpp"
+
+/**
+ * @class TestBVH
+ * @brief Contains static test methods for the BVH class.
+ *
+ * This class provides unit tests to ensure the hierarchy finds the closest intersection
+ * for scattered and stacked triangles, handles empty and degenerate inputs, and stays
+ * correct after refitting moved triangles or tracing rays as packets.
+ */
+class TestBVH {
+private:
+    /**
+     * @brief Deterministic pseudo-random value in the range [-1, 1].
+     *
+     * @param seed Input of the hash.
+     * @return The pseudo-random value.
+     */
+    static float Hash(float seed);
+
+    /**
+     * @brief Fills static storage with a scattered set of triangles.
+     *
+     * @return Pointer to 200 triangles.
+     */
+    static RasterTriangle3D* GenerateTriangles();
+
+    /**
+     * @brief Compares packet queries of one width against single-ray queries.
+     */
+    template<uint8_t width>
+    static void TestPacketWidth();
+
+public:
+    static void TestEmpty(); ///< Tests queries against an empty hierarchy.
+    static void TestMatchesBruteForce(); ///< Tests closest hits against testing every triangle.
+    static void TestStackedTriangles(); ///< Tests that the nearest of overlapping triangles is returned.
+    static void TestMaxDistance(); ///< Tests that hits beyond the initial distance are ignored.
+    static void TestRefit(); ///< Tests that refitted bounds still find every hit after vertices move.
+    static void TestPacketMatchesSingle(); ///< Tests that 4- and 8-wide packets return the single-ray hits.
+    static void BenchmarkPackets(); ///< Reports single-ray and packet throughput for coherent rays.
+
+    /**
+     * @brief Runs all the test methods in the class.
+     */
+    static void RunAllTests();
+};
@@ -0,0 +1,115 @@
+#include "testcameraprojection.hpp"
+
+void TestCameraProjection::TestMatchesDirectProjection() {
+    Transform transform(Vector3D(10, 20, 30), Vector3D(1, 2, 3), Vector3D(2, 3, 1));
+    transform.SetBaseRotation(Quaternion(0.7071068f, 0, 0.7071068f, 0));
+    Quaternion lookOffset(0.9238795f, 0.3826834f, 0, 0);
+
+    CameraProjection projection;
+    projection.Update(transform, lookOffset);
+
+    Quaternion lookDirection = transform.GetRotation().Multiply(lookOffset);
+    Quaternion inverseRotation = transform.GetRotation().Multiply(lookDirection).Conjugate();
+    Vector3D point(4, -5, 6);
+    Vector3D expected = inverseRotation.RotateVector(point - transform.GetPosition()) / transform.GetScale();
+    Vector3D projected = projection.Project(point);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, expected.X, projected.X);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, expected.Y, projected.Y);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, expected.Z, projected.Z);
+
+    // A ray origin projects back onto its pixel coordinate
+    Vector3D origin = projection.Project(projection.GetRayOrigin(Vector2D(7, -3)));
+
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 7.0f, origin.X);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, -3.0f, origin.Y);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 0.0f, origin.Z);
+
+    // Rays travel along the depth axis
+    Vector3D step = projection.Project(projection.GetRayOrigin(Vector2D(7, -3)) + projection.GetDirection());
+
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 7.0f, step.X);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, -3.0f, step.Y);
+    TEST_ASSERT_TRUE(step.Z > 0.0f);
+}
+
+void TestCameraProjection::TestTransformVersion() {
+    Transform transform;
+    uint32_t version = transform.GetVersion();
+
+    transform.SetBaseRotation(Quaternion(1, 0, 0, 0));
+    TEST_ASSERT_EQUAL(version, transform.GetVersion());
+
+    transform.SetBaseRotation(Quaternion(0.7071068f, 0, 0.7071068f, 0));
+    TEST_ASSERT_NOT_EQUAL(version, transform.GetVersion());
+    version = transform.GetVersion();
+
+    transform.Translate(Vector3D(1, 0, 0));
+    TEST_ASSERT_NOT_EQUAL(version, transform.GetVersion());
+    version = transform.GetVersion();
+
+    transform.GetPosition();
+    transform.GetRotation();
+    TEST_ASSERT_EQUAL(version, transform.GetVersion());
+}
+
+void TestCameraProjection::TestInvalidation() {
+    static PixelGroup<16> pixelGroup(Vector2D(4, 4), Vector2D(0, 0), 4);
+    CameraLayout layout(CameraLayout::ZForward, CameraLayout::YUp);
+    Transform transform(Vector3D(0, 0, 0), Vector3D(0, 0, -10), Vector3D(1, 1, 1));
+    Camera<16> camera(&transform, &layout, &pixelGroup);
+
+    const CameraProjection& projection = camera.GetProjection();
+    Vector3D position = projection.GetPosition();
+
+    TEST_ASSERT_TRUE(projection.IsCurrent(transform, camera.GetLookOffset()));
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, -10.0f, position.Z);
+
+    transform.SetPosition(Vector3D(0, 0, -20));
+    TEST_ASSERT_FALSE(projection.IsCurrent(transform, camera.GetLookOffset()));
+
+    position = camera.GetProjection().GetPosition();
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, -20.0f, position.Z);
+
+    camera.SetLookOffset(Quaternion(0.9238795f, 0.3826834f, 0, 0));
+    TEST_ASSERT_FALSE(projection.IsCurrent(transform, camera.GetLookOffset()));
+
+    camera.GetProjection();
+    TEST_ASSERT_TRUE(projection.IsCurrent(transform, camera.GetLookOffset()));
+
+    // Assigning a freshly built transform must not leave the old projection cached
+    Transform moved(Vector3D(0, 0, 0), Vector3D(0, 0, -30), Vector3D(1, 1, 1));
+
+    *camera.GetTransform() = moved;
+    TEST_ASSERT_FALSE(projection.IsCurrent(transform, camera.GetLookOffset()));
+
+    position = camera.GetProjection().GetPosition();
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, -30.0f, position.Z);
+}
+
+void TestCameraProjection::TestMatches() {
+    static PixelGroup<16> left(Vector2D(4, 4), Vector2D(0, 0), 4);
+    static PixelGroup<16> right(Vector2D(4, 4), Vector2D(8, 0), 4);
+    CameraLayout layout(CameraLayout::ZForward, CameraLayout::YUp);
+    Transform leftTransform(Vector3D(0, 0, 0), Vector3D(0, 0, -10), Vector3D(1, 1, 1));
+    Transform rightTransform(Vector3D(0, 0, 0), Vector3D(0, 0, -10), Vector3D(1, 1, 1));
+    Camera<16> leftCamera(&leftTransform, &layout, &left);
+    Camera<16> rightCamera(&rightTransform, &layout, &right);
+
+    // Panels differ in pixel coordinates only, so they share one viewpoint
+    TEST_ASSERT_TRUE(leftCamera.GetProjection().Matches(rightCamera.GetProjection()));
+
+    rightTransform.SetPosition(Vector3D(0, 0, -20));
+    TEST_ASSERT_FALSE(leftCamera.GetProjection().Matches(rightCamera.GetProjection()));
+
+    rightTransform.SetPosition(Vector3D(0, 0, -10));
+    rightCamera.SetLookOffset(Quaternion(0.9238795f, 0.3826834f, 0, 0));
+    TEST_ASSERT_FALSE(leftCamera.GetProjection().Matches(rightCamera.GetProjection()));
+}
+
+void TestCameraProjection::RunAllTests() {
+    RUN_TEST(TestMatchesDirectProjection);
+    RUN_TEST(TestTransformVersion);
+    RUN_TEST(TestInvalidation);
+    RUN_TEST(TestMatches);
+}
@@ -0,0 +1,34 @@
+/**
+ * @file TestCameraProjection.h
+ * @brief Provides unit tests for the CameraProjection class.
+ *
+ * The `TestCameraProjection` class contains static methods for testing that cached projection
+ * constants match the per-vertex projection and are refreshed only when the camera changes.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <unity.h>
+#include "../lib/uc3d/systems/render/core/camera.hpp"
+#include "../lib/uc3d/systems/render/core/cameraprojection.hpp"
+
+/**
+ * @class TestCameraProjection
+ * @brief Contains static test methods for the CameraProjection class.
+ */
+class TestCameraProjection {
+public:
+    static void TestMatchesDirectProjection(); ///< Tests projected points and rays against the transform math.
+    static void TestTransformVersion(); ///< Tests that transform changes, and only changes, bump the version.
+    static void TestInvalidation(); ///< Tests that the camera refreshes its cache when the transform or look offset changes.
+    static void TestMatches(); ///< Tests that separate cameras with the same viewpoint have matching projections.
+
+    /**
+     * @brief Runs all the test methods in the class.
+     */
+    static void RunAllTests();
+};
@@ -0,0 +1,45 @@
+#include "testfixedpoint.hpp"
+
+void TestFixedPoint::TestConversion() {
+    TEST_ASSERT_EQUAL(65536, Q16_16(1).GetRaw());
+    TEST_ASSERT_EQUAL(-98304, Q16_16(-1.5f).GetRaw());
+    TEST_ASSERT_EQUAL(256, Q8_8(1).GetRaw());
+    TEST_ASSERT_EQUAL(64, Q8_8(0.25f).GetRaw());
+
+    TEST_ASSERT_EQUAL_FLOAT(3.25f, Q16_16(3.25f).ToFloat());
+    TEST_ASSERT_EQUAL_FLOAT(-7.5f, Q8_8(-7.5f).ToFloat());
+    TEST_ASSERT_FLOAT_WITHIN(1.0f / 65536.0f, 0.1f, Q16_16(0.1f).ToFloat());
+}
+
+void TestFixedPoint::TestSaturation() {
+    TEST_ASSERT_EQUAL(32767, Q8_8(1000.0f).GetRaw());
+    TEST_ASSERT_EQUAL(-32768, Q8_8(-1000.0f).GetRaw());
+    TEST_ASSERT_EQUAL(2147483647, Q16_16(1.0e9f).GetRaw());
+}
+
+void TestFixedPoint::TestArithmetic() {
+    Q16_16 first(2.5f);
+    Q16_16 second(-1.25f);
+
+    TEST_ASSERT_EQUAL_FLOAT(1.25f, (first + second).ToFloat());
+    TEST_ASSERT_EQUAL_FLOAT(3.75f, (first - second).ToFloat());
+    TEST_ASSERT_EQUAL_FLOAT(-3.125f, (first * second).ToFloat());
+    TEST_ASSERT_EQUAL_FLOAT(-2.0f, (first / second).ToFloat());
+    TEST_ASSERT_TRUE(second < first);
+
+    // Products pass through the wide type, so they do not overflow the storage on the way
+    Q8_8 large(10.0f);
+    Q8_8 half(0.5f);
+
+    TEST_ASSERT_EQUAL_FLOAT(5.0f, (large * half).ToFloat());
+    TEST_ASSERT_EQUAL_FLOAT(20.0f, (large / half).ToFloat());
+
+    large *= Q8_8(3);
+    TEST_ASSERT_EQUAL_FLOAT(30.0f, large.ToFloat());
+}
+
+void TestFixedPoint::RunAllTests() {
+    RUN_TEST(TestConversion);
+    RUN_TEST(TestSaturation);
+    RUN_TEST(TestArithmetic);
+}
@@ -0,0 +1,32 @@
+/**
+ * @file TestFixedPoint.h
+ * @brief Provides unit tests for the FixedPoint class template.
+ *
+ * The `TestFixedPoint` class contains static methods for testing conversions, saturation
+ * and arithmetic of the Q16.16 and Q8.8 formats.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <unity.h>
+#include "../lib/uc3d/core/math/fixedpoint.hpp"
+
+/**
+ * @class TestFixedPoint
+ * @brief Contains static test methods for the FixedPoint class template.
+ */
+class TestFixedPoint {
+public:
+    static void TestConversion(); ///< Tests conversions from and to float and integers.
+    static void TestSaturation(); ///< Tests that out-of-range floats clamp to the storage limits.
+    static void TestArithmetic(); ///< Tests sums, products and quotients against float results.
+
+    /**
+     * @brief Runs all the test methods in the class.
+     */
+    static void RunAllTests();
+};
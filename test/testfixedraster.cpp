@@ -0,0 +1,100 @@
+#include "testfixedraster.hpp"
+
+RasterTriangle2D TestFixedRaster::GetTriangle(uint8_t index) {
+    // Counter-clockwise, clockwise, a sliver, one spanning most of the Q8.8 range and one with edges beyond it
+    static const Vector3D vertices[kTriangleCount * 3] = {
+        Vector3D(0.0f, 0.0f, 1.0f), Vector3D(10.0f, 0.0f, 2.0f), Vector3D(0.0f, 10.0f, 3.0f),
+        Vector3D(2.5f, 1.25f, 1.0f), Vector3D(3.75f, 12.5f, 1.0f), Vector3D(14.0f, 6.0f, 1.0f),
+        Vector3D(-20.3f, -5.1f, 1.0f), Vector3D(-12.7f, 9.8f, 4.0f), Vector3D(7.9f, -1.6f, 2.0f),
+        Vector3D(0.0f, 0.0f, 1.0f), Vector3D(30.0f, 1.5f, 1.0f), Vector3D(30.0f, 3.0f, 1.0f),
+        Vector3D(-60.0f, -60.0f, 1.0f), Vector3D(60.0f, -50.0f, 5.0f), Vector3D(0.0f, 60.0f, 9.0f),
+        Vector3D(-100.0f, -100.0f, 1.0f), Vector3D(100.0f, -100.0f, 3.0f), Vector3D(0.0f, 100.0f, 5.0f)
+    };
+
+    Transform transform;
+    CameraProjection projection;
+    projection.Update(transform, Quaternion());
+
+    RasterTriangle3D source(&vertices[index * 3], &vertices[index * 3 + 1], &vertices[index * 3 + 2]);
+
+    return RasterTriangle2D(projection, source, nullptr);
+}
+
+float TestFixedRaster::GetTolerance() {
+    return 8.0f / float(1L << RasterTriangle2D::Fixed::kFractionBits);
+}
+
+void TestFixedRaster::TestCoverage() {
+    float tolerance = GetTolerance();
+
+    for (uint8_t i = 0; i < kTriangleCount; i++) {
+        RasterTriangle2D triangle = GetTriangle(i);
+        Vector2D minimum = triangle.bounds.GetMinimum();
+        Vector2D maximum = triangle.bounds.GetMaximum();
+        uint32_t inside = 0;
+
+        // Off-grid samples over the bounds and a margin around them
+        for (float y = minimum.Y - 1.0f; y <= maximum.Y + 1.0f; y += 0.37f) {
+            for (float x = minimum.X - 1.0f; x <= maximum.X + 1.0f; x += 0.41f) {
+                float u, v, w;
+                triangle.GetBarycentricCoords(x, y, u, v, w);
+
+                float nearest = Mathematics::Min(u, v, w);
+                bool contains = triangle.Contains(RasterTriangle2D::PreparePoint(Vector2D(x, y)));
+
+                // Points within the tolerance of an edge may round either way
+                if (nearest > tolerance) TEST_ASSERT_TRUE(contains);
+                if (nearest < -tolerance) TEST_ASSERT_FALSE(contains);
+
+                if (contains) inside++;
+            }
+        }
+
+        TEST_ASSERT_TRUE(inside > 0);
+    }
+}
+
+void TestFixedRaster::TestWeights() {
+    float tolerance = GetTolerance();
+
+    for (uint8_t i = 0; i < kTriangleCount; i++) {
+        RasterTriangle2D triangle = GetTriangle(i);
+        Vector2D minimum = triangle.bounds.GetMinimum();
+        Vector2D maximum = triangle.bounds.GetMaximum();
+
+        for (float y = minimum.Y; y <= maximum.Y; y += 0.53f) {
+            for (float x = minimum.X; x <= maximum.X; x += 0.61f) {
+                float u, v, w;
+                float fixedU, fixedV, fixedW;
+
+                if (!triangle.GetBarycentricCoords(x, y, u, v, w)) continue;
+                if (!triangle.GetBarycentricCoords(RasterTriangle2D::PreparePoint(Vector2D(x, y)), fixedU, fixedV, fixedW)) continue;
+
+                TEST_ASSERT_FLOAT_WITHIN(tolerance, u, fixedU);
+                TEST_ASSERT_FLOAT_WITHIN(tolerance, v, fixedV);
+                TEST_ASSERT_FLOAT_WITHIN(tolerance, w, fixedW);
+                TEST_ASSERT_FLOAT_WITHIN(tolerance * 10.0f, triangle.GetDepth(u, v, w), triangle.GetDepth(fixedU, fixedV, fixedW));
+            }
+        }
+    }
+}
+
+void TestFixedRaster::TestDegenerate() {
+    static const Vector3D vertices[3] = { Vector3D(0.0f, 0.0f, 1.0f), Vector3D(4.0f, 4.0f, 1.0f), Vector3D(8.0f, 8.0f, 1.0f) };
+
+    Transform transform;
+    CameraProjection projection;
+    projection.Update(transform, Quaternion());
+
+    RasterTriangle2D triangle(projection, RasterTriangle3D(&vertices[0], &vertices[1], &vertices[2]), nullptr);
+    float u, v, w;
+
+    TEST_ASSERT_FALSE(triangle.Contains(RasterTriangle2D::PreparePoint(Vector2D(4.0f, 4.0f))));
+    TEST_ASSERT_FALSE(triangle.GetBarycentricCoords(RasterTriangle2D::PreparePoint(Vector2D(2.0f, 2.0f)), u, v, w));
+}
+
+void TestFixedRaster::RunAllTests() {
+    RUN_TEST(TestCoverage);
+    RUN_TEST(TestWeights);
+    RUN_TEST(TestDegenerate);
+}
@@ -0,0 +1,46 @@
+/**
+ * @file TestFixedRaster.h
+ * @brief Provides unit tests for the fixed-point inside test of RasterTriangle2D.
+ *
+ * The `TestFixedRaster` class contains static methods comparing the coverage and barycentric
+ * weights of prepared points against the float path. The testfixed and testfixedq8_8
+ * environments build them with UC3D_FIXED_RASTER, in the float build both paths are the same.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <unity.h>
+#include "../lib/uc3d/systems/render/raster/helpers/rastertriangle2d.hpp"
+
+/**
+ * @class TestFixedRaster
+ * @brief Contains static test methods for the fixed-point raster path.
+ */
+class TestFixedRaster {
+private:
+    static constexpr uint8_t kTriangleCount = 6; ///< Number of test triangles.
+
+    /**
+     * @brief Projects test triangle `index` with an identity camera.
+     */
+    static RasterTriangle2D GetTriangle(uint8_t index);
+
+    /**
+     * @brief Tolerance of the weights, a few steps of the fixed format.
+     */
+    static float GetTolerance();
+
+public:
+    static void TestCoverage(); ///< Tests that prepared points are inside wherever the float weights clearly are.
+    static void TestWeights(); ///< Tests that the fixed weights match the float weights.
+    static void TestDegenerate(); ///< Tests that collinear vertices cover no point.
+
+    /**
+     * @brief Runs all the test methods in the class.
+     */
+    static void RunAllTests();
+};
@@ -0,0 +1,358 @@
+#include "testpixelgroup.hpp"
+#include <cstdio>
+
+namespace {
+
+constexpr Vector2D kStaggeredLayout[9] = {
+    Vector2D(0.0f, 0.0f), Vector2D(2.0f, 0.3f), Vector2D(4.0f, -0.2f),
+    Vector2D(0.4f, 2.0f), Vector2D(2.2f, 2.1f), Vector2D(4.1f, 1.8f),
+    Vector2D(-0.3f, 4.0f), Vector2D(1.9f, 4.2f), Vector2D(3.8f, 3.9f)
+};
+
+constexpr PixelLayout<9> kStaggeredTables(kStaggeredLayout);
+
+static_assert(kStaggeredTables.GetRight()[0] == 1, "Right neighbor of the first pixel is resolved at compile time");
+static_assert(kStaggeredTables.GetUp()[4] == 7, "Up neighbor of the center pixel is resolved at compile time");
+static_assert(kStaggeredTables.GetLeft()[0] == 65535, "Edge pixels have no neighbor");
+static_assert(!kStaggeredTables.IsRectangular(), "Staggered layouts are not rectangular");
+
+constexpr uint16_t kPanelRow = 32; ///< Pixels in each row of the compile-time panel.
+constexpr uint16_t kPanelCount = 512; ///< Pixels in the compile-time panel.
+
+/**
+ * @brief Staggered 32x16 panel spaced two units apart, generated at compile time.
+ */
+struct StaggeredPanel {
+    Vector2D positions[kPanelCount];
+
+    constexpr StaggeredPanel() : positions() {
+        for (uint16_t i = 0; i < kPanelCount; i++) {
+            float jitter = float(int(i * 7 % 5) - 2) * 0.1f;
+
+            positions[i].X = float(i % kPanelRow) * 2.0f + jitter;
+            positions[i].Y = float(i / kPanelRow) * 2.0f - jitter;
+        }
+    }
+};
+
+constexpr StaggeredPanel kPanel;
+constexpr PixelLayout<kPanelCount> kPanelTables(kPanel.positions);
+
+/**
+ * @brief Checks every neighbor of the panel against its row and column.
+ */
+constexpr bool MatchesPanel(const PixelLayout<kPanelCount>& layout) {
+    for (uint16_t i = 0; i < kPanelCount; i++) {
+        uint16_t x = i % kPanelRow;
+        uint16_t y = i / kPanelRow;
+
+        if (layout.GetRight()[i] != (x + 1 < kPanelRow ? i + 1 : 65535)) return false;
+        if (layout.GetLeft()[i] != (x > 0 ? i - 1 : 65535)) return false;
+        if (layout.GetUp()[i] != (y + 1 < kPanelCount / kPanelRow ? i + kPanelRow : 65535)) return false;
+        if (layout.GetDown()[i] != (y > 0 ? i - kPanelRow : 65535)) return false;
+    }
+
+    return true;
+}
+
+static_assert(MatchesPanel(kPanelTables), "Neighbors of a 512 pixel panel are resolved at compile time");
+static_assert(!kPanelTables.IsRectangular(), "Jittered panels are not rectangular");
+static_assert(sizeof(LayoutPixelGroup<kPanelCount>) + sizeof(PixelLayout<kPanelCount>) <= sizeof(PixelGroup<kPanelCount>),
+              "Groups over a flash layout do not reserve room for the tables");
+
+/**
+ * @brief Reference neighbor search, an exhaustive comparison of every pixel pair.
+ */
+void ExhaustiveGridSort(const Vector2D* layout, uint16_t count, uint16_t* up, uint16_t* down, uint16_t* left, uint16_t* right) {
+    for (uint16_t i = 0; i < count; i++) {
+        float minUp = Mathematics::FLTMAX, minDown = Mathematics::FLTMAX, minLeft = Mathematics::FLTMAX, minRight = Mathematics::FLTMAX;
+
+        up[i] = down[i] = left[i] = right[i] = 65535;
+
+        for (uint16_t j = 0; j < count; j++) {
+            if (i == j) continue;
+
+            float dist = layout[i].CalculateEuclideanDistance(layout[j]);
+
+            if (Mathematics::IsClose(layout[i].X, layout[j].X, 1.0f)) {
+                if (layout[i].Y < layout[j].Y && dist < minUp) { minUp = dist; up[i] = j; }
+                else if (layout[i].Y > layout[j].Y && dist < minDown) { minDown = dist; down[i] = j; }
+            }
+
+            if (Mathematics::IsClose(layout[i].Y, layout[j].Y, 1.0f)) {
+                if (layout[i].X > layout[j].X && dist < minLeft) { minLeft = dist; left[i] = j; }
+                else if (layout[i].X < layout[j].X && dist < minRight) { minRight = dist; right[i] = j; }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Reference radial lookup, stepping one neighbor at a time along the interpolated line.
+ */
+bool WalkRadial(IPixelGroup& pixelGroup, uint16_t count, uint16_t* index, int pixels, float angle) {
+    int x1 = int(float(pixels) * cosf(angle * Mathematics::MPID180));
+    int y1 = int(float(pixels) * sinf(angle * Mathematics::MPID180));
+    int previousX = 0;
+    int previousY = 0;
+    bool valid = true;
+
+    *index = count;
+
+    for (int i = 0; i < pixels && valid; i++) {
+        int x = Mathematics::Map(i, 0, pixels, 0, x1);
+        int y = Mathematics::Map(i, 0, pixels, 0, y1);
+
+        for (; valid && previousX < x; previousX++) valid = pixelGroup.GetRightIndex(*index, index);
+        for (; valid && previousX > x; previousX--) valid = pixelGroup.GetLeftIndex(*index, index);
+        for (; valid && previousY < y; previousY++) valid = pixelGroup.GetUpIndex(*index, index);
+        for (; valid && previousY > y; previousY--) valid = pixelGroup.GetDownIndex(*index, index);
+    }
+
+    return valid;
+}
+
+} // namespace
+
+void TestPixelGroup::GenerateLayout(Vector2D* layout, uint16_t count) {
+    uint16_t columns = uint16_t(sqrtf(float(count))) + 1;
+
+    for (uint16_t i = 0; i < count; i++) {
+        layout[i].X = float(i % columns) * 2.0f + 0.4f * sinf(float(i) * 1.7f);
+        layout[i].Y = float(i / columns) * 2.0f + 0.4f * cosf(float(i) * 2.3f);
+    }
+}
+
+template<size_t pixelCount>
+void TestPixelGroup::BenchmarkLayout() {
+    Vector2D* layout = new Vector2D[pixelCount];
+
+    GenerateLayout(layout, pixelCount);
+
+    uint32_t start = uc3d::Time::Micros();
+    PixelGroup<pixelCount>* pixelGroup = new PixelGroup<pixelCount>(layout);
+    uint32_t elapsed = uc3d::Time::Micros() - start;
+
+    char message[64];
+    snprintf(message, sizeof(message), "GridSort %u pixels: %.3f ms", unsigned(pixelCount), elapsed / 1000.0f);
+    TEST_MESSAGE(message);
+
+    uint16_t index = 0;
+    TEST_ASSERT_TRUE(pixelGroup->GetRightIndex(0, &index));
+    TEST_ASSERT_EQUAL(1, index);
+
+    delete pixelGroup;
+    delete[] layout;
+}
+
+void TestPixelGroup::TestGridSortMatchesExhaustiveSearch() {
+    static Vector2D layout[500];
+    static uint16_t up[500], down[500], left[500], right[500];
+
+    GenerateLayout(layout, 500);
+    ExhaustiveGridSort(layout, 500, up, down, left, right);
+
+    static PixelGroup<500> pixelGroup(layout);
+
+    for (uint16_t i = 0; i < 500; i++) {
+        uint16_t index = 0;
+
+        TEST_ASSERT_EQUAL(up[i] < 65535, pixelGroup.GetUpIndex(i, &index));
+        TEST_ASSERT_EQUAL(up[i], index);
+        TEST_ASSERT_EQUAL(down[i] < 65535, pixelGroup.GetDownIndex(i, &index));
+        TEST_ASSERT_EQUAL(down[i], index);
+        TEST_ASSERT_EQUAL(left[i] < 65535, pixelGroup.GetLeftIndex(i, &index));
+        TEST_ASSERT_EQUAL(left[i], index);
+        TEST_ASSERT_EQUAL(right[i] < 65535, pixelGroup.GetRightIndex(i, &index));
+        TEST_ASSERT_EQUAL(right[i], index);
+    }
+}
+
+void TestPixelGroup::TestGridSortReverseDirection() {
+    static Vector2D layout[100];
+    static Vector2D reversed[100];
+    static uint16_t up[100], down[100], left[100], right[100];
+
+    GenerateLayout(layout, 100);
+
+    for (uint16_t i = 0; i < 100; i++) reversed[i] = layout[99 - i];
+
+    ExhaustiveGridSort(reversed, 100, up, down, left, right);
+
+    static PixelGroup<100> pixelGroup(layout, IPixelGroup::MAXTOZERO);
+
+    for (uint16_t i = 0; i < 100; i++) {
+        uint16_t index = 0;
+
+        pixelGroup.GetUpIndex(i, &index);
+        TEST_ASSERT_EQUAL(up[i], index);
+        pixelGroup.GetLeftIndex(i, &index);
+        TEST_ASSERT_EQUAL(left[i], index);
+    }
+}
+
+void TestPixelGroup::TestRowOrder() {
+    static Vector2D layout[12];
+
+    for (uint16_t i = 0; i < 12; i++) layout[i] = Vector2D(float(i % 4) * 10.0f, float(i / 4) * 10.0f);
+
+    static PixelGroup<12> pixelGroup(layout);
+    const uint16_t* rowOrder = pixelGroup.GetRowOrder();
+    const uint16_t* columnOrder = pixelGroup.GetColumnOrder();
+
+    for (uint16_t i = 0; i < 12; i++) {
+        TEST_ASSERT_EQUAL(i, rowOrder[i]);
+        TEST_ASSERT_EQUAL((i % 3) * 4 + i / 3, columnOrder[i]);
+    }
+}
+
+void TestPixelGroup::TestOffsetIndex() {
+    static Vector2D layout[400];
+
+    // Jittered beyond the grid tolerance, so lookups go through the neighbor tables rather than grid arithmetic
+    for (uint16_t i = 0; i < 400; i++) {
+        layout[i] = Vector2D(float(i % 20) * 2.0f + 0.3f * sinf(float(i) * 1.7f), float(i / 20) * 2.0f + 0.3f * cosf(float(i) * 2.3f));
+    }
+
+    TEST_ASSERT_FALSE(PixelLayout<400>(layout).IsRectangular());
+
+    static PixelGroup<400> walked(layout);
+    static PixelGroup<400> jumped(layout);
+
+    jumped.EnableJumpTables(3);
+
+    for (uint16_t i = 0; i < 400; i++) {
+        for (int offset = -21; offset <= 21; offset += 3) {
+            uint16_t walkedIndex = 0, jumpedIndex = 0;
+            bool valid = walked.GetOffsetXYIndex(i, &walkedIndex, offset, -offset / 2);
+
+            TEST_ASSERT_EQUAL(valid, jumped.GetOffsetXYIndex(i, &jumpedIndex, offset, -offset / 2));
+            TEST_ASSERT_EQUAL(walkedIndex, jumpedIndex);
+
+            int x = i % 20 + offset;
+            int y = i / 20 - offset / 2;
+            TEST_ASSERT_EQUAL(x >= 0 && x < 20 && y >= 0 && y < 20, valid);
+        }
+    }
+}
+
+void TestPixelGroup::TestRadialIndex() {
+    static Vector2D layout[500];
+
+    // The last row is partial, so stepping along X before Y reaches different pixels near its edge
+    GenerateLayout(layout, 500);
+
+    static PixelGroup<500> walked(layout);
+    static PixelGroup<500> jumped(layout);
+
+    jumped.EnableJumpTables(3);
+
+    for (uint16_t i = 0; i < 500; i += 3) {
+        for (float angle = 0.0f; angle < 360.0f; angle += 22.5f) {
+            for (int pixels = 1; pixels <= 24; pixels += 5) {
+                uint16_t expected = 0, walkedIndex = 0, jumpedIndex = 0;
+                bool valid = WalkRadial(walked, i, &expected, pixels, angle);
+
+                TEST_ASSERT_EQUAL(valid, walked.GetRadialIndex(i, &walkedIndex, pixels, angle));
+                TEST_ASSERT_EQUAL(valid, jumped.GetRadialIndex(i, &jumpedIndex, pixels, angle));
+                TEST_ASSERT_EQUAL(expected, walkedIndex);
+                TEST_ASSERT_EQUAL(expected, jumpedIndex);
+            }
+        }
+    }
+}
+
+void TestPixelGroup::TestConstexprLayout() {
+    static PixelGroup<9> runtime(kStaggeredLayout);
+    static LayoutPixelGroup<9> shared(kStaggeredTables);
+
+    for (uint16_t i = 0; i < 9; i++) {
+        uint16_t expected = 0, actual = 0;
+
+        TEST_ASSERT_EQUAL(runtime.GetUpIndex(i, &expected), shared.GetUpIndex(i, &actual));
+        TEST_ASSERT_EQUAL(expected, actual);
+        TEST_ASSERT_EQUAL(runtime.GetDownIndex(i, &expected), shared.GetDownIndex(i, &actual));
+        TEST_ASSERT_EQUAL(expected, actual);
+        TEST_ASSERT_EQUAL(runtime.GetLeftIndex(i, &expected), shared.GetLeftIndex(i, &actual));
+        TEST_ASSERT_EQUAL(expected, actual);
+        TEST_ASSERT_EQUAL(runtime.GetRightIndex(i, &expected), shared.GetRightIndex(i, &actual));
+        TEST_ASSERT_EQUAL(expected, actual);
+        TEST_ASSERT_EQUAL(runtime.GetRowOrder()[i], shared.GetRowOrder()[i]);
+        TEST_ASSERT_EQUAL(runtime.GetColumnOrder()[i], shared.GetColumnOrder()[i]);
+    }
+
+    TEST_ASSERT_EQUAL_FLOAT(-0.3f, shared.GetCenterCoordinate().X - shared.GetSize().X / 2.0f);
+    TEST_ASSERT_EQUAL_FLOAT(4.2f, shared.GetCenterCoordinate().Y + shared.GetSize().Y / 2.0f);
+
+    // Groups over a flash layout read its tables in place
+    static LayoutPixelGroup<kPanelCount> panel(kPanelTables);
+    uint16_t index = 0;
+
+    TEST_ASSERT_TRUE(panel.GetUpIndex(0, &index));
+    TEST_ASSERT_EQUAL(kPanelRow, index);
+}
+
+void TestPixelGroup::TestGridDetection() {
+    static Vector2D grid[12];
+    static Vector2D tight[12];
+
+    for (uint16_t i = 0; i < 12; i++) {
+        grid[i] = Vector2D(5.0f + float(i % 4) * 2.0f, float(i / 4) * 3.0f);
+        tight[i] = Vector2D(float(i % 4) * 0.5f, float(i / 4) * 0.5f);
+    }
+
+    PixelLayout<12> gridLayout(grid);
+    PixelLayout<12> tightLayout(tight);
+
+    TEST_ASSERT_TRUE(gridLayout.IsRectangular());
+    TEST_ASSERT_EQUAL(4, gridLayout.GetRowCount());
+    TEST_ASSERT_EQUAL(3, gridLayout.GetColumnCount());
+    TEST_ASSERT_EQUAL_FLOAT(8.0f, gridLayout.GetGridSize().X);
+    TEST_ASSERT_EQUAL_FLOAT(9.0f, gridLayout.GetGridSize().Y);
+    TEST_ASSERT_FALSE(tightLayout.IsRectangular());
+}
+
+void TestPixelGroup::TestCoordinates() {
+    static PixelGroup<12> rectangular(Vector2D(8.0f, 6.0f), Vector2D(-1.0f, 2.0f), 4);
+    static PixelGroup<9> reversed(kStaggeredLayout, IPixelGroup::MAXTOZERO);
+
+    PixelCoordinates gridCoordinates = rectangular.GetCoordinates();
+    PixelCoordinates layoutCoordinates = reversed.GetCoordinates();
+
+    uint16_t i = 0;
+
+    TEST_ASSERT_EQUAL(12, gridCoordinates.GetPixelCount());
+
+    for (Vector2D coordinate : gridCoordinates) {
+        TEST_ASSERT_EQUAL_FLOAT(-1.0f + float(i % 4) * 2.0f, coordinate.X);
+        TEST_ASSERT_EQUAL_FLOAT(2.0f + float(i / 4) * 2.0f, coordinate.Y);
+        TEST_ASSERT_EQUAL_FLOAT(coordinate.X, gridCoordinates[i].X);
+        TEST_ASSERT_EQUAL_FLOAT(coordinate.Y, rectangular.GetCoordinate(i).Y);
+        i++;
+    }
+
+    TEST_ASSERT_EQUAL(12, i);
+
+    for (PixelCoordinates::Iterator it = layoutCoordinates.begin(); it != layoutCoordinates.end(); ++it) {
+        TEST_ASSERT_EQUAL_FLOAT(kStaggeredLayout[8 - it.GetIndex()].X, (*it).X);
+        TEST_ASSERT_EQUAL_FLOAT(kStaggeredLayout[8 - it.GetIndex()].Y, layoutCoordinates[it.GetIndex()].Y);
+    }
+}
+
+void TestPixelGroup::BenchmarkGridSort() {
+    BenchmarkLayout<1000>();
+    BenchmarkLayout<5000>();
+    BenchmarkLayout<20000>();
+}
+
+void TestPixelGroup::RunAllTests() {
+    RUN_TEST(TestGridSortMatchesExhaustiveSearch);
+    RUN_TEST(TestGridSortReverseDirection);
+    RUN_TEST(TestRowOrder);
+    RUN_TEST(TestOffsetIndex);
+    RUN_TEST(TestRadialIndex);
+    RUN_TEST(TestConstexprLayout);
+    RUN_TEST(TestGridDetection);
+    RUN_TEST(TestCoordinates);
+    RUN_TEST(BenchmarkGridSort);
+}
@@ -0,0 +1,60 @@
+/**
+ * @file TestPixelGroup.h
+ * @brief Provides unit tests and startup benchmarks for the PixelGroup class.
+ *
+ * The `TestPixelGroup` class contains static methods for testing the neighbor tables,
+ * traversal orders and offset lookups of the PixelGroup class, and for timing the
+ * neighbor search on large arbitrary layouts.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <unity.h>
+#include "../lib/uc3d/core/platform/time.hpp"
+#include "../lib/uc3d/systems/render/core/pixelgroup.hpp"
+
+/**
+ * @class TestPixelGroup
+ * @brief Contains static test methods for the PixelGroup class.
+ *
+ * This class provides unit tests to ensure the neighbor search of arbitrary layouts
+ * matches an exhaustive search, and a benchmark of the startup cost of the search.
+ */
+class TestPixelGroup {
+private:
+    /**
+     * @brief Fills an irregular, jittered grid layout spaced two units apart.
+     *
+     * @param layout Output array of pixel positions.
+     * @param count Number of pixels in the layout.
+     */
+    static void GenerateLayout(Vector2D* layout, uint16_t count);
+
+    /**
+     * @brief Times the construction of a PixelGroup over a generated layout.
+     *
+     * @tparam pixelCount Number of pixels in the layout.
+     */
+    template<size_t pixelCount>
+    static void BenchmarkLayout();
+
+public:
+    static void TestGridSortMatchesExhaustiveSearch(); ///< Tests the neighbor tables against an O(n^2) reference search.
+    static void TestGridSortReverseDirection(); ///< Tests the neighbor tables for layouts traversed from the end.
+    static void TestRowOrder(); ///< Tests that row traversal orders follow the right neighbors.
+    static void TestOffsetIndex(); ///< Tests offset lookups with and without jump tables.
+    static void TestRadialIndex(); ///< Tests radial lookups with and without jump tables against a neighbor walk.
+    static void TestConstexprLayout(); ///< Tests that compile-time layouts match layouts built at runtime.
+    static void TestGridDetection(); ///< Tests rectangular detection of arbitrary layouts.
+    static void TestCoordinates(); ///< Tests streamed coordinates of rectangular and arbitrary groups.
+    static void BenchmarkGridSort(); ///< Reports GridSort startup time for 1k, 5k and 20k pixel layouts.
+
+    /**
+     * @brief Runs all the test methods in the class.
+     */
+    static void RunAllTests();
+};
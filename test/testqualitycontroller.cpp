@@ -0,0 +1,98 @@
+#include "testqualitycontroller.hpp"
+
+void TestQualityController::StoreLevel(uint8_t level, void* context) {
+    *static_cast<uint8_t*>(context) = level;
+}
+
+void TestQualityController::TestShedsInOrder() {
+    QualityController quality;
+    uint8_t shadingRate = 0;
+    uint8_t blur = 0;
+
+    TEST_ASSERT_TRUE(quality.AddStep(StoreLevel, &shadingRate, 2));
+    TEST_ASSERT_TRUE(quality.AddStep(StoreLevel, &blur));
+
+    quality.SetTargetFrameTime(0.01f);
+
+    // Each level is measured for a few slow frames before the next one is shed
+    for (uint8_t i = 0; i < 3; i++) {
+        quality.ReportFrameTime(0.02f);
+    }
+
+    TEST_ASSERT_EQUAL(1, shadingRate);
+    TEST_ASSERT_EQUAL(0, blur);
+
+    for (uint8_t i = 0; i < 30; i++) {
+        quality.ReportFrameTime(0.02f);
+    }
+
+    TEST_ASSERT_EQUAL(2, shadingRate);
+    TEST_ASSERT_EQUAL(1, blur);
+    TEST_ASSERT_FALSE(quality.Shed());
+
+    // Headroom brings back the last shed step first
+    for (uint8_t i = 0; i < 30; i++) {
+        quality.ReportFrameTime(0.001f);
+    }
+
+    TEST_ASSERT_EQUAL(2, shadingRate);
+    TEST_ASSERT_EQUAL(0, blur);
+
+    for (uint8_t i = 0; i < 30; i++) {
+        quality.ReportFrameTime(0.001f);
+    }
+
+    TEST_ASSERT_EQUAL(1, shadingRate);
+    TEST_ASSERT_EQUAL(1, quality.GetLevel(0));
+}
+
+void TestQualityController::TestIgnoresSpikes() {
+    QualityController quality;
+    uint8_t level = 0;
+
+    quality.AddStep(StoreLevel, &level, 3);
+    quality.SetTargetFrameTime(0.01f);
+
+    for (uint8_t i = 0; i < 20; i++) {
+        quality.ReportFrameTime(i % 2 ? 0.02f : 0.009f);
+    }
+
+    TEST_ASSERT_EQUAL(0, level);
+
+    quality.Shed();
+
+    // Frames just under the target fit the current level and do not restore it
+    for (uint8_t i = 0; i < 60; i++) {
+        quality.ReportFrameTime(i % 10 ? 0.001f : 0.009f);
+    }
+
+    TEST_ASSERT_EQUAL(1, level);
+}
+
+void TestQualityController::TestDisableRestores() {
+    QualityController quality;
+    uint8_t level = 0;
+
+    quality.AddStep(StoreLevel, &level, 2);
+    quality.Shed();
+    quality.Shed();
+
+    TEST_ASSERT_EQUAL(2, level);
+
+    quality.SetTargetFrameTime(0.0f);
+
+    TEST_ASSERT_EQUAL(0, level);
+
+    // Without a target nothing is shed
+    for (uint8_t i = 0; i < 10; i++) {
+        quality.ReportFrameTime(1.0f);
+    }
+
+    TEST_ASSERT_EQUAL(0, level);
+}
+
+void TestQualityController::RunAllTests() {
+    RUN_TEST(TestShedsInOrder);
+    RUN_TEST(TestIgnoresSpikes);
+    RUN_TEST(TestDisableRestores);
+}
@@ -0,0 +1,39 @@
+/**
+ * @file TestQualityController.h
+ * @brief Provides unit tests for the QualityController class.
+ *
+ * The `TestQualityController` class contains static methods for testing that quality is shed
+ * in priority order under sustained load, restored with sustained headroom, and left alone
+ * for single spikes.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <unity.h>
+#include "../lib/uc3d/app/project/qualitycontroller.hpp"
+
+/**
+ * @class TestQualityController
+ * @brief Contains static test methods for the QualityController class.
+ */
+class TestQualityController {
+private:
+    /**
+     * @brief Step callback storing the level in the uint8_t the context points to.
+     */
+    static void StoreLevel(uint8_t level, void* context);
+
+public:
+    static void TestShedsInOrder(); ///< Tests that steps are shed in order and restored in reverse.
+    static void TestIgnoresSpikes(); ///< Tests that single slow or fast frames change nothing.
+    static void TestDisableRestores(); ///< Tests that clearing the target returns to full quality.
+
+    /**
+     * @brief Runs all the test methods in the class.
+     */
+    static void RunAllTests();
+};
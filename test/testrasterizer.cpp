@@ -0,0 +1,477 @@
+#include <atomic>
+#include "testrasterizer.hpp"
+
+// Linear ramp over the position that counts its calls, so reduced rates can be measured
+struct RampShaderParams {
+    // Empty struct
+};
+
+class RampShader final : public IShader {
+public:
+    static std::atomic<uint32_t> calls;
+
+    RGBColor Shade(const SurfaceProperties& sp, const IMaterial& /*m*/) const override {
+        ++calls;
+
+        return RGBColor(uint8_t(sp.position.X * 7.0f), uint8_t(sp.position.Y * 7.0f), 64);
+    }
+};
+
+std::atomic<uint32_t> RampShader::calls(0);
+
+void TestRasterizer::TestPoolMatchesSerial() {
+    // 16 x 16 quads of a bumpy sheet, so neighboring triangles shade differently
+    static Vector3D vertices[17 * 17];
+    static IndexGroup indices[16 * 16 * 2];
+
+    for (uint16_t y = 0; y < 17; y++) {
+        for (uint16_t x = 0; x < 17; x++) {
+            vertices[y * 17 + x] = Vector3D(float(x) * 2.0f, float(y) * 2.0f, sinf(float(x + y)) * 2.0f);
+        }
+    }
+
+    for (uint16_t y = 0; y < 16; y++) {
+        for (uint16_t x = 0; x < 16; x++) {
+            uint16_t corner = y * 17 + x;
+
+            indices[(y * 16 + x) * 2] = IndexGroup(corner, corner + 1, corner + 18);
+            indices[(y * 16 + x) * 2 + 1] = IndexGroup(corner, corner + 18, corner + 17);
+        }
+    }
+
+    static StaticTriangleGroup<17 * 17, 16 * 16 * 2> original(vertices, indices);
+    static TriangleGroup<17 * 17, 16 * 16 * 2> modified(&original);
+    static MaterialT<NormalShaderParams, NormalShader> material;
+    Mesh mesh(&original, &modified, &material);
+    Scene scene(1);
+
+    scene.AddMesh(&mesh);
+
+    static PixelGroup<1024> serialPixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    static PixelGroup<1024> poolPixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    CameraLayout layout(CameraLayout::ZForward, CameraLayout::YUp);
+    Transform transform(Vector3D(0, 0, 0), Vector3D(0, 0, -10), Vector3D(1, 1, 1));
+    Camera<1024> serialCamera(&transform, &layout, &serialPixels);
+    Camera<1024> poolCamera(&transform, &layout, &poolPixels);
+    ThreadPool pool(4);
+
+    Rasterizer::Rasterize(&scene, &serialCamera);
+    Rasterizer::Rasterize(&scene, &poolCamera, &pool);
+
+    uint16_t covered = 0;
+
+    for (uint16_t i = 0; i < 1024; i++) {
+        const RGBColor& expected = serialPixels.GetColors()[i];
+        const RGBColor& actual = poolPixels.GetColors()[i];
+
+        TEST_ASSERT_EQUAL(expected.R, actual.R);
+        TEST_ASSERT_EQUAL(expected.G, actual.G);
+        TEST_ASSERT_EQUAL(expected.B, actual.B);
+
+        if (expected.R || expected.G || expected.B) covered++;
+    }
+
+    TEST_ASSERT_TRUE(covered > 512);
+}
+
+void TestRasterizer::TestIncrementalMatchesFull() {
+    // A flat backdrop with a small quad in front of it that moves between frames
+    static Vector3D backVertices[4] = { Vector3D(0, 0, 0), Vector3D(32, 0, 0), Vector3D(32, 32, 0), Vector3D(0, 32, 0) };
+    static Vector3D frontVertices[4] = { Vector3D(4, 4, -5), Vector3D(8, 4, -5), Vector3D(8, 8, -4), Vector3D(4, 8, -5) };
+    static IndexGroup indices[2] = { IndexGroup(0, 1, 2), IndexGroup(0, 2, 3) };
+
+    static StaticTriangleGroup<4, 2> backOriginal(backVertices, indices);
+    static TriangleGroup<4, 2> backModified(&backOriginal);
+    static StaticTriangleGroup<4, 2> frontOriginal(frontVertices, indices);
+    static TriangleGroup<4, 2> frontModified(&frontOriginal);
+    static MaterialT<NormalShaderParams, NormalShader> material;
+    Mesh back(&backOriginal, &backModified, &material);
+    Mesh front(&frontOriginal, &frontModified, &material);
+    Scene scene(2);
+
+    scene.AddMesh(&back);
+    scene.AddMesh(&front);
+
+    static PixelGroup<1024> fullPixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    static PixelGroup<1024> incrementalPixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    CameraLayout layout(CameraLayout::ZForward, CameraLayout::YUp);
+    Transform transform(Vector3D(0, 0, 0), Vector3D(0, 0, -10), Vector3D(1, 1, 1));
+    Camera<1024> fullCamera(&transform, &layout, &fullPixels);
+    Camera<1024> incrementalCamera(&transform, &layout, &incrementalPixels);
+
+    incrementalCamera.GetFrameHistory()->SetEnabled(true);
+
+    Rasterizer::Rasterize(&scene, &fullCamera);
+    Rasterizer::Rasterize(&scene, &incrementalCamera);
+
+    // Mark a pixel far from the quad, it must be left alone by the next frame
+    uint16_t untouched = 0;
+
+    for (uint16_t i = 0; i < 1024; i++) {
+        Vector2D pixel = incrementalPixels.GetCoordinate(i);
+
+        if (pixel.X > 24.0f && pixel.Y > 24.0f) untouched = i;
+    }
+
+    incrementalPixels.GetColors()[untouched] = RGBColor(1, 2, 3);
+
+    // Move the quad like a deformer would, by writing its vertices
+    for (uint8_t i = 0; i < 4; i++) {
+        front.GetTriangleGroup()->GetVertices()[i].X += 3.0f;
+    }
+
+    front.GetTriangleGroup()->MarkChanged();
+
+    Rasterizer::Rasterize(&scene, &fullCamera);
+    Rasterizer::Rasterize(&scene, &incrementalCamera);
+
+    TEST_ASSERT_EQUAL(1, incrementalPixels.GetColors()[untouched].R);
+    TEST_ASSERT_EQUAL(2, incrementalPixels.GetColors()[untouched].G);
+    TEST_ASSERT_EQUAL(3, incrementalPixels.GetColors()[untouched].B);
+
+    uint16_t differing = 0;
+
+    for (uint16_t i = 0; i < 1024; i++) {
+        const RGBColor& expected = fullPixels.GetColors()[i];
+        const RGBColor& actual = incrementalPixels.GetColors()[i];
+
+        if (expected.R != actual.R || expected.G != actual.G || expected.B != actual.B) differing++;
+    }
+
+    TEST_ASSERT_EQUAL(1, differing);
+
+    // Disabling the quad must restore the backdrop behind it
+    front.Disable();
+
+    Rasterizer::Rasterize(&scene, &fullCamera);
+    Rasterizer::Rasterize(&scene, &incrementalCamera);
+
+    for (uint16_t i = 0; i < 1024; i++) {
+        if (i == untouched) continue;
+
+        TEST_ASSERT_EQUAL(fullPixels.GetColors()[i].R, incrementalPixels.GetColors()[i].R);
+        TEST_ASSERT_EQUAL(fullPixels.GetColors()[i].G, incrementalPixels.GetColors()[i].G);
+        TEST_ASSERT_EQUAL(fullPixels.GetColors()[i].B, incrementalPixels.GetColors()[i].B);
+    }
+}
+
+void TestRasterizer::TestHitCacheMatchesUncached() {
+    // A bumpy sheet that ripples between frames, so most pixels keep their triangle and some change it
+    static Vector3D vertices[9 * 9];
+    static IndexGroup indices[8 * 8 * 2];
+
+    for (uint16_t y = 0; y < 9; y++) {
+        for (uint16_t x = 0; x < 9; x++) {
+            vertices[y * 9 + x] = Vector3D(float(x) * 4.0f, float(y) * 4.0f, sinf(float(x * 3 + y)) * 2.0f);
+        }
+    }
+
+    for (uint16_t y = 0; y < 8; y++) {
+        for (uint16_t x = 0; x < 8; x++) {
+            uint16_t corner = y * 9 + x;
+
+            indices[(y * 8 + x) * 2] = IndexGroup(corner, corner + 1, corner + 10);
+            indices[(y * 8 + x) * 2 + 1] = IndexGroup(corner, corner + 10, corner + 9);
+        }
+    }
+
+    static StaticTriangleGroup<9 * 9, 8 * 8 * 2> original(vertices, indices);
+    static TriangleGroup<9 * 9, 8 * 8 * 2> modified(&original);
+    static MaterialT<NormalShaderParams, NormalShader> material;
+    Mesh mesh(&original, &modified, &material);
+    Scene scene(1);
+
+    scene.AddMesh(&mesh);
+
+    static PixelGroup<1024> cachedPixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    static PixelGroup<1024> uncachedPixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    CameraLayout layout(CameraLayout::ZForward, CameraLayout::YUp);
+    Transform transform(Vector3D(0, 0, 0), Vector3D(0, 0, -10), Vector3D(1, 1, 1));
+    Camera<1024> cachedCamera(&transform, &layout, &cachedPixels);
+    Camera<1024> uncachedCamera(&transform, &layout, &uncachedPixels);
+
+    uncachedCamera.GetFrameHistory()->SetHitCacheEnabled(false);
+
+    for (uint8_t frame = 0; frame < 3; frame++) {
+        for (uint16_t i = 0; i < 9 * 9; i++) {
+            mesh.GetTriangleGroup()->GetVertices()[i].X = vertices[i].X + sinf(float(frame + i)) * 0.5f;
+        }
+
+        mesh.GetTriangleGroup()->MarkChanged();
+
+        Rasterizer::Rasterize(&scene, &cachedCamera);
+        Rasterizer::Rasterize(&scene, &uncachedCamera);
+
+        for (uint16_t i = 0; i < 1024; i++) {
+            TEST_ASSERT_EQUAL(uncachedPixels.GetColors()[i].R, cachedPixels.GetColors()[i].R);
+            TEST_ASSERT_EQUAL(uncachedPixels.GetColors()[i].G, cachedPixels.GetColors()[i].G);
+            TEST_ASSERT_EQUAL(uncachedPixels.GetColors()[i].B, cachedPixels.GetColors()[i].B);
+        }
+    }
+}
+
+void TestRasterizer::TestTriangleCacheMatchesUncached() {
+    // A static backdrop, a quad that is deformed in one frame, and a camera that moves in another
+    static Vector3D backVertices[4] = { Vector3D(0, 0, 0), Vector3D(32, 0, 0), Vector3D(32, 32, 0), Vector3D(0, 32, 0) };
+    static Vector3D frontVertices[4] = { Vector3D(4, 4, -5), Vector3D(12, 4, -5), Vector3D(12, 12, -4), Vector3D(4, 12, -5) };
+    static IndexGroup indices[2] = { IndexGroup(0, 1, 2), IndexGroup(0, 2, 3) };
+
+    static StaticTriangleGroup<4, 2> backOriginal(backVertices, indices);
+    static TriangleGroup<4, 2> backModified(&backOriginal);
+    static StaticTriangleGroup<4, 2> frontOriginal(frontVertices, indices);
+    static TriangleGroup<4, 2> frontModified(&frontOriginal);
+    static MaterialT<NormalShaderParams, NormalShader> material;
+    Mesh back(&backOriginal, &backModified, &material);
+    Mesh front(&frontOriginal, &frontModified, &material);
+    Scene scene(2);
+
+    scene.AddMesh(&back);
+    scene.AddMesh(&front);
+
+    static PixelGroup<1024> cachedPixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    static PixelGroup<1024> uncachedPixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    CameraLayout layout(CameraLayout::ZForward, CameraLayout::YUp);
+    Transform transform(Vector3D(0, 0, 0), Vector3D(0, 0, -10), Vector3D(1, 1, 1));
+    Camera<1024> cachedCamera(&transform, &layout, &cachedPixels);
+    Camera<1024> uncachedCamera(&transform, &layout, &uncachedPixels);
+    TriangleCache* cache = cachedCamera.GetFrameHistory()->GetTriangleCache();
+
+    uncachedCamera.GetFrameHistory()->GetTriangleCache()->SetEnabled(false);
+
+    for (uint8_t frame = 0; frame < 4; frame++) {
+        // The backdrop is reset and transformed the same way every frame, which keeps its version
+        back.ResetVertices();
+        back.UpdateTransform();
+
+        if (frame == 1) {
+            front.GetTriangleGroup()->GetVertices()[2].X += 6.0f;
+            front.GetTriangleGroup()->MarkChanged();
+        }
+
+        if (frame == 2) {
+            transform.SetPosition(Vector3D(3, -2, -10));
+        }
+
+        // Only the deformed quad misses the cache, the backdrop is reused
+        if (frame == 1) {
+            const CameraProjection& projection = cachedCamera.GetProjection();
+
+            TEST_ASSERT_TRUE(cache->Find(projection, &back, back.GetVersion(), 2) != nullptr);
+            TEST_ASSERT_TRUE(cache->Find(projection, &front, front.GetVersion(), 2) == nullptr);
+        }
+
+        // Triangles only point to their material, a changed material state keeps them
+        if (frame == 3) {
+            material.MarkChanged();
+
+            TEST_ASSERT_TRUE(cache->Find(cachedCamera.GetProjection(), &back, back.GetVersion(), 2) != nullptr);
+        }
+
+        Rasterizer::Rasterize(&scene, &cachedCamera);
+        Rasterizer::Rasterize(&scene, &uncachedCamera);
+
+        for (uint16_t i = 0; i < 1024; i++) {
+            TEST_ASSERT_EQUAL(uncachedPixels.GetColors()[i].R, cachedPixels.GetColors()[i].R);
+            TEST_ASSERT_EQUAL(uncachedPixels.GetColors()[i].G, cachedPixels.GetColors()[i].G);
+            TEST_ASSERT_EQUAL(uncachedPixels.GetColors()[i].B, cachedPixels.GetColors()[i].B);
+        }
+    }
+}
+
+void TestRasterizer::TestInterpolatedDepth() {
+    // A quad sloping through a flat one, the sloped quad is in front on the left and behind on the right
+    static Vector3D slopedVertices[4] = { Vector3D(0, 0, -16), Vector3D(32, 0, 16), Vector3D(32, 32, 16), Vector3D(0, 32, -16) };
+    static Vector3D flatVertices[4] = { Vector3D(0, 0, 0.5f), Vector3D(32, 0, 0.5f), Vector3D(32, 32, 0.5f), Vector3D(0, 32, 0.5f) };
+    static IndexGroup indices[2] = { IndexGroup(0, 1, 2), IndexGroup(0, 2, 3) };
+
+    static StaticTriangleGroup<4, 2> slopedOriginal(slopedVertices, indices);
+    static TriangleGroup<4, 2> slopedModified(&slopedOriginal);
+    static StaticTriangleGroup<4, 2> flatOriginal(flatVertices, indices);
+    static TriangleGroup<4, 2> flatModified(&flatOriginal);
+    static MaterialT<NormalShaderParams, NormalShader> material;
+    Mesh sloped(&slopedOriginal, &slopedModified, &material);
+    Mesh flat(&flatOriginal, &flatModified, &material);
+    Scene scene(2);
+
+    scene.AddMesh(&sloped);
+    scene.AddMesh(&flat);
+
+    static PixelGroup<1024> unsortedPixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    static PixelGroup<1024> sortedPixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    CameraLayout layout(CameraLayout::ZForward, CameraLayout::YUp);
+    Transform transform(Vector3D(0, 0, 0), Vector3D(0, 0, -10), Vector3D(1, 1, 1));
+    Camera<1024> unsortedCamera(&transform, &layout, &unsortedPixels);
+    Camera<1024> sortedCamera(&transform, &layout, &sortedPixels);
+
+    Rasterizer::SetDepthMode(Rasterizer::DepthMode::Interpolated);
+    Rasterizer::Rasterize(&scene, &unsortedCamera);
+    Rasterizer::SetDepthMode(Rasterizer::DepthMode::Interpolated, true);
+    Rasterizer::Rasterize(&scene, &sortedCamera);
+    Rasterizer::SetDepthMode(Rasterizer::DepthMode::Average);
+
+    uint16_t left = 0;
+    uint16_t right = 0;
+
+    for (uint16_t i = 0; i < 1024; i++) {
+        Vector2D pixel = unsortedPixels.GetCoordinate(i);
+
+        if (pixel.X > 2.0f && pixel.X < 6.0f && pixel.Y > 2.0f && pixel.Y < 6.0f) left = i;
+        if (pixel.X > 26.0f && pixel.X < 30.0f && pixel.Y > 26.0f && pixel.Y < 30.0f) right = i;
+
+        TEST_ASSERT_EQUAL(unsortedPixels.GetColors()[i].R, sortedPixels.GetColors()[i].R);
+        TEST_ASSERT_EQUAL(unsortedPixels.GetColors()[i].G, sortedPixels.GetColors()[i].G);
+        TEST_ASSERT_EQUAL(unsortedPixels.GetColors()[i].B, sortedPixels.GetColors()[i].B);
+    }
+
+    // Each side must show the quad that is in front there, alone it shades the same
+    sloped.Disable();
+    Rasterizer::Rasterize(&scene, &sortedCamera);
+
+    const RGBColor flatColor = sortedPixels.GetColors()[right];
+
+    sloped.Enable();
+    flat.Disable();
+    Rasterizer::Rasterize(&scene, &sortedCamera);
+
+    const RGBColor slopedColor = sortedPixels.GetColors()[left];
+
+    TEST_ASSERT_FALSE(flatColor.R == slopedColor.R && flatColor.G == slopedColor.G && flatColor.B == slopedColor.B);
+    TEST_ASSERT_EQUAL(slopedColor.R, unsortedPixels.GetColors()[left].R);
+    TEST_ASSERT_EQUAL(slopedColor.G, unsortedPixels.GetColors()[left].G);
+    TEST_ASSERT_EQUAL(slopedColor.B, unsortedPixels.GetColors()[left].B);
+    TEST_ASSERT_EQUAL(flatColor.R, unsortedPixels.GetColors()[right].R);
+    TEST_ASSERT_EQUAL(flatColor.G, unsortedPixels.GetColors()[right].G);
+    TEST_ASSERT_EQUAL(flatColor.B, unsortedPixels.GetColors()[right].B);
+}
+
+void TestRasterizer::TestReducedShadingRate() {
+    // A ramp backdrop with a flat-shaded quad in front of it, whose outline must stay sharp
+    static Vector3D backVertices[4] = { Vector3D(0, 0, 0), Vector3D(32, 0, 0), Vector3D(32, 32, 0), Vector3D(0, 32, 0) };
+    static Vector3D frontVertices[4] = { Vector3D(9, 9, -5), Vector3D(21, 9, -5), Vector3D(21, 21, -4), Vector3D(9, 21, -5) };
+    static IndexGroup indices[2] = { IndexGroup(0, 1, 2), IndexGroup(0, 2, 3) };
+
+    static StaticTriangleGroup<4, 2> backOriginal(backVertices, indices);
+    static TriangleGroup<4, 2> backModified(&backOriginal);
+    static StaticTriangleGroup<4, 2> frontOriginal(frontVertices, indices);
+    static TriangleGroup<4, 2> frontModified(&frontOriginal);
+    static MaterialT<RampShaderParams, RampShader> rampMaterial;
+    static MaterialT<NormalShaderParams, NormalShader> normalMaterial;
+    Mesh back(&backOriginal, &backModified, &rampMaterial);
+    Mesh front(&frontOriginal, &frontModified, &normalMaterial);
+    Scene scene(2);
+
+    scene.AddMesh(&back);
+    scene.AddMesh(&front);
+
+    static PixelGroup<1024> fullPixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    static PixelGroup<1024> cameraRatePixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    static PixelGroup<1024> materialRatePixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    CameraLayout layout(CameraLayout::ZForward, CameraLayout::YUp);
+    Transform transform(Vector3D(0, 0, 0), Vector3D(0, 0, -10), Vector3D(1, 1, 1));
+    Camera<1024> fullCamera(&transform, &layout, &fullPixels);
+    Camera<1024> cameraRateCamera(&transform, &layout, &cameraRatePixels);
+    Camera<1024> materialRateCamera(&transform, &layout, &materialRatePixels);
+    ThreadPool pool(4);
+
+    RampShader::calls = 0;
+    Rasterizer::Rasterize(&scene, &fullCamera);
+
+    uint32_t fullCalls = RampShader::calls;
+
+    RampShader::calls = 0;
+    cameraRateCamera.SetShadingRate(2);
+    Rasterizer::Rasterize(&scene, &cameraRateCamera, &pool);
+
+    uint32_t cameraRateCalls = RampShader::calls;
+
+    // Only the ramp shades at a reduced rate, the quad in front follows the full-rate camera
+    RampShader::calls = 0;
+    rampMaterial.SetShadingRate(4);
+    Rasterizer::Rasterize(&scene, &materialRateCamera);
+    rampMaterial.SetShadingRate(0);
+
+    uint32_t materialRateCalls = RampShader::calls;
+
+    TEST_ASSERT_TRUE(cameraRateCalls * 2 < fullCalls);
+    TEST_ASSERT_TRUE(materialRateCalls < cameraRateCalls);
+
+    for (uint16_t i = 0; i < 1024; i++) {
+        const RGBColor& expected = fullPixels.GetColors()[i];
+        const RGBColor* actual[2] = { &cameraRatePixels.GetColors()[i], &materialRatePixels.GetColors()[i] };
+
+        // The ramp is linear so interpolation only rounds, blending across the outline would not
+        for (uint8_t j = 0; j < 2; j++) {
+            TEST_ASSERT_INT_WITHIN(1, expected.R, actual[j]->R);
+            TEST_ASSERT_INT_WITHIN(1, expected.G, actual[j]->G);
+            TEST_ASSERT_INT_WITHIN(1, expected.B, actual[j]->B);
+        }
+    }
+}
+
+void TestRasterizer::TestReducedResolution() {
+    // A ramp is linear, so rendering it at half resolution and upscaling only rounds
+    static Vector3D vertices[4] = { Vector3D(0, 0, 0), Vector3D(32, 0, 0), Vector3D(32, 32, 0), Vector3D(0, 32, 0) };
+    static IndexGroup indices[2] = { IndexGroup(0, 1, 2), IndexGroup(0, 2, 3) };
+
+    static StaticTriangleGroup<4, 2> original(vertices, indices);
+    static TriangleGroup<4, 2> modified(&original);
+    static MaterialT<RampShaderParams, RampShader> material;
+    Mesh mesh(&original, &modified, &material);
+    Scene scene(1);
+
+    scene.AddMesh(&mesh);
+
+    static PixelGroup<1024> fullPixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    static PixelGroup<1024> scaledPixels(Vector2D(32, 32), Vector2D(0, 0), 32);
+    CameraLayout layout(CameraLayout::ZForward, CameraLayout::YUp);
+    Transform transform(Vector3D(0, 0, 0), Vector3D(0, 0, -10), Vector3D(1, 1, 1));
+    Camera<1024> fullCamera(&transform, &layout, &fullPixels);
+    Camera<1024> scaledCamera(&transform, &layout, &scaledPixels);
+    ThreadPool pool(4);
+
+    RampShader::calls = 0;
+    Rasterizer::Rasterize(&scene, &fullCamera);
+
+    uint32_t fullCalls = RampShader::calls;
+
+    RampShader::calls = 0;
+    scaledCamera.GetResolutionScaler()->SetScale(0.5f);
+    Rasterizer::Rasterize(&scene, &scaledCamera, &pool);
+
+    TEST_ASSERT_TRUE(RampShader::calls * 3 < fullCalls);
+
+    for (uint16_t i = 0; i < 1024; i++) {
+        TEST_ASSERT_INT_WITHIN(2, fullPixels.GetColors()[i].R, scaledPixels.GetColors()[i].R);
+        TEST_ASSERT_INT_WITHIN(2, fullPixels.GetColors()[i].G, scaledPixels.GetColors()[i].G);
+        TEST_ASSERT_INT_WITHIN(2, fullPixels.GetColors()[i].B, scaledPixels.GetColors()[i].B);
+    }
+
+    // Back at full scale the internal grid is dropped and the pixels are rendered directly
+    scaledCamera.GetResolutionScaler()->SetScale(1.0f);
+    Rasterizer::Rasterize(&scene, &scaledCamera);
+
+    for (uint16_t i = 0; i < 1024; i++) {
+        TEST_ASSERT_EQUAL(fullPixels.GetColors()[i].R, scaledPixels.GetColors()[i].R);
+        TEST_ASSERT_EQUAL(fullPixels.GetColors()[i].G, scaledPixels.GetColors()[i].G);
+    }
+
+    // Each camera of a group is held to its own budget, only the one over it scales down
+    CameraBase* group[2] = { &fullCamera, &scaledCamera };
+
+    fullCamera.GetResolutionScaler()->SetDynamic(1000.0f);
+    scaledCamera.GetResolutionScaler()->SetDynamic(1.0e-9f);
+    Rasterizer::Rasterize(&scene, group, 2);
+
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, fullCamera.GetResolutionScaler()->GetScale());
+    TEST_ASSERT_EQUAL_FLOAT(0.25f, scaledCamera.GetResolutionScaler()->GetScale());
+}
+
+void TestRasterizer::RunAllTests() {
+    RUN_TEST(TestPoolMatchesSerial);
+    RUN_TEST(TestIncrementalMatchesFull);
+    RUN_TEST(TestHitCacheMatchesUncached);
+    RUN_TEST(TestTriangleCacheMatchesUncached);
+    RUN_TEST(TestInterpolatedDepth);
+    RUN_TEST(TestReducedShadingRate);
+    RUN_TEST(TestReducedResolution);
+}
@@ -0,0 +1,43 @@
+/**
+ * @file TestRasterizer.h
+ * @brief Provides unit tests for the Rasterizer class.
+ *
+ * The `TestRasterizer` class contains static methods for testing that rasterizing on a
+ * thread pool, only the changed region of a frame, with the per-pixel hit cache, or
+ * with cached triangles of static meshes, produces the same image as rasterizing everything serially, that interpolated
+ * depth resolves intersecting triangles per pixel, that reduced shading rates keep edges sharp, and that reduced
+ * resolutions upscale smoothly.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <unity.h>
+#include "../lib/uc3d/systems/render/raster/rasterizer.hpp"
+#include "../lib/uc3d/systems/render/core/camera.hpp"
+#include "../lib/uc3d/systems/render/shader/implementations/normalshader.hpp"
+#include "../lib/uc3d/assets/model/statictrianglegroup.hpp"
+#include "../lib/uc3d/assets/model/trianglegroup.hpp"
+
+/**
+ * @class TestRasterizer
+ * @brief Contains static test methods for the Rasterizer class.
+ */
+class TestRasterizer {
+public:
+    static void TestPoolMatchesSerial(); ///< Tests that parallel projection and shading match the serial image.
+    static void TestIncrementalMatchesFull(); ///< Tests that shading only the dirty region matches a full render.
+    static void TestHitCacheMatchesUncached(); ///< Tests that seeding pixels with last frame's hit keeps the image.
+    static void TestTriangleCacheMatchesUncached(); ///< Tests that reusing projected triangles keeps the image.
+    static void TestInterpolatedDepth(); ///< Tests that intersecting triangles swap order where their depths cross.
+    static void TestReducedShadingRate(); ///< Tests that shading every 2nd or 4th pixel interpolates smooth areas only.
+    static void TestReducedResolution(); ///< Tests that rendering an internal half-resolution grid upscales smoothly and follows each camera's budget.
+
+    /**
+     * @brief Runs all the test methods in the class.
+     */
+    static void RunAllTests();
+};
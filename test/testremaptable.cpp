@@ -0,0 +1,48 @@
+#include "testremaptable.hpp"
+
+void TestRemapTable::TestBilinearHalfOffset() {
+    static PixelGroup<12> pixelGroup(Vector2D(4.0f, 3.0f), Vector2D(0.0f, 0.0f), 4);
+    RemapTable table(RemapTable::Bilinear);
+    RGBColor* colors = pixelGroup.GetColors();
+    RGBColor* buffer = pixelGroup.GetColorBuffer();
+    float parameters[1] = { 0.5f };
+    uint16_t right = 0;
+
+    for (uint16_t i = 0; i < 12; i++) colors[i] = RGBColor(i * 20, 0, 0);
+
+    TEST_ASSERT_TRUE(table.Prepare(&pixelGroup, parameters, 1));
+    TEST_ASSERT_TRUE(pixelGroup.GetRightIndex(5, &right));
+
+    for (uint16_t i = 0; i < 12; i++) table.SetOffset(&pixelGroup, i, 0.5f, 0.0f);
+
+    table.Gather(colors, buffer);
+
+    TEST_ASSERT_EQUAL((colors[5].R + colors[right].R) / 2, buffer[5].R);
+}
+
+void TestRemapTable::TestBilinearWholeStep() {
+    static PixelGroup<12> pixelGroup(Vector2D(4.0f, 3.0f), Vector2D(0.0f, 0.0f), 4);
+    RemapTable table(RemapTable::Bilinear);
+    RGBColor* colors = pixelGroup.GetColors();
+    RGBColor* buffer = pixelGroup.GetColorBuffer();
+    float parameters[1] = { 0.0f };
+
+    for (uint16_t i = 0; i < 12; i++) colors[i] = RGBColor(i * 20, 255 - i * 20, 0);
+
+    TEST_ASSERT_TRUE(table.Prepare(&pixelGroup, parameters, 1));
+
+    // The fraction of these offsets rounds to a full pixel in single precision
+    for (uint16_t i = 0; i < 12; i++) table.SetOffset(&pixelGroup, i, -1e-8f, -1e-8f);
+
+    table.Gather(colors, buffer);
+
+    for (uint16_t i = 0; i < 12; i++) {
+        TEST_ASSERT_EQUAL(colors[i].R, buffer[i].R);
+        TEST_ASSERT_EQUAL(colors[i].G, buffer[i].G);
+    }
+}
+
+void TestRemapTable::RunAllTests() {
+    RUN_TEST(TestBilinearHalfOffset);
+    RUN_TEST(TestBilinearWholeStep);
+}
@@ -0,0 +1,32 @@
+/**
+ * @file TestRemapTable.h
+ * @brief Provides unit tests for the RemapTable class.
+ *
+ * The `TestRemapTable` class contains static methods checking the bilinear taps and weights
+ * baked from pixel offsets.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <unity.h>
+#include "../lib/uc3d/systems/render/core/pixelgroup.hpp"
+#include "../lib/uc3d/systems/render/post/remaptable.hpp"
+
+/**
+ * @class TestRemapTable
+ * @brief Contains static test methods for the RemapTable class.
+ */
+class TestRemapTable {
+public:
+    static void TestBilinearHalfOffset(); ///< Tests that a half pixel offset blends the two neighbors evenly.
+    static void TestBilinearWholeStep(); ///< Tests that offsets just below a whole pixel sample the next pixel.
+
+    /**
+     * @brief Runs all the test methods in the class.
+     */
+    static void RunAllTests();
+};
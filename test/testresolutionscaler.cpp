@@ -0,0 +1,92 @@
+#include "testresolutionscaler.hpp"
+
+void TestResolutionScaler::TestPrepareSizesGrid() {
+    ResolutionScaler scaler;
+    PixelCoordinates physical(Vector2D(0, 0), Vector2D(1, 1), 32, 1024);
+
+    // Full scale renders the physical pixels directly
+    TEST_ASSERT_FALSE(scaler.IsActive());
+    TEST_ASSERT_FALSE(scaler.Prepare(Vector2D(0, 0), Vector2D(31, 31), physical));
+
+    scaler.SetScale(0.5f);
+
+    TEST_ASSERT_TRUE(scaler.IsActive());
+    TEST_ASSERT_TRUE(scaler.Prepare(Vector2D(0, 0), Vector2D(31, 31), physical));
+    TEST_ASSERT_FALSE(scaler.Prepare(Vector2D(0, 0), Vector2D(31, 31), physical));
+
+    PixelCoordinates internal = scaler.GetCoordinates();
+
+    TEST_ASSERT_EQUAL(16, internal.GetRowCount());
+    TEST_ASSERT_EQUAL(256, internal.GetPixelCount());
+    TEST_ASSERT_EQUAL_FLOAT(31.0f, internal[255].X);
+    TEST_ASSERT_EQUAL_FLOAT(31.0f, internal[255].Y);
+
+    // Returning to full scale releases the grid, which the renderer must learn about
+    scaler.SetScale(1.0f);
+
+    TEST_ASSERT_TRUE(scaler.Prepare(Vector2D(0, 0), Vector2D(31, 31), physical));
+    TEST_ASSERT_TRUE(scaler.GetColors() == nullptr);
+}
+
+void TestResolutionScaler::TestUpscaleInterpolates() {
+    ResolutionScaler scaler;
+    PixelCoordinates physical(Vector2D(0, 0), Vector2D(1, 1), 5, 5);
+
+    // A strip of five pixels sampled from the two corners of a 2 x 2 grid
+    scaler.SetScale(0.25f);
+    scaler.Prepare(Vector2D(0, 0), Vector2D(4, 0), physical);
+
+    PixelCoordinates internal = scaler.GetCoordinates();
+    RGBColor* colors = scaler.GetColors();
+
+    TEST_ASSERT_EQUAL(2, internal.GetRowCount());
+
+    for (uint16_t i = 0; i < internal.GetPixelCount(); i++) {
+        colors[i] = internal[i].X > 0.0f ? RGBColor(200, 100, 0) : RGBColor(0, 0, 40);
+    }
+
+    RGBColor output[5];
+
+    scaler.Upscale(physical, output, 0, 5);
+
+    TEST_ASSERT_EQUAL(0, output[0].R);
+    TEST_ASSERT_EQUAL(40, output[0].B);
+    TEST_ASSERT_EQUAL(50, output[1].R);
+    TEST_ASSERT_EQUAL(100, output[2].R);
+    TEST_ASSERT_EQUAL(50, output[2].G);
+    TEST_ASSERT_EQUAL(20, output[2].B);
+    TEST_ASSERT_EQUAL(200, output[4].R);
+    TEST_ASSERT_EQUAL(0, output[4].B);
+}
+
+void TestResolutionScaler::TestDynamicScale() {
+    ResolutionScaler scaler;
+
+    scaler.SetDynamic(0.01f, 0.25f, 1.0f);
+
+    // Four times over budget halves the scale per axis, a quarter of the pixels
+    scaler.ReportRenderTime(0.04f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.5f, scaler.GetScale());
+
+    // Within the band between the raise ratio and the target nothing changes
+    scaler.ReportRenderTime(0.009f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.5f, scaler.GetScale());
+
+    scaler.ReportRenderTime(0.001f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.55f, scaler.GetScale());
+
+    // The scale never leaves the configured range
+    scaler.ReportRenderTime(10.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.25f, scaler.GetScale());
+
+    // Without a target the scale stays where it was set
+    scaler.SetDynamic(0.0f);
+    scaler.ReportRenderTime(10.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.25f, scaler.GetScale());
+}
+
+void TestResolutionScaler::RunAllTests() {
+    RUN_TEST(TestPrepareSizesGrid);
+    RUN_TEST(TestUpscaleInterpolates);
+    RUN_TEST(TestDynamicScale);
+}
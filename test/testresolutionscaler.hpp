@@ -0,0 +1,32 @@
+/**
+ * @file TestResolutionScaler.h
+ * @brief Provides unit tests for the ResolutionScaler class.
+ *
+ * The `TestResolutionScaler` class contains static methods for testing how the internal grid
+ * is sized, how it is upscaled, and how dynamic scaling follows the render time.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <unity.h>
+#include "../lib/uc3d/systems/render/core/resolutionscaler.hpp"
+
+/**
+ * @class TestResolutionScaler
+ * @brief Contains static test methods for the ResolutionScaler class.
+ */
+class TestResolutionScaler {
+public:
+    static void TestPrepareSizesGrid(); ///< Tests that the internal grid follows the scale and reports changes.
+    static void TestUpscaleInterpolates(); ///< Tests that physical pixels between internal ones are blended.
+    static void TestDynamicScale(); ///< Tests that slow frames lower the scale and fast frames raise it.
+
+    /**
+     * @brief Runs all the test methods in the class.
+     */
+    static void RunAllTests();
+};
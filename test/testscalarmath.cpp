@@ -0,0 +1,73 @@
+#include "testscalarmath.hpp"
+
+void TestScalarMath::TestFixedSqrt() {
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, ScalarMath<Q16_16>::Sqrt(Q16_16(9)).ToFloat());
+    TEST_ASSERT_FLOAT_WITHIN(1.0f / 65536.0f, 1.4142135f, ScalarMath<Q16_16>::Sqrt(Q16_16(2)).ToFloat());
+    TEST_ASSERT_FLOAT_WITHIN(1.0f / 256.0f, 0.5f, ScalarMath<Q8_8>::Sqrt(Q8_8(0.25f)).ToFloat());
+    TEST_ASSERT_EQUAL(0, ScalarMath<Q16_16>::Sqrt(Q16_16(-4)).GetRaw());
+
+    // 0.001 is below the resolution of Q8.8, the tolerance falls back to one step
+    TEST_ASSERT_EQUAL(1, ScalarMath<Q8_8>::Epsilon().GetRaw());
+}
+
+void TestScalarMath::TestDoubleVector() {
+    Vector3<double> vector(1.0, 1.0e-9, 0.0);
+
+    // A nanometre offset on a metre would be lost in float
+    TEST_ASSERT_TRUE(vector.X + vector.Y != vector.X);
+    TEST_ASSERT_TRUE(std::fabs(Vector3<double>(3.0, 4.0, 0.0).Magnitude() - 5.0) < 1.0e-12);
+    TEST_ASSERT_TRUE(std::fabs(Vector3<double>(2.0, 3.0, 6.0).UnitSphere().Magnitude() - 1.0) < 1.0e-12);
+}
+
+void TestScalarMath::TestFixedVector() {
+    Vector3<Q16_16> first(Q16_16(1), Q16_16(2), Q16_16(3));
+    Vector3<Q16_16> second(Q16_16(-2), Q16_16(0.5f), Q16_16(4));
+
+    TEST_ASSERT_EQUAL_FLOAT(11.0f, first.DotProduct(second).ToFloat());
+    TEST_ASSERT_EQUAL_FLOAT(6.5f, first.CrossProduct(second).X.ToFloat());
+    TEST_ASSERT_EQUAL_FLOAT(-10.0f, first.CrossProduct(second).Y.ToFloat());
+    TEST_ASSERT_EQUAL_FLOAT(4.5f, first.CrossProduct(second).Z.ToFloat());
+    TEST_ASSERT_EQUAL_FLOAT(5.0f, Vector3<Q16_16>(Q16_16(0), Q16_16(3), Q16_16(4)).Magnitude().ToFloat());
+    TEST_ASSERT_EQUAL_FLOAT(3.5f, Vector3<Q16_16>::LERP(first, second, Q16_16(0.5f)).Z.ToFloat());
+
+    Vector2<Q8_8> normal = Vector2<Q8_8>(Q8_8(3), Q8_8(4)).UnitCircle();
+
+    TEST_ASSERT_FLOAT_WITHIN(2.0f / 256.0f, 0.6f, normal.X.ToFloat());
+    TEST_ASSERT_FLOAT_WITHIN(2.0f / 256.0f, 0.8f, normal.Y.ToFloat());
+}
+
+void TestScalarMath::TestFixedQuaternion() {
+    Quaternion rotation(0.9238795f, 0.0f, 0.0f, 0.3826834f);
+    Vector3D expected = rotation.RotateVector(Vector3D(2.0f, 1.0f, 0.5f));
+    Vector3<Q16_16> rotated = Quat<Q16_16>(rotation).RotateVector(Vector3<Q16_16>(Q16_16(2), Q16_16(1), Q16_16(0.5f)));
+
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, expected.X, rotated.X.ToFloat());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, expected.Y, rotated.Y.ToFloat());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, expected.Z, rotated.Z.ToFloat());
+
+#if defined(__FLT16_MAX__)
+    Vector3<_Float16> half = Quat<_Float16>(rotation).RotateVector(Vector3<_Float16>(2.0f, 1.0f, 0.5f));
+
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, expected.X, float(half.X));
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, expected.Y, float(half.Y));
+#endif
+}
+
+void TestScalarMath::TestConversion() {
+    Vector3D single(Vector3<double>(0.1, -2.5, 1000.0));
+    Vector3<Q16_16> fixed(single);
+    Quat<double> wide(Quaternion(0.5f, 0.5f, -0.5f, 0.5f));
+
+    TEST_ASSERT_EQUAL_FLOAT(0.1f, single.X);
+    TEST_ASSERT_EQUAL_FLOAT(-2.5f, fixed.Y.ToFloat());
+    TEST_ASSERT_EQUAL_FLOAT(1000.0f, fixed.Z.ToFloat());
+    TEST_ASSERT_TRUE(wide.Y == -0.5);
+}
+
+void TestScalarMath::RunAllTests() {
+    RUN_TEST(TestFixedSqrt);
+    RUN_TEST(TestDoubleVector);
+    RUN_TEST(TestFixedVector);
+    RUN_TEST(TestFixedQuaternion);
+    RUN_TEST(TestConversion);
+}
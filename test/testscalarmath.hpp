@@ -0,0 +1,34 @@
+/**
+ * @file TestScalarMath.h
+ * @brief Provides unit tests for ScalarMath and the vector types on other scalar types.
+ *
+ * The `TestScalarMath` class contains static methods checking Vector3, Vector2 and Quat with
+ * double, fixed-point and half float components against the float results.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <unity.h>
+#include "../lib/uc3d/core/math/quaternion.hpp"
+
+/**
+ * @class TestScalarMath
+ * @brief Contains static test methods for ScalarMath and the templated vector types.
+ */
+class TestScalarMath {
+public:
+    static void TestFixedSqrt(); ///< Tests the integer square root of the fixed-point formats.
+    static void TestDoubleVector(); ///< Tests that double vectors keep their precision.
+    static void TestFixedVector(); ///< Tests Q16.16 vector arithmetic and lengths.
+    static void TestFixedQuaternion(); ///< Tests rotating a vector with a Q16.16 quaternion.
+    static void TestConversion(); ///< Tests converting vectors between scalar types.
+
+    /**
+     * @brief Runs all the test methods in the class.
+     */
+    static void RunAllTests();
+};
@@ -0,0 +1,103 @@
+#include "testsharedmemorydisplay.hpp"
+
+size_t TestSharedMemoryDisplay::ReadFile(uint8_t* data, size_t size) {
+    FILE* file = fopen(kPath, "rb");
+
+    if (!file) return 0;
+
+    size_t read = fread(data, 1, size, file);
+    fclose(file);
+
+    return read;
+}
+
+void TestSharedMemoryDisplay::TestWritesFrame() {
+    RGBColor left[2] = { RGBColor(1, 2, 3), RGBColor(4, 5, 6) };
+    RGBColor right[3] = { RGBColor(7, 8, 9), RGBColor(10, 11, 12), RGBColor(13, 14, 15) };
+    const RGBColor* buffers[2] = { left, right };
+    uint16_t pixelCounts[2] = { 2, 3 };
+
+    SharedMemoryDisplay display(kPath, 8, 2);
+
+    TEST_ASSERT_TRUE(display.IsOpen());
+    TEST_ASSERT_TRUE(display.Submit(buffers, pixelCounts, 2));
+
+    display.Wait();
+
+    TEST_ASSERT_TRUE(display.IsComplete());
+    TEST_ASSERT_EQUAL(1, display.GetFramesWritten());
+
+    uint8_t data[256];
+    size_t size = ReadFile(data, sizeof(data));
+    const SharedMemoryDisplay::Header* header = reinterpret_cast<const SharedMemoryDisplay::Header*>(data);
+
+    TEST_ASSERT_EQUAL(sizeof(SharedMemoryDisplay::Header) + header->slotSize * 2, size);
+    TEST_ASSERT_EQUAL(SharedMemoryDisplay::kMagic, header->magic);
+    TEST_ASSERT_EQUAL(2, header->slotCount);
+    TEST_ASSERT_EQUAL(1, header->written.load());
+
+    const uint8_t* slot = data + sizeof(SharedMemoryDisplay::Header);
+    const SharedMemoryDisplay::SlotHeader* slotHeader = reinterpret_cast<const SharedMemoryDisplay::SlotHeader*>(slot);
+    const uint8_t* pixels = slot + sizeof(SharedMemoryDisplay::SlotHeader);
+
+    TEST_ASSERT_EQUAL(1, slotHeader->sequence.load());
+    TEST_ASSERT_EQUAL(5, slotHeader->pixelCount);
+
+    for (uint8_t i = 0; i < 15; i++) {
+        TEST_ASSERT_EQUAL(i + 1, pixels[i]);
+    }
+
+    remove(kPath);
+}
+
+void TestSharedMemoryDisplay::TestRingWraps() {
+    RGBColor colors[4];
+    const RGBColor* buffers[1] = { colors };
+    uint16_t pixelCounts[1] = { 4 };
+
+    SharedMemoryDisplay display(kPath, 4, 3);
+
+    for (uint8_t frame = 1; frame <= 5; frame++) {
+        for (uint8_t i = 0; i < 4; i++) colors[i] = RGBColor(frame, frame, frame);
+
+        TEST_ASSERT_TRUE(display.Submit(buffers, pixelCounts, 1));
+        display.Wait();
+    }
+
+    TEST_ASSERT_EQUAL(5, display.GetFramesWritten());
+
+    uint8_t data[256];
+    ReadFile(data, sizeof(data));
+    const SharedMemoryDisplay::Header* header = reinterpret_cast<const SharedMemoryDisplay::Header*>(data);
+
+    // Frames 4 and 5 replaced frames 1 and 2, frame 3 is still in the last slot
+    const uint8_t expected[3] = { 4, 5, 3 };
+
+    for (uint8_t i = 0; i < 3; i++) {
+        const uint8_t* slot = data + sizeof(SharedMemoryDisplay::Header) + header->slotSize * i;
+        const SharedMemoryDisplay::SlotHeader* slotHeader = reinterpret_cast<const SharedMemoryDisplay::SlotHeader*>(slot);
+
+        TEST_ASSERT_EQUAL(expected[i], slotHeader->sequence.load());
+        TEST_ASSERT_EQUAL(expected[i], slot[sizeof(SharedMemoryDisplay::SlotHeader)]);
+    }
+
+    remove(kPath);
+}
+
+void TestSharedMemoryDisplay::TestRejectsEmptyRing() {
+    RGBColor colors[1];
+    const RGBColor* buffers[1] = { colors };
+    uint16_t pixelCounts[1] = { 1 };
+
+    SharedMemoryDisplay display(kPath, 1, 0);
+
+    TEST_ASSERT_FALSE(display.IsOpen());
+    TEST_ASSERT_FALSE(display.Submit(buffers, pixelCounts, 1));
+    TEST_ASSERT_EQUAL(0, display.GetFramesWritten());
+}
+
+void TestSharedMemoryDisplay::RunAllTests() {
+    RUN_TEST(TestWritesFrame);
+    RUN_TEST(TestRingWraps);
+    RUN_TEST(TestRejectsEmptyRing);
+}
@@ -0,0 +1,45 @@
+/**
+ * @file TestSharedMemoryDisplay.h
+ * @brief Provides unit tests for the SharedMemoryDisplay class.
+ *
+ * The `TestSharedMemoryDisplay` class contains static methods for testing that submitted
+ * frames appear in the ring file in the documented layout.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <cstdio>
+#include "../lib/uc3d/systems/output/sharedmemorydisplay.hpp"
+
+/**
+ * @class TestSharedMemoryDisplay
+ * @brief Contains static test methods for the SharedMemoryDisplay class.
+ */
+class TestSharedMemoryDisplay {
+private:
+    static constexpr const char* kPath = "uc3d_test_display.bin"; ///< Ring file created by the tests.
+
+    /**
+     * @brief Reads the ring file written by the driver.
+     *
+     * @param data [out] Buffer receiving the file contents.
+     * @param size Size of the buffer in bytes.
+     * @return Number of bytes read.
+     */
+    static size_t ReadFile(uint8_t* data, size_t size);
+
+public:
+    static void TestWritesFrame(); ///< Tests that buffers of a frame are written back to back into the first slot.
+    static void TestRingWraps(); ///< Tests that later frames cycle through the slots.
+    static void TestRejectsEmptyRing(); ///< Tests that a ring without slots is not opened.
+
+    /**
+     * @brief Runs all the test methods in the class.
+     */
+    static void RunAllTests();
+};
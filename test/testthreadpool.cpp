@@ -0,0 +1,224 @@
+#include "testthreadpool.hpp"
+
+static void CountIteration(uint32_t index, void* context) {
+    static_cast<uint8_t*>(context)[index]++;
+}
+
+void TestThreadPool::TestEveryIndexOnce() {
+    ThreadPool pool(4);
+    uint8_t counts[1000] = {0};
+
+    pool.ParallelFor(1000, CountIteration, counts);
+
+    for (uint16_t i = 0; i < 1000; i++) {
+        TEST_ASSERT_EQUAL(1, counts[i]);
+    }
+}
+
+void TestThreadPool::TestRepeatedLoops() {
+    ThreadPool pool(4);
+    uint8_t counts[64] = {0};
+
+    for (uint8_t loop = 0; loop < 200; loop++) {
+        pool.ParallelFor(64, CountIteration, counts);
+    }
+
+    for (uint8_t i = 0; i < 64; i++) {
+        TEST_ASSERT_EQUAL(200, counts[i]);
+    }
+}
+
+void TestThreadPool::TestSingleThread() {
+    ThreadPool pool(1);
+    uint8_t counts[16] = {0};
+
+    pool.ParallelFor(16, CountIteration, counts);
+
+    TEST_ASSERT_EQUAL(1, pool.GetThreadCount());
+
+    for (uint8_t i = 0; i < 16; i++) {
+        TEST_ASSERT_EQUAL(1, counts[i]);
+    }
+}
+
+struct DependencyChain {
+    std::atomic<uint32_t> step{0}; // Number of jobs that ran so far
+    uint32_t order[64] = {0}; // Step at which each job ran
+};
+
+static void RecordStep(uint32_t index, void* context) {
+    DependencyChain* chain = static_cast<DependencyChain*>(context);
+
+    chain->order[index] = chain->step.fetch_add(1);
+}
+
+void TestThreadPool::TestDependencies() {
+    ThreadPool pool(4);
+    DependencyChain chain;
+    ThreadPool::JobHandle handles[64];
+
+    // Each job depends on the two jobs before it, so the jobs must run strictly in order
+    for (uint32_t i = 0; i < 64; i++) {
+        ThreadPool::JobHandle dependencies[2] = { i > 0 ? handles[i - 1] : nullptr, i > 1 ? handles[i - 2] : nullptr };
+
+        handles[i] = pool.Submit(RecordStep, &chain, i, dependencies, 2);
+    }
+
+    pool.Wait(handles[63]);
+
+    for (uint32_t i = 0; i < 64; i++) {
+        TEST_ASSERT_TRUE(pool.IsFinished(handles[i]));
+        TEST_ASSERT_EQUAL(i, chain.order[i]);
+    }
+}
+
+struct NestedLoop {
+    ThreadPool* pool;
+    uint8_t counts[16][32];
+};
+
+static void CountInnerIteration(uint32_t index, void* context) {
+    // Each outer iteration passes its own row of counters as the context
+    static_cast<uint8_t*>(context)[index]++;
+}
+
+static void RunInnerLoop(uint32_t index, void* context) {
+    NestedLoop* loop = static_cast<NestedLoop*>(context);
+
+    loop->pool->ParallelFor(32, CountInnerIteration, loop->counts[index]);
+}
+
+void TestThreadPool::TestNestedLoops() {
+    ThreadPool pool(4);
+    NestedLoop loop{ &pool, {{0}} };
+
+    pool.ParallelFor(16, RunInnerLoop, &loop);
+
+    for (uint8_t i = 0; i < 16; i++) {
+        for (uint8_t j = 0; j < 32; j++) {
+            TEST_ASSERT_EQUAL(1, loop.counts[i][j]);
+        }
+    }
+}
+
+static void IntegrateRow(uint32_t index, void* context) {
+    float* rows = static_cast<float*>(context);
+    float sum = 0.0f;
+
+    // Enough arithmetic per iteration that scheduling overhead stays small
+    for (uint32_t i = 0; i < 20000; i++) {
+        sum += sqrtf(float(index * 20000 + i));
+    }
+
+    rows[index] = sum;
+}
+
+struct LongJob {
+    std::atomic<bool> started{false};
+    std::atomic<bool> release{false};
+    std::atomic<bool> done{false};
+};
+
+static void RunLongJob(uint32_t, void* context) {
+    LongJob* job = static_cast<LongJob*>(context);
+
+    job->started.store(true);
+
+    while (!job->release.load()) std::this_thread::yield();
+
+    job->done.store(true);
+}
+
+static void RunNothing(uint32_t, void*) {}
+
+void TestThreadPool::TestRecordReuse() {
+    ThreadPool pool(2);
+    LongJob longJob;
+    ThreadPool::JobHandle handle = pool.Submit(RunLongJob, &longJob);
+
+    // Only the worker may run the long job, the caller would block on it while helping below
+    while (!longJob.started.load()) std::this_thread::yield();
+
+    for (uint32_t i = 0; i < ThreadPool::kMaxJobs * 2 + 1; i++) {
+        pool.Wait(pool.Submit(RunNothing, nullptr, i));
+    }
+
+    TEST_ASSERT_FALSE(pool.IsFinished(handle));
+
+    longJob.release.store(true);
+    pool.Wait(handle);
+
+    TEST_ASSERT_TRUE(longJob.done.load());
+}
+
+void TestThreadPool::TestStaleHandle() {
+    ThreadPool pool(2);
+    ThreadPool::JobHandle stale = pool.Submit(RunNothing, nullptr);
+
+    pool.Wait(stale);
+
+    // Every record is free, so the ring comes back to the finished job's record after kMaxJobs claims
+    for (uint32_t i = 1; i < ThreadPool::kMaxJobs; i++) {
+        pool.Wait(pool.Submit(RunNothing, nullptr, i));
+    }
+
+    LongJob longJob;
+    ThreadPool::JobHandle handle = pool.Submit(RunLongJob, &longJob);
+
+    while (!longJob.started.load()) std::this_thread::yield();
+
+    TEST_ASSERT_TRUE(handle.job == stale.job);
+    TEST_ASSERT_FALSE(pool.IsFinished(handle));
+    TEST_ASSERT_TRUE(pool.IsFinished(stale));
+
+    // Waiting on and depending on the old handle must not wait for the job now in its record
+    pool.Wait(stale);
+    pool.Wait(pool.Submit(RunNothing, nullptr, 0, &stale, 1));
+
+    TEST_ASSERT_FALSE(longJob.done.load());
+
+    longJob.release.store(true);
+    pool.Wait(handle);
+}
+
+void TestThreadPool::BenchmarkScaling() {
+    const uint32_t rowCount = 512;
+    uint8_t maxThreads = ThreadPool().GetThreadCount();
+    float* reference = new float[rowCount];
+    float* rows = new float[rowCount];
+    char message[160];
+    int length = snprintf(message, sizeof(message), "Rows %u:", unsigned(rowCount));
+
+    for (uint32_t i = 0; i < rowCount; i++) IntegrateRow(i, reference);
+
+    for (uint8_t threads = 1; threads <= maxThreads && length < int(sizeof(message)) - 24; threads *= 2) {
+        ThreadPool pool(threads);
+        uint32_t start = uc3d::Time::Micros();
+
+        pool.ParallelFor(rowCount, IntegrateRow, rows);
+
+        uint32_t elapsed = uc3d::Time::Micros() - start;
+
+        length += snprintf(message + length, sizeof(message) - length, "%s %u threads %.3f ms", threads > 1 ? "," : "", unsigned(threads), elapsed / 1000.0f);
+
+        for (uint32_t i = 0; i < rowCount; i++) {
+            TEST_ASSERT_EQUAL_FLOAT(reference[i], rows[i]);
+        }
+    }
+
+    TEST_MESSAGE(message);
+
+    delete[] reference;
+    delete[] rows;
+}
+
+void TestThreadPool::RunAllTests() {
+    RUN_TEST(TestEveryIndexOnce);
+    RUN_TEST(TestRepeatedLoops);
+    RUN_TEST(TestSingleThread);
+    RUN_TEST(TestDependencies);
+    RUN_TEST(TestNestedLoops);
+    RUN_TEST(TestRecordReuse);
+    RUN_TEST(TestStaleHandle);
+    RUN_TEST(BenchmarkScaling);
+}
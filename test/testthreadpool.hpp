@@ -0,0 +1,41 @@
+/**
+ * @file TestThreadPool.h
+ * @brief Provides unit tests for the ThreadPool class.
+ *
+ * The `TestThreadPool` class contains static methods for testing that parallel loops run
+ * every iteration exactly once, that jobs respect their dependencies, and for measuring how
+ * a loop scales with the number of threads.
+ *
+ * @date 16/10/2026
+ * @version 1.0
+ * @author Coela Can't
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <cmath>
+#include <cstdio>
+#include "../lib/uc3d/core/platform/time.hpp"
+#include "../lib/uc3d/core/platform/threadpool.hpp"
+
+/**
+ * @class TestThreadPool
+ * @brief Contains static test methods for the ThreadPool class.
+ */
+class TestThreadPool {
+public:
+    static void TestEveryIndexOnce(); ///< Tests that each iteration of a loop runs exactly once.
+    static void TestRepeatedLoops(); ///< Tests many back-to-back loops on the same pool.
+    static void TestSingleThread(); ///< Tests that a pool without workers runs loops on the caller.
+    static void TestDependencies(); ///< Tests that jobs only start after the jobs they depend on.
+    static void TestNestedLoops(); ///< Tests loops started from inside the iterations of another loop.
+    static void TestRecordReuse(); ///< Tests that a running job keeps its record while more than kMaxJobs jobs are submitted.
+    static void TestStaleHandle(); ///< Tests that a handle whose record was reused reports its own job as finished.
+    static void BenchmarkScaling(); ///< Measures a compute-bound loop on 1 to N threads.
+
+    /**
+     * @brief Runs all the test methods in the class.
+     */
+    static void RunAllTests();
+};